@@ -0,0 +1,212 @@
+#!/usr/bin/env node
+// Lists the System V semaphore sets on the host with their values, reference counts and waiters, like ipcs -s with
+// what is inside each set. With --watch it redraws every few seconds, like top. With --reap it removes the sets left
+// behind by processes that exited among the keys given with --keys, once or, with --daemon, every so often.
+
+const { Semaphore } = require('..');
+
+const usage = `usage: sysv-semaphores [options]
+
+  --sort <column>   waiters (default), refs, nsems, otime, ctime, id or key
+  --limit <n>       show only the first n sets
+  --owner <uid>     show only the sets owned by uid
+  --watch [secs]    redraw every secs seconds, 2 by default
+  --json            print the sets as JSON and exit
+  --reap <secs>     remove the sets that no process holds or waits on and nobody has touched for secs seconds
+  --keys <a>-<b>    with --reap, the keys to reap from, such as 0x61000000-0x61ffffff; required, as other sets of
+                    two semaphores can look like a Semaphore's
+  --daemon [secs]   with --reap, keep reaping every secs seconds, 60 by default`;
+
+const orders = {
+  waiters: (a, b) => b.waiters - a.waiters,
+  refs: (a, b) => b.refs - a.refs,
+  nsems: (a, b) => b.nsems - a.nsems,
+  otime: (a, b) => b.otime - a.otime,
+  ctime: (a, b) => b.ctime - a.ctime,
+  id: (a, b) => a.id - b.id,
+  key: (a, b) => a.key - b.key
+};
+
+function fail(message) {
+  console.error(`${message}\n\n${usage}`);
+  process.exit(2);
+}
+
+function parse(args) {
+  const options = {
+    sort: 'waiters',
+    limit: Infinity,
+    owner: null,
+    watch: 0,
+    json: false,
+    reap: null,
+    keys: null,
+    daemon: 0
+  };
+  for (let i = 0; i < args.length; i++) {
+    switch (args[i]) {
+      case '--sort':
+        options.sort = args[++i];
+        if (!orders[options.sort]) {
+          fail(`unknown column ${options.sort}`);
+        }
+        break;
+      case '--limit':
+        options.limit = Number(args[++i]);
+        if (!Number.isInteger(options.limit) || options.limit < 0) {
+          fail('--limit takes a number');
+        }
+        break;
+      case '--owner':
+        options.owner = Number(args[++i]);
+        if (!Number.isInteger(options.owner)) {
+          fail('--owner takes a uid');
+        }
+        break;
+      case '--watch':
+        options.watch = 2;
+        if (i + 1 < args.length && !args[i + 1].startsWith('--')) {
+          options.watch = Number(args[++i]);
+          if (!(options.watch > 0)) {
+            fail('--watch takes a number of seconds');
+          }
+        }
+        break;
+      case '--json':
+        options.json = true;
+        break;
+      case '--reap':
+        options.reap = Number(args[++i]);
+        if (!Number.isInteger(options.reap) || options.reap < 0) {
+          fail('--reap takes a number of seconds');
+        }
+        break;
+      case '--keys': {
+        const range = String(args[++i]).split('-').map(Number);
+        if (range.length !== 2 || !range.every((key) => Number.isInteger(key) && key >= 0 && key <= 0xffffffff)) {
+          fail('--keys takes a range of keys, such as 0x61000000-0x61ffffff');
+        }
+        options.keys = range;
+        break;
+      }
+      case '--daemon':
+        options.daemon = 60;
+        if (i + 1 < args.length && !args[i + 1].startsWith('--')) {
+          options.daemon = Number(args[++i]);
+          if (!(options.daemon > 0)) {
+            fail('--daemon takes a number of seconds');
+          }
+        }
+        break;
+      case '--help':
+        console.log(usage);
+        process.exit(0);
+        break;
+      default:
+        fail(`unknown option ${args[i]}`);
+    }
+  }
+  if (options.daemon && options.reap === null) {
+    fail('--daemon needs --reap');
+  }
+  if ((options.reap === null) !== (options.keys === null)) {
+    fail('--reap and --keys go together');
+  }
+  return options;
+}
+
+// the native list is a SWIG vector of structs, copied into plain objects so it can be sorted and serialised
+function snapshot(options) {
+  const list = Semaphore.list();
+  const sets = [];
+  for (let i = 0; i < list.size(); i++) {
+    const info = list.get(i);
+    if (options.owner !== null && info.owner !== options.owner) {
+      continue;
+    }
+    const values = [];
+    for (let slot = 0; slot < info.values.size(); slot++) {
+      values.push(info.values.get(slot));
+    }
+    sets.push({
+      key: info.key,
+      id: info.id,
+      owner: info.owner,
+      mode: info.mode,
+      nsems: info.nsems,
+      otime: info.otime,
+      ctime: info.ctime,
+      values,
+      refs: info.refs,
+      waitingToDecrement: info.waitingToDecrement,
+      waitingForZero: info.waitingForZero,
+      waiters: info.waitingToDecrement + info.waitingForZero
+    });
+  }
+  sets.sort(orders[options.sort]);
+  return sets.slice(0, options.limit);
+}
+
+function time(seconds) {
+  return seconds ? new Date(seconds * 1000).toISOString().slice(0, 19).replace('T', ' ') : 'never';
+}
+
+// the first few values, as a sharded set or a namespace holds thousands
+function shown(values) {
+  const text = values.slice(0, 8).join(',');
+  return values.length > 8 ? `${text},…` : text;
+}
+
+function table(sets) {
+  const rows = [['KEY', 'SEMID', 'OWNER', 'PERMS', 'NSEMS', 'REFS', 'WAITING', 'ZERO', 'LAST OP', 'VALUES']];
+  for (const set of sets) {
+    rows.push([
+      `0x${(set.key >>> 0).toString(16).padStart(8, '0')}`,
+      String(set.id),
+      String(set.owner),
+      set.mode.toString(8).padStart(3, '0'),
+      String(set.nsems),
+      String(set.refs),
+      String(set.waitingToDecrement),
+      String(set.waitingForZero),
+      time(set.otime),
+      set.values.length ? shown(set.values) : '-'
+    ]);
+  }
+  const widths = rows[0].map((_, column) => rows.reduce((width, row) => Math.max(width, row[column].length), 0));
+  return rows.map((row) => row.map((cell, column) => cell.padEnd(widths[column])).join('  ').trimEnd()).join('\n');
+}
+
+function header() {
+  const limits = Semaphore.limits();
+  const of = (used, max) => (max ? `${used}/${max}` : String(used));
+  return (
+    `sets ${of(limits.setsInUse, limits.maxSets)}  semaphores ${of(limits.semaphoresInUse, limits.maxSemaphores)}  ` +
+    `per set ${limits.maxSetSize}  ops per call ${limits.maxOpsPerCall}`
+  );
+}
+
+function reap(olderThan, [first, last]) {
+  const reaped = Semaphore.reap(olderThan, first, last);
+  if (reaped || !options.daemon) {
+    console.log(`${new Date().toISOString()}  reaped ${reaped} set${reaped === 1 ? '' : 's'}`);
+  }
+}
+
+const options = parse(process.argv.slice(2));
+if (options.reap !== null) {
+  reap(options.reap, options.keys);
+  if (options.daemon) {
+    setInterval(() => reap(options.reap, options.keys), options.daemon * 1000);
+  }
+} else if (options.json) {
+  console.log(JSON.stringify(snapshot(options), null, 2));
+} else if (options.watch) {
+  const draw = () => {
+    process.stdout.write(`\x1b[H\x1b[2J${new Date().toISOString()}  ${header()}\n\n${table(snapshot(options))}\n`);
+  };
+  draw();
+  setInterval(draw, options.watch * 1000);
+} else {
+  console.log(table(snapshot(options)));
+}
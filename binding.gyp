@@ -1,7 +1,7 @@
 {
   "targets": [{
     "target_name": "sysv-semaphore",
-    "sources": [ "src/error.cpp", "src/token.cpp", "src/semaphore-sysv.cpp", "src/main.cpp" ],
+    "sources": [ "src/error.cpp", "src/token.cpp", "src/semaphore-sysv.cpp", "src/semaphore-limits.cpp", "src/semaphore-list.cpp", "src/semop-timed.cpp", "src/semaphore-set.cpp", "src/countdown-latch.cpp", "src/barrier.cpp", "src/rwlock.cpp", "src/event.cpp", "src/condition.cpp", "src/recursive-mutex.cpp", "src/semaphore-array.cpp", "src/semaphore-sharded.cpp", "src/semaphore-namespace.cpp", "src/semaphore-eventfd.cpp", "src/semaphore-posix.cpp", "src/semaphore-futex.cpp", "src/wait-async.cpp", "src/main.cpp" ],
     "include_dirs": ["node_modules/node-addon-api", "src-vendor/errnoname", "/usr/include", "src"],
     "cflags_cc": ["-fexceptions", "-frtti", "-std=c++17", "-pthread" ],
     "conditions": [
@@ -3,3 +3,19 @@ const things = require('node-gyp-build')(__dirname);
 exports.Token = things.Token;
 exports.SemaphoreV = things.SemaphoreV;
 exports.Semaphore = things.SemaphoreV;
+exports.SemaphoreVList = things.SemaphoreVList;
+exports.SemaphoreSetInfoList = things.SemaphoreSetInfoList;
+exports.SemaphoreE = things.SemaphoreE;
+exports.SemaphoreP = things.SemaphoreP;
+exports.SemaphoreF = things.SemaphoreF;
+exports.SemaphoreS = require('./semaphore-shared.js');
+exports.CountdownLatch = things.CountdownLatch;
+exports.Barrier = things.Barrier;
+exports.RwLock = things.RwLock;
+exports.Event = things.Event;
+exports.Condition = things.Condition;
+exports.RecursiveMutex = things.RecursiveMutex;
+exports.SemaphoreArray = things.SemaphoreArray;
+exports.SemaphoreSharded = things.SemaphoreSharded;
+exports.SemaphoreNamespace = things.SemaphoreNamespace;
+exports.NamedSemaphore = things.NamedSemaphore;
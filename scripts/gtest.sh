@@ -16,10 +16,16 @@ mkdir -p "gtest/$PLATFORM"
         Darwin) 
           DYLD_INSERT_LIBRARIES=./libmocksys.dylib DYLD_FORCE_FLAT_NAMESPACE=1 ./mock_syscalls_tests
           DYLD_INSERT_LIBRARIES=./libmocksys.dylib DYLD_FORCE_FLAT_NAMESPACE=1 ./semaphore_tests
+          DYLD_INSERT_LIBRARIES=./libmocksys.dylib DYLD_FORCE_FLAT_NAMESPACE=1 ./syscall_budget_tests
+          ./semaphore_kernel_tests
+          DYLD_FORCE_FLAT_NAMESPACE=1 ./recorder_tests
           ;;
         Linux) 
           LD_PRELOAD=./libmocksys.so ./mock_syscalls_tests
           LD_PRELOAD=./libmocksys.so ./semaphore_tests
+          LD_PRELOAD=./libmocksys.so ./syscall_budget_tests
+          ./semaphore_kernel_tests
+          ./recorder_tests
           ;;
     esac
 )
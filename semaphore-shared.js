@@ -0,0 +1,177 @@
+// A semaphore for the worker_threads of one process, with the same operations as SemaphoreV. The count is an
+// Int32Array over a SharedArrayBuffer, so operations are Atomics on memory shared by the threads rather than a
+// system call on a kernel set. Pass `semaphore.buffer` to a worker with postMessage and adopt it there with
+// `SemaphoreS.from(buffer)`.
+//
+// wait() blocks the calling thread with Atomics.wait, waitAsync() returns a Promise that resolves once the units are
+// held. There is no SEM_UNDO: units held by a worker that exits are not given back.
+
+const { constants } = require('node:os');
+
+const COUNT = 0;
+const WAITERS = 1; // threads and promises that may be asleep on COUNT
+const BULK_WAITERS = 2; // the waiters for more than one unit, which a single notify may not satisfy
+const REFS = 3;
+const SLOTS = 4;
+
+const messages = {
+  EINVAL: 'Invalid argument',
+  ERANGE: 'Result too large'
+};
+
+// the same shape as the errors thrown by the native semaphores
+function errnoError(code, syscall) {
+  const error = new Error(`${code}: ${messages[code]}, ${syscall}`);
+  error.errno = constants.errno[code];
+  error.code = code;
+  error.syscall = syscall;
+  return error;
+}
+
+function units(value, name) {
+  if (!Number.isInteger(value) || value < 0) {
+    throw new TypeError(`Illegal arguments for function ${name}.`);
+  }
+  return value;
+}
+
+class SemaphoreS {
+  constructor(buffer) {
+    if (!(buffer instanceof SharedArrayBuffer) || buffer.byteLength < SLOTS * 4) {
+      throw new TypeError('Illegal arguments for function from.');
+    }
+    this.buffer = buffer;
+    this.state = new Int32Array(buffer, 0, SLOTS);
+    this.closed = false;
+  }
+
+  static create(value = 0) {
+    const semaphore = new SemaphoreS(new SharedArrayBuffer(SLOTS * 4));
+    Atomics.store(semaphore.state, COUNT, units(value, 'create'));
+    // the creator's handle is counted, as SemaphoreV counts it
+    Atomics.store(semaphore.state, REFS, 1);
+    return semaphore;
+  }
+
+  // like SemaphoreV.open, the reference is counted and given back by close()
+  static from(buffer) {
+    const semaphore = new SemaphoreS(buffer);
+    Atomics.add(semaphore.state, REFS, 1);
+    return semaphore;
+  }
+
+  check(syscall) {
+    if (this.closed) {
+      throw errnoError('EINVAL', syscall);
+    }
+  }
+
+  trywait(value = 1) {
+    units(value, 'trywait');
+    this.check('trywait');
+    let count = Atomics.load(this.state, COUNT);
+    while (count >= value) {
+      const seen = Atomics.compareExchange(this.state, COUNT, count, count - value);
+      if (seen === count) {
+        return true;
+      }
+      count = seen;
+    }
+    return false;
+  }
+
+  wait(value = 1) {
+    if (this.trywait(value)) {
+      return;
+    }
+    this.waiting(value, 1);
+    try {
+      while (!this.trywait(value)) {
+        const count = Atomics.load(this.state, COUNT);
+        if (count < value) {
+          Atomics.wait(this.state, COUNT, count);
+        }
+      }
+    } finally {
+      this.waiting(value, -1);
+    }
+  }
+
+  async waitAsync(value = 1) {
+    if (this.trywait(value)) {
+      return;
+    }
+    this.waiting(value, 1);
+    try {
+      while (!this.trywait(value)) {
+        const count = Atomics.load(this.state, COUNT);
+        if (count >= value) {
+          continue;
+        }
+        if (Atomics.waitAsync) {
+          const result = Atomics.waitAsync(this.state, COUNT, count);
+          if (result.async) {
+            await result.value;
+          }
+        } else {
+          // Node before 16 has no Atomics.waitAsync, so poll instead
+          await new Promise((resolve) => setTimeout(resolve, 1));
+        }
+      }
+    } finally {
+      this.waiting(value, -1);
+    }
+  }
+
+  post(value = 1) {
+    units(value, 'post');
+    this.check('post');
+    // checked and added in one exchange, so posts racing each other cannot carry the count past the limit together
+    let count = Atomics.load(this.state, COUNT);
+    for (;;) {
+      if (count > 0x7fffffff - value) {
+        throw errnoError('ERANGE', 'post');
+      }
+      const seen = Atomics.compareExchange(this.state, COUNT, count, count + value);
+      if (seen === count) {
+        break;
+      }
+      count = seen;
+    }
+    if (Atomics.load(this.state, WAITERS) > 0) {
+      Atomics.notify(this.state, COUNT, Atomics.load(this.state, BULK_WAITERS) > 0 ? Infinity : value);
+    }
+  }
+
+  waiting(value, change) {
+    Atomics.add(this.state, WAITERS, change);
+    if (value > 1) {
+      Atomics.add(this.state, BULK_WAITERS, change);
+    }
+  }
+
+  valueOf() {
+    this.check('valueOf');
+    return Atomics.load(this.state, COUNT);
+  }
+
+  refs() {
+    this.check('refs');
+    return Atomics.load(this.state, REFS);
+  }
+
+  close() {
+    this.check('close');
+    let refs = Atomics.load(this.state, REFS);
+    while (refs > 0) {
+      const seen = Atomics.compareExchange(this.state, REFS, refs, refs - 1);
+      if (seen === refs) {
+        break;
+      }
+      refs = seen;
+    }
+    this.closed = true;
+  }
+}
+
+module.exports = SemaphoreS;
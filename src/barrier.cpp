@@ -0,0 +1,174 @@
+#include "barrier.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <system_error>
+
+#define COUNTERS 0   // three arrival counters, one per generation in rotation
+#define GENERATION 3 // the counter of the current generation, 0 to 2
+#define LIVE 4       // participants that are open, SEM_UNDO so it drops when one exits
+#define JOINED 5     // participants that have opened and not closed, including those that exited since the last reset
+#define BROKEN 6     // 0, or the errno waiters throw
+#define PARTIES 7
+#define SLOTS 8
+
+#define SLICE_MS 50u // how long a waiter sleeps between checks that the barrier is not broken
+
+static void checkParties(unsigned parties) {
+  if (parties == 0) {
+    throw std::system_error(EINVAL, std::system_category(), "barrier");
+  }
+}
+
+Barrier *Barrier::createExclusive(Token &key, int mode, unsigned parties) {
+  checkParties(parties);
+  int values[SLOTS] = {(int)parties, (int)parties, 0, 0, 0, 0, 0, (int)parties};
+  Barrier *barrier = new Barrier(SemaphoreSet::createExclusive(key, mode, SLOTS, values));
+  barrier->join();
+  return barrier;
+}
+
+Barrier *Barrier::create(Token &key, int mode, unsigned parties) {
+  checkParties(parties);
+  int values[SLOTS] = {(int)parties, (int)parties, 0, 0, 0, 0, 0, (int)parties};
+  Barrier *barrier = new Barrier(SemaphoreSet::create(key, mode, SLOTS, values));
+  barrier->join();
+  return barrier;
+}
+
+Barrier *Barrier::open(Token &key) {
+  Barrier *barrier = new Barrier(SemaphoreSet::open(key, SLOTS));
+  barrier->join();
+  return barrier;
+}
+
+void Barrier::unlink(Token &key) { SemaphoreSet::unlink(key); }
+
+void Barrier::join() {
+  struct sembuf ops[2] = {{LIVE, 1, SEM_UNDO}, {JOINED, 1, 0}};
+  set->op(ops, 2);
+}
+
+void Barrier::breakWith(int reason) {
+  // the first reason is kept
+  struct sembuf ops[2] = {{BROKEN, 0, 0}, {BROKEN, (short)reason, 0}};
+  set->tryop(ops, 2);
+}
+
+int Barrier::brokenReason() {
+  unsigned short values[SLOTS + 1];
+  set->getAll(values);
+  if (!values[BROKEN] && values[JOINED] > values[LIVE]) {
+    // a participant exited without closing, so the SEM_UNDO took its live reference
+    breakWith(EOWNERDEAD);
+    return set->get(BROKEN);
+  }
+  return values[BROKEN];
+}
+
+void Barrier::throwIfBroken() {
+  const int reason = brokenReason();
+  if (reason) {
+    throw std::system_error(reason, std::system_category(), "barrier");
+  }
+}
+
+unsigned Barrier::arrive() {
+  do {
+    throwIfBroken();
+    unsigned short generation = set->get(GENERATION);
+    unsigned short counter = COUNTERS + generation;
+    unsigned short previous = COUNTERS + (generation + 2) % 3;
+    short parties = set->get(PARTIES);
+    // the last arrival opens the generation, re-arms the previous counter and moves the generation on
+    struct sembuf last[4] = {
+        {counter, -1, 0}, {counter, 0, 0}, {previous, parties, 0}, {GENERATION, (short)(generation == 2 ? -2 : 1), 0}};
+    if (set->tryop(last, 4)) {
+      return generation;
+    }
+    // any other arrival leaves at least one for the last
+    struct sembuf other[2] = {{counter, -2, 0}, {counter, 1, 0}};
+    if (set->tryop(other, 2)) {
+      return generation;
+    }
+    // the generation moved on between reading it and arriving, so look again
+  } while (true);
+}
+
+bool Barrier::passed(unsigned generation) {
+  struct sembuf op = {(unsigned short)(COUNTERS + generation % 3), 0, 0};
+  if (set->tryop(&op, 1)) {
+    return true;
+  }
+  throwIfBroken();
+  return false;
+}
+
+bool Barrier::timedwaitFor(unsigned generation, unsigned milliseconds) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+  struct sembuf op = {(unsigned short)(COUNTERS + generation % 3), 0, 0};
+  do {
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    if (set->timedop(&op, 1, std::min<unsigned>(std::max<long>(left.count(), 0), SLICE_MS))) {
+      return true;
+    }
+    throwIfBroken();
+  } while (std::chrono::steady_clock::now() < deadline);
+  breakWith(ETIMEDOUT);
+  return false;
+}
+
+void Barrier::wait() {
+  unsigned generation = arrive();
+  struct sembuf op = {(unsigned short)(COUNTERS + generation), 0, 0};
+  while (!set->timedop(&op, 1, SLICE_MS)) {
+    throwIfBroken();
+  }
+}
+
+bool Barrier::timedwait(unsigned milliseconds) { return timedwaitFor(arrive(), milliseconds); }
+
+unsigned Barrier::parties() { return set->get(PARTIES); }
+
+unsigned Barrier::arrived() { return parties() - set->get(COUNTERS + set->get(GENERATION)); }
+
+bool Barrier::isBroken() { return brokenReason() != 0; }
+
+void Barrier::reset() {
+  unsigned short values[SLOTS + 1];
+  set->getAll(values);
+  // forget the participants that exited without closing
+  set->set(JOINED, values[LIVE]);
+  set->set(COUNTERS, values[PARTIES]);
+  set->set(COUNTERS + 1, values[PARTIES]);
+  set->set(COUNTERS + 2, 0);
+  set->set(GENERATION, 0);
+  set->set(BROKEN, 0);
+}
+
+unsigned Barrier::refs() { return set->refs(); }
+
+void Barrier::close() {
+  if (!set) {
+    throw std::system_error(EINVAL, std::system_category(), "semop");
+  }
+  // counted down JOINED, so opening and closing leaves it as it was however often participants come and go
+  struct sembuf ops[2] = {{LIVE, -1, SEM_UNDO}, {JOINED, -1, 0}};
+  set->op(ops, 2);
+  set->close();
+  delete set;
+  set = nullptr;
+}
+
+Barrier::~Barrier() {
+  if (!set) {
+    return;
+  }
+  try {
+    // a close that is not counted would look like a participant that died
+    close();
+  } catch (...) {
+    // Destructor should never throw - silently ignore cleanup errors
+  }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "semaphore-set.h"
+#include "token.h"
+
+// A cyclic barrier for parties processes, shared by its key: each generation opens once parties arrivals have been
+// made, and the barrier is then ready for the next generation without a reset.
+//
+// Each generation counts arrivals down on one of three counters, and waiters wait for it to reach zero. The last
+// arrival moves the generation on and re-arms the counter of the generation before, in the same atomic semop, so a
+// waiter that has not yet been scheduled still finds its counter at zero.
+//
+// Participants hold a SEM_UNDO reference while open. A participant that exits without closing breaks the barrier, as
+// does a wait that times out, and every waiter then throws: EOWNERDEAD for a death, ETIMEDOUT for a timeout. A broken
+// barrier stays broken until reset().
+
+class Barrier {
+  SemaphoreSet *set;
+
+  Barrier(SemaphoreSet *s) : set(s){};
+  void join();
+  void breakWith(int reason);
+  int brokenReason();
+  void throwIfBroken();
+
+public:
+  static Barrier *createExclusive(Token &key, int mode, unsigned parties);
+  static Barrier *create(Token &key, int mode, unsigned parties);
+  static Barrier *open(Token &key);
+  static void unlink(Token &key);
+
+  // arrive and wait for the generation to open
+  void wait();
+  bool timedwait(unsigned milliseconds);
+
+  // arrive without waiting, returning the generation to pass to passed() or timedwaitFor()
+  unsigned arrive();
+  bool passed(unsigned generation);
+  bool timedwaitFor(unsigned generation, unsigned milliseconds);
+
+  unsigned parties();
+  // the number of arrivals made in the current generation
+  unsigned arrived();
+  bool isBroken();
+  // repairs a broken barrier and starts a new generation; only when no participant is waiting
+  void reset();
+  unsigned refs();
+  void close();
+
+  ~Barrier();
+};
@@ -0,0 +1,184 @@
+#include "barrier.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class BarrierKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+  std::vector<int> private_sets;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'b');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    for (int set : private_sets) {
+      semctl(set, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  int privateSet(int nsems) {
+    int semid = semget(IPC_PRIVATE, nsems, 0600);
+    if (semid != -1) {
+      private_sets.push_back(semid);
+    }
+    return semid;
+  }
+
+  static int join(pid_t pid) {
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  }
+};
+
+TEST_F(BarrierKernelTest, NoPartyStartsAPhaseBeforeEveryPartyFinishedTheLast) {
+  const int parties = 4;
+  const int phases = 50;
+  Barrier *barrier = Barrier::createExclusive(*key, 0600, parties);
+  int finished = privateSet(1); // the number of phases finished, summed over the parties
+  ASSERT_NE(finished, -1);
+
+  std::vector<pid_t> pids;
+  for (int i = 0; i < parties - 1; i++) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      int status = 0;
+      try {
+        Barrier *mine = Barrier::open(*key);
+        for (int phase = 0; phase < phases; phase++) {
+          struct sembuf done = {0, 1, 0};
+          semop(finished, &done, 1);
+          mine->wait();
+          if (semctl(finished, 0, GETVAL) < parties * (phase + 1)) {
+            status = 2;
+          }
+        }
+        mine->close();
+        delete mine;
+      } catch (...) {
+        status = 1;
+      }
+      _exit(status);
+    }
+    pids.push_back(pid);
+  }
+
+  for (int phase = 0; phase < phases; phase++) {
+    struct sembuf done = {0, 1, 0};
+    semop(finished, &done, 1);
+    ASSERT_TRUE(barrier->timedwait(5000)) << "phase " << phase;
+    EXPECT_GE(semctl(finished, 0, GETVAL), parties * (phase + 1));
+  }
+  for (pid_t pid : pids) {
+    EXPECT_EQ(join(pid), 0);
+  }
+  EXPECT_FALSE(barrier->isBroken());
+  EXPECT_EQ(barrier->arrived(), 0u);
+
+  delete barrier;
+}
+
+TEST_F(BarrierKernelTest, APartyThatExitsWithoutClosingBreaksIt) {
+  Barrier *barrier = Barrier::createExclusive(*key, 0600, 3);
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    Barrier::open(*key);
+    _exit(0);
+  }
+  join(pid);
+
+  auto start = std::chrono::steady_clock::now();
+  try {
+    barrier->timedwait(5000);
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EOWNERDEAD);
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+  EXPECT_TRUE(barrier->isBroken());
+
+  barrier->reset();
+  EXPECT_FALSE(barrier->isBroken());
+
+  delete barrier;
+}
+
+TEST_F(BarrierKernelTest, ParticipantsCanComeAndGoMoreTimesThanASemaphoreCounts) {
+  Barrier *barrier = Barrier::createExclusive(*key, 0600, 2);
+
+  for (int i = 0; i < 40000; i++) {
+    delete Barrier::open(*key);
+  }
+  EXPECT_FALSE(barrier->isBroken());
+  Barrier *other = Barrier::open(*key);
+  std::thread party([&] { other->wait(); });
+  barrier->wait();
+  party.join();
+
+  delete other;
+  delete barrier;
+}
+
+TEST_F(BarrierKernelTest, ATimeoutBreaksItForEveryParty) {
+  Barrier *barrier = Barrier::createExclusive(*key, 0600, 2);
+  Barrier *other = Barrier::open(*key);
+
+  EXPECT_FALSE(barrier->timedwait(30));
+  EXPECT_TRUE(other->isBroken());
+  try {
+    other->wait();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), ETIMEDOUT);
+  }
+
+  barrier->reset();
+  std::thread party([&] { other->wait(); });
+  barrier->wait();
+  party.join();
+
+  delete other;
+  delete barrier;
+}
+
+TEST_F(BarrierKernelTest, ArrivalCanBeSplitFromWaiting) {
+  Barrier *barrier = Barrier::createExclusive(*key, 0600, 2);
+  Barrier *other = Barrier::open(*key);
+
+  unsigned generation = barrier->arrive();
+  EXPECT_EQ(barrier->arrived(), 1u);
+  EXPECT_FALSE(barrier->passed(generation));
+  EXPECT_EQ(other->arrive(), generation);
+  EXPECT_TRUE(barrier->passed(generation));
+  EXPECT_TRUE(other->timedwaitFor(generation, 10));
+
+  // the next generation uses the next counter
+  unsigned next = barrier->arrive();
+  EXPECT_NE(next, generation);
+  EXPECT_FALSE(barrier->passed(next));
+  other->arrive();
+  EXPECT_TRUE(barrier->passed(next));
+
+  delete other;
+  delete barrier;
+}
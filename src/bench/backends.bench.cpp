@@ -0,0 +1,137 @@
+#include "semaphore-eventfd.h"
+#include "semaphore-futex.h"
+#include "semaphore-posix.h"
+#include "semaphore-sysv.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+// Compares the semaphore backends on the same workloads against the real kernel:
+//
+//   uncontended  one thread doing trywait/post pairs on a semaphore nobody else uses
+//   ping-pong    two threads handing a unit back and forth through a pair of semaphores, so every wait blocks
+//
+//   semaphore_bench [iterations]
+
+struct Backend {
+  const char *name;
+  std::function<void()> wait;
+  std::function<bool()> trywait;
+  std::function<void()> post;
+};
+
+struct Pair {
+  Backend ping;
+  Backend pong;
+};
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void uncontended(const Backend &backend, long iterations) {
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; i++) {
+    backend.trywait();
+    backend.post();
+  }
+  double elapsed = seconds(start);
+  printf("%-10s uncontended  %10.0f ns/op\n", backend.name, elapsed * 1e9 / (iterations * 2));
+}
+
+static void pingPong(const Pair &pair, long iterations) {
+  auto start = std::chrono::steady_clock::now();
+  std::thread other([&] {
+    for (long i = 0; i < iterations; i++) {
+      pair.ping.wait();
+      pair.pong.post();
+    }
+  });
+  for (long i = 0; i < iterations; i++) {
+    pair.ping.post();
+    pair.pong.wait();
+  }
+  other.join();
+  double elapsed = seconds(start);
+  printf("%-10s ping-pong    %10.0f ns/handoff\n", pair.ping.name, elapsed * 1e9 / (iterations * 2));
+}
+
+static Backend sysv(SemaphoreV *sem) {
+  return {"sysv", [sem] { sem->wait(); }, [sem] { return sem->trywait(); }, [sem] { sem->post(); }};
+}
+
+static Backend posix(SemaphoreP *sem) {
+  return {"posix", [sem] { sem->wait(); }, [sem] { return sem->trywait(); }, [sem] { sem->post(); }};
+}
+
+static Backend futex(SemaphoreF *sem) {
+  return {"futex", [sem] { sem->wait(); }, [sem] { return sem->trywait(); }, [sem] { sem->post(); }};
+}
+
+static Backend eventfd(SemaphoreE *sem) {
+  return {"eventfd", [sem] { sem->wait(); }, [sem] { return sem->trywait(); }, [sem] { sem->post(); }};
+}
+
+int main(int argc, char **argv) {
+  long iterations = argc > 1 ? atol(argv[1]) : 100000;
+
+  char path[] = "/tmp/semaphore-bench-XXXXXX";
+  int fd = mkstemp(path);
+  if (fd == -1) {
+    perror("mkstemp");
+    return 1;
+  }
+  close(fd);
+
+  int status = 0;
+  try {
+    Token ping(path, 'p');
+    Token pong(path, 'q');
+    SemaphoreV *sysvPing = SemaphoreV::createExclusive(ping, 0600, 1);
+    SemaphoreV *sysvPong = SemaphoreV::createExclusive(pong, 0600, 0);
+    uncontended(sysv(sysvPing), iterations);
+    sysvPing->wait();
+    pingPong({sysv(sysvPing), sysv(sysvPong)}, iterations);
+    delete sysvPing;
+    delete sysvPong;
+
+    SemaphoreP *posixPing = SemaphoreP::createExclusive(ping, 0600, 1);
+    SemaphoreP *posixPong = SemaphoreP::createExclusive(pong, 0600, 0);
+    uncontended(posix(posixPing), iterations);
+    posixPing->wait();
+    pingPong({posix(posixPing), posix(posixPong)}, iterations);
+    delete posixPing;
+    delete posixPong;
+
+    SemaphoreF *futexPing = SemaphoreF::createExclusive(ping, 0600, 1);
+    SemaphoreF *futexPong = SemaphoreF::createExclusive(pong, 0600, 0);
+    uncontended(futex(futexPing), iterations);
+    futexPing->wait();
+    pingPong({futex(futexPing), futex(futexPong)}, iterations);
+    delete futexPing;
+    delete futexPong;
+
+    try {
+      SemaphoreE *eventfdPing = SemaphoreE::create(1);
+      SemaphoreE *eventfdPong = SemaphoreE::create(0);
+      uncontended(eventfd(eventfdPing), iterations);
+      eventfdPing->wait();
+      pingPong({eventfd(eventfdPing), eventfd(eventfdPong)}, iterations);
+      delete eventfdPing;
+      delete eventfdPong;
+    } catch (std::system_error &e) {
+      printf("%-10s unavailable: %s\n", "eventfd", e.what());
+    }
+  } catch (std::system_error &e) {
+    fprintf(stderr, "semaphore_bench: %s\n", e.what());
+    status = 1;
+  }
+
+  unlink(path);
+  return status;
+}
@@ -0,0 +1,117 @@
+#include "condition.h"
+
+#include <cerrno>
+#include <system_error>
+
+#define MUTEX 0
+#define WAITERS 1
+#define WAKE 2
+#define SLOTS 3
+
+Condition *Condition::createExclusive(Token &key, int mode) {
+  int values[SLOTS] = {1, 0, 0};
+  return new Condition(SemaphoreSet::createExclusive(key, mode, SLOTS, values));
+}
+
+Condition *Condition::create(Token &key, int mode) {
+  int values[SLOTS] = {1, 0, 0};
+  return new Condition(SemaphoreSet::create(key, mode, SLOTS, values));
+}
+
+Condition *Condition::open(Token &key) { return new Condition(SemaphoreSet::open(key, SLOTS)); }
+
+void Condition::unlink(Token &key) { SemaphoreSet::unlink(key); }
+
+void Condition::lock() {
+  struct sembuf op = {MUTEX, -1, SEM_UNDO};
+  set->op(&op, 1);
+}
+
+bool Condition::trylock() {
+  struct sembuf op = {MUTEX, -1, SEM_UNDO};
+  return set->tryop(&op, 1);
+}
+
+// unlocking a mutex that is not held would let two holders in, so it fails instead
+void Condition::unlock() {
+  struct sembuf ops[2] = {{MUTEX, 0, 0}, {MUTEX, 1, SEM_UNDO}};
+  if (!set->tryop(ops, 2)) {
+    throw std::system_error(EPERM, std::system_category(), "semop");
+  }
+}
+
+// releasing the mutex and registering as a waiter together
+#define RELEASE {{MUTEX, 0, 0}, {MUTEX, 1, SEM_UNDO}, {WAITERS, 1, SEM_UNDO}}
+// taking a wake token and deregistering together
+#define WOKEN {{WAKE, -1, 0}, {WAITERS, -1, SEM_UNDO}}
+
+void Condition::wait() {
+  struct sembuf release[3] = RELEASE;
+  if (!set->tryop(release, 3)) {
+    throw std::system_error(EPERM, std::system_category(), "semop");
+  }
+  struct sembuf woken[2] = WOKEN;
+  try {
+    set->op(woken, 2);
+  } catch (...) {
+    struct sembuf deregister = {WAITERS, -1, SEM_UNDO};
+    set->tryop(&deregister, 1);
+    lock();
+    throw;
+  }
+  lock();
+}
+
+bool Condition::timedwait(unsigned milliseconds) {
+  struct sembuf release[3] = RELEASE;
+  if (!set->tryop(release, 3)) {
+    throw std::system_error(EPERM, std::system_category(), "semop");
+  }
+  struct sembuf woken[2] = WOKEN;
+  bool notified = false;
+  try {
+    notified = set->timedop(woken, 2, milliseconds);
+  } catch (...) {
+    struct sembuf deregister = {WAITERS, -1, SEM_UNDO};
+    set->tryop(&deregister, 1);
+    lock();
+    throw;
+  }
+  if (!notified) {
+    // a notifier that counted this waiter before it gave up leaves a token behind, waking a later waiter spuriously
+    struct sembuf deregister = {WAITERS, -1, SEM_UNDO};
+    set->op(&deregister, 1);
+  }
+  lock();
+  return notified;
+}
+
+// the waiters registered that no token has been posted for yet
+static int unwoken(SemaphoreSet *set) {
+  unsigned short values[SLOTS + 1];
+  set->getAll(values);
+  return values[WAITERS] > values[WAKE] ? values[WAITERS] - values[WAKE] : 0;
+}
+
+void Condition::notifyOne() {
+  if (unwoken(set) > 0) {
+    struct sembuf op = {WAKE, 1, 0};
+    set->op(&op, 1);
+  }
+}
+
+void Condition::notifyAll() {
+  int count = unwoken(set);
+  if (count > 0) {
+    struct sembuf op = {WAKE, (short)count, 0};
+    set->op(&op, 1);
+  }
+}
+
+unsigned Condition::waiters() { return set->waitingToDecrement(WAKE); }
+
+unsigned Condition::refs() { return set->refs(); }
+
+void Condition::close() { set->close(); }
+
+Condition::~Condition() { delete set; }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "semaphore-set.h"
+#include "token.h"
+
+// A condition variable shared between processes by its key, together with the mutex that guards its predicate. lock()
+// and unlock() are the mutex; wait() releases it, sleeps until notified, and takes it again before returning.
+//
+// A waiter registers in the same atomic semop that releases the mutex, so a notifier holding the mutex sees every
+// waiter that has let go of it, and notifyAll() wakes exactly the waiters registered when it is called. Waking takes a
+// token and deregisters in one semop too. Notifying without holding the mutex is allowed, but may then cause spurious
+// wakeups later, which wait() callers have to allow for anyway. The mutex and the registrations are SEM_UNDO, so a
+// process that exits while holding the mutex or waiting releases both.
+
+class Condition {
+  SemaphoreSet *set;
+
+  Condition(SemaphoreSet *s) : set(s){};
+
+public:
+  static Condition *createExclusive(Token &key, int mode);
+  static Condition *create(Token &key, int mode);
+  static Condition *open(Token &key);
+  static void unlink(Token &key);
+
+  void lock();
+  bool trylock();
+  void unlock();
+
+  // the mutex must be held, and is held again on return
+  void wait();
+  // false if not notified within milliseconds, still holding the mutex again on return
+  bool timedwait(unsigned milliseconds);
+  void notifyOne();
+  void notifyAll();
+
+  // the number of processes and threads asleep in wait()
+  unsigned waiters();
+  unsigned refs();
+  void close();
+
+  ~Condition();
+};
@@ -0,0 +1,164 @@
+#include "condition.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class ConditionKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'c');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  bool waitFor(std::function<bool()> condition) {
+    for (int i = 0; i < 5000; i++) {
+      if (condition()) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+  }
+};
+
+TEST_F(ConditionKernelTest, TheMutexExcludesAndRefusesAnUnheldUnlock) {
+  Condition *condition = Condition::createExclusive(*key, 0600);
+
+  condition->lock();
+  EXPECT_FALSE(condition->trylock());
+  condition->unlock();
+  EXPECT_TRUE(condition->trylock());
+  condition->unlock();
+  try {
+    condition->unlock();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EPERM);
+  }
+
+  delete condition;
+}
+
+TEST_F(ConditionKernelTest, TimedWaitGivesUpAndHoldsTheMutexAgain) {
+  Condition *condition = Condition::createExclusive(*key, 0600);
+
+  condition->lock();
+  EXPECT_FALSE(condition->timedwait(10));
+  EXPECT_FALSE(condition->trylock());
+  condition->unlock();
+  EXPECT_EQ(condition->waiters(), 0u);
+
+  delete condition;
+}
+
+TEST_F(ConditionKernelTest, NotifyOneWakesOneWaiter) {
+  Condition *condition = Condition::createExclusive(*key, 0600);
+  std::atomic<int> woken(0);
+  std::vector<std::thread> waiters;
+
+  for (int i = 0; i < 2; i++) {
+    waiters.emplace_back([&] {
+      condition->lock();
+      condition->wait();
+      woken++;
+      condition->unlock();
+    });
+  }
+  ASSERT_TRUE(waitFor([&] { return condition->waiters() == 2; }));
+  condition->lock();
+  condition->notifyOne();
+  condition->unlock();
+  ASSERT_TRUE(waitFor([&] { return woken == 1; }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(woken, 1);
+  EXPECT_EQ(condition->waiters(), 1u);
+
+  condition->lock();
+  condition->notifyOne();
+  condition->unlock();
+  for (auto &waiter : waiters) {
+    waiter.join();
+  }
+  EXPECT_EQ(woken, 2);
+
+  delete condition;
+}
+
+TEST_F(ConditionKernelTest, NotifyAllWakesExactlyTheCurrentWaiters) {
+  Condition *condition = Condition::createExclusive(*key, 0600);
+  std::atomic<int> woken(0);
+  std::vector<std::thread> waiters;
+
+  for (int i = 0; i < 3; i++) {
+    waiters.emplace_back([&] {
+      condition->lock();
+      condition->wait();
+      woken++;
+      condition->unlock();
+    });
+  }
+  ASSERT_TRUE(waitFor([&] { return condition->waiters() == 3; }));
+  condition->lock();
+  condition->notifyAll();
+  condition->notifyAll();
+  condition->unlock();
+  for (auto &waiter : waiters) {
+    waiter.join();
+  }
+  EXPECT_EQ(woken, 3);
+
+  // no tokens were left behind for a later waiter
+  condition->lock();
+  EXPECT_FALSE(condition->timedwait(10));
+  condition->unlock();
+
+  delete condition;
+}
+
+TEST_F(ConditionKernelTest, AWaiterInAnotherProcessIsNotified) {
+  Condition *condition = Condition::createExclusive(*key, 0600);
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    Condition *child = Condition::open(*key);
+    child->lock();
+    child->wait();
+    child->unlock();
+    delete child;
+    _exit(0);
+  }
+  ASSERT_TRUE(waitFor([&] { return condition->waiters() == 1; }));
+  condition->lock();
+  condition->notifyAll();
+  condition->unlock();
+  int status;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_EQ(condition->refs(), 1u);
+
+  delete condition;
+}
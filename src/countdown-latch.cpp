@@ -0,0 +1,58 @@
+#include "countdown-latch.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+
+#define COUNT 0
+#define SLOTS 1
+
+CountdownLatch *CountdownLatch::createExclusive(Token &key, int mode, unsigned count) {
+  int values[SLOTS] = {(int)count};
+  return new CountdownLatch(SemaphoreSet::createExclusive(key, mode, SLOTS, values));
+}
+
+CountdownLatch *CountdownLatch::create(Token &key, int mode, unsigned count) {
+  int values[SLOTS] = {(int)count};
+  return new CountdownLatch(SemaphoreSet::create(key, mode, SLOTS, values));
+}
+
+CountdownLatch *CountdownLatch::open(Token &key) { return new CountdownLatch(SemaphoreSet::open(key, SLOTS)); }
+
+void CountdownLatch::unlink(Token &key) { SemaphoreSet::unlink(key); }
+
+void CountdownLatch::countDown() { countDown(1); }
+
+void CountdownLatch::countDown(unsigned value) {
+  struct sembuf op = {COUNT, (short)-std::min(value, 32767u), 0};
+  // the kernel would block a decrement below zero, so take what is left when there is less than value
+  while (!set->tryop(&op, 1)) {
+    op.sem_op = -std::min(value, set->get(COUNT));
+    if (op.sem_op == 0) {
+      return;
+    }
+  }
+}
+
+void CountdownLatch::wait() {
+  struct sembuf op = {COUNT, 0, 0};
+  set->op(&op, 1);
+}
+
+bool CountdownLatch::trywait() {
+  struct sembuf op = {COUNT, 0, 0};
+  return set->tryop(&op, 1);
+}
+
+bool CountdownLatch::timedwait(unsigned milliseconds) {
+  struct sembuf op = {COUNT, 0, 0};
+  return set->timedop(&op, 1, milliseconds);
+}
+
+unsigned CountdownLatch::count() { return set->get(COUNT); }
+
+unsigned CountdownLatch::refs() { return set->refs(); }
+
+void CountdownLatch::close() { set->close(); }
+
+CountdownLatch::~CountdownLatch() { delete set; }
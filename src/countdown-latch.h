@@ -0,0 +1,34 @@
+#pragma once
+
+#include "semaphore-set.h"
+#include "token.h"
+
+// A latch that opens once it has been counted down to zero, shared between processes by its key. Waiting is the
+// kernel's wait-for-zero, so waiters sleep until the last count down rather than polling the count.
+//
+// Counting down is not SEM_UNDO: a worker that counts down and then exits stays counted. A latch cannot be reset;
+// unlink it and create another.
+
+class CountdownLatch {
+  SemaphoreSet *set;
+
+  CountdownLatch(SemaphoreSet *s) : set(s){};
+
+public:
+  static CountdownLatch *createExclusive(Token &key, int mode, unsigned count);
+  static CountdownLatch *create(Token &key, int mode, unsigned count);
+  static CountdownLatch *open(Token &key);
+  static void unlink(Token &key);
+
+  void countDown();
+  // counts down by value, stopping at zero
+  void countDown(unsigned value);
+  void wait();
+  bool trywait();
+  bool timedwait(unsigned milliseconds);
+  unsigned count();
+  unsigned refs();
+  void close();
+
+  ~CountdownLatch();
+};
@@ -0,0 +1,97 @@
+#include "countdown-latch.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class CountdownLatchKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'l');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+};
+
+TEST_F(CountdownLatchKernelTest, OpensWhenEveryWorkerHasCountedDown) {
+  CountdownLatch *latch = CountdownLatch::createExclusive(*key, 0600, 3);
+  std::vector<pid_t> workers;
+  for (int i = 0; i < 3; i++) {
+    pid_t worker = fork();
+    if (worker == 0) {
+      CountdownLatch *mine = CountdownLatch::open(*key);
+      mine->countDown();
+      _exit(0); // exiting without closing does not give the count back
+    }
+    workers.push_back(worker);
+  }
+
+  EXPECT_TRUE(latch->timedwait(5000));
+  EXPECT_EQ(latch->count(), 0u);
+  for (pid_t worker : workers) {
+    waitpid(worker, nullptr, 0);
+  }
+  EXPECT_EQ(latch->refs(), 1u);
+
+  delete latch;
+}
+
+TEST_F(CountdownLatchKernelTest, WaitersSleepUntilTheLastCountDown) {
+  CountdownLatch *latch = CountdownLatch::createExclusive(*key, 0600, 2);
+  std::atomic<bool> opened(false);
+
+  std::thread waiter([&] {
+    latch->wait();
+    opened = true;
+  });
+  latch->countDown();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(opened);
+  latch->countDown();
+  waiter.join();
+  EXPECT_TRUE(opened);
+
+  delete latch;
+}
+
+TEST_F(CountdownLatchKernelTest, TimedWaitTimesOutWhileCountsRemain) {
+  CountdownLatch *latch = CountdownLatch::createExclusive(*key, 0600, 1);
+
+  EXPECT_FALSE(latch->trywait());
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(latch->timedwait(30));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(25));
+
+  delete latch;
+}
+
+TEST_F(CountdownLatchKernelTest, CountDownStopsAtZero) {
+  CountdownLatch *latch = CountdownLatch::createExclusive(*key, 0600, 2);
+
+  latch->countDown(5);
+  EXPECT_EQ(latch->count(), 0u);
+  latch->countDown();
+  EXPECT_TRUE(latch->trywait());
+
+  delete latch;
+}
@@ -3,7 +3,7 @@
 #include <errnoname.h>
 #include <string>
 
-void throwJavaScriptError(std::system_error &e, Napi::Env env) {
+Napi::Error javaScriptError(std::system_error &e, Napi::Env env) {
   const int code = e.code().value();
   std::string what = e.what();
   std::string syscall = what.substr(0, what.find(':'));
@@ -15,5 +15,7 @@ void throwJavaScriptError(std::system_error &e, Napi::Env env) {
   jsError.Set("errno", Napi::Number::New(env, code));
   jsError.Set("code", Napi::String::New(env, errnoname(code)));
   jsError.Set("syscall", Napi::String::New(env, syscall));
-  jsError.ThrowAsJavaScriptException();
+  return jsError;
 }
+
+void throwJavaScriptError(std::system_error &e, Napi::Env env) { javaScriptError(e, env).ThrowAsJavaScriptException(); }
@@ -1,4 +1,5 @@
 #include <napi.h>
 #include <system_error>
 
+Napi::Error javaScriptError(std::system_error &e, Napi::Env env);
 void throwJavaScriptError(std::system_error &e, Napi::Env env);
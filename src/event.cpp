@@ -0,0 +1,61 @@
+#include "event.h"
+
+#include <cerrno>
+#include <system_error>
+
+#define GATE 0
+#define SLOTS 1
+
+// the gate is open at zero
+#define UNSET 1
+
+Event *Event::createExclusive(Token &key, int mode, bool initiallySet) {
+  int values[SLOTS] = {initiallySet ? 0 : UNSET};
+  return new Event(SemaphoreSet::createExclusive(key, mode, SLOTS, values));
+}
+
+Event *Event::create(Token &key, int mode, bool initiallySet) {
+  int values[SLOTS] = {initiallySet ? 0 : UNSET};
+  return new Event(SemaphoreSet::create(key, mode, SLOTS, values));
+}
+
+Event *Event::open(Token &key) { return new Event(SemaphoreSet::open(key, SLOTS)); }
+
+void Event::unlink(Token &key) { SemaphoreSet::unlink(key); }
+
+// setting an event that is already set leaves it set
+void Event::set() {
+  struct sembuf op = {GATE, -1, 0};
+  sems->tryop(&op, 1);
+}
+
+// resetting an event that is already reset leaves it reset
+void Event::reset() {
+  struct sembuf ops[2] = {{GATE, 0, 0}, {GATE, UNSET, 0}};
+  sems->tryop(ops, 2);
+}
+
+bool Event::isSet() { return sems->get(GATE) == 0; }
+
+void Event::wait() {
+  struct sembuf op = {GATE, 0, 0};
+  sems->op(&op, 1);
+}
+
+bool Event::trywait() {
+  struct sembuf op = {GATE, 0, 0};
+  return sems->tryop(&op, 1);
+}
+
+bool Event::timedwait(unsigned milliseconds) {
+  struct sembuf op = {GATE, 0, 0};
+  return sems->timedop(&op, 1, milliseconds);
+}
+
+unsigned Event::waiters() { return sems->waitingForZero(GATE); }
+
+unsigned Event::refs() { return sems->refs(); }
+
+void Event::close() { sems->close(); }
+
+Event::~Event() { delete sems; }
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "semaphore-set.h"
+#include "token.h"
+
+// A manual-reset event shared between processes by its key. While it is set, wait() returns straight away; while it is
+// reset, waiters sleep in the kernel until set() releases every one of them at once.
+//
+// The event is a gate that is open at zero, and waiting is the kernel's wait-for-zero, so a waiter is woken as soon as
+// the gate opens rather than on a poll interval. The kernel completes every waiter's wait when the gate reaches zero,
+// so a reset() straight after set() still releases all of the waiters that were queued.
+
+class Event {
+  SemaphoreSet *sems;
+
+  Event(SemaphoreSet *s) : sems(s){};
+
+public:
+  static Event *createExclusive(Token &key, int mode, bool initiallySet);
+  static Event *create(Token &key, int mode, bool initiallySet);
+  static Event *open(Token &key);
+  static void unlink(Token &key);
+
+  void set();
+  void reset();
+  bool isSet();
+  void wait();
+  bool trywait();
+  bool timedwait(unsigned milliseconds);
+  // the number of processes and threads waiting for the event to be set
+  unsigned waiters();
+  unsigned refs();
+  void close();
+
+  ~Event();
+};
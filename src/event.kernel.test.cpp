@@ -0,0 +1,130 @@
+#include "event.h"
+#include "semaphore-sysv.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class EventKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'e');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  bool waitFor(std::function<bool()> condition) {
+    for (int i = 0; i < 5000; i++) {
+      if (condition()) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+  }
+};
+
+TEST_F(EventKernelTest, SetAndResetAreIdempotent) {
+  Event *event = Event::createExclusive(*key, 0600, false);
+
+  EXPECT_FALSE(event->isSet());
+  EXPECT_FALSE(event->trywait());
+  EXPECT_FALSE(event->timedwait(10));
+  event->set();
+  event->set();
+  EXPECT_TRUE(event->isSet());
+  EXPECT_TRUE(event->trywait());
+  EXPECT_TRUE(event->trywait());
+  event->reset();
+  event->reset();
+  EXPECT_FALSE(event->isSet());
+  EXPECT_FALSE(event->trywait());
+
+  delete event;
+}
+
+TEST_F(EventKernelTest, CreatedSetWhenAsked) {
+  Event *event = Event::createExclusive(*key, 0600, true);
+
+  EXPECT_TRUE(event->isSet());
+  EXPECT_TRUE(event->timedwait(10));
+
+  delete event;
+}
+
+TEST_F(EventKernelTest, SetReleasesEveryWaiterEvenWhenResetStraightAway) {
+  Event *event = Event::createExclusive(*key, 0600, false);
+  std::atomic<int> released(0);
+  std::vector<std::thread> waiters;
+
+  for (int i = 0; i < 4; i++) {
+    waiters.emplace_back([&] {
+      event->wait();
+      released++;
+    });
+  }
+  ASSERT_TRUE(waitFor([&] { return event->waiters() == 4; }));
+  EXPECT_EQ(released, 0);
+  event->set();
+  event->reset();
+  for (auto &waiter : waiters) {
+    waiter.join();
+  }
+  EXPECT_EQ(released, 4);
+  EXPECT_EQ(event->waiters(), 0u);
+  EXPECT_FALSE(event->isSet());
+
+  delete event;
+}
+
+TEST_F(EventKernelTest, SetInOneProcessReleasesAnother) {
+  Event *event = Event::createExclusive(*key, 0600, false);
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    Event *child = Event::open(*key);
+    child->wait();
+    delete child;
+    _exit(0);
+  }
+  ASSERT_TRUE(waitFor([&] { return event->waiters() == 1; }));
+  event->set();
+  int status;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_EQ(event->refs(), 1u);
+
+  delete event;
+}
+
+// an unset event has the two semaphores of a SemaphoreV and nothing in its slot, so only its creator's reference keeps
+// the reaper from taking it for an orphan
+TEST_F(EventKernelTest, TheReaperLeavesAnUnsetEventWhoseCreatorIsAlive) {
+  Event *event = Event::createExclusive(*key, 0600, false);
+
+  EXPECT_EQ(event->refs(), 1u);
+  EXPECT_FALSE(SemaphoreV::reap(*key, 0));
+  EXPECT_FALSE(event->isSet());
+
+  delete event;
+}
@@ -1,6 +1,8 @@
 /* ----------------------------------------------------------------------------
- * This file was automatically generated by SWIG (https://www.swig.org).
- * Version 4.2.1
+ * The runtime in this file is the output of SWIG 4.2.1 (https://www.swig.org).
+ * The wrappers for the classes in src/main.i were written without swig in the
+ * shape of its -javascript -napi output, and have not been checked against it.
+ * Run npm run swig to replace the whole file with real SWIG output.
  *
  * Do not make changes to this file unless you know what you are doing - modify
  * the SWIG interface file instead.
@@ -1237,12 +1239,30 @@ Napi::Value SWIG_NAPI_AppendOutput(Napi::Env env, Napi::Value result, Napi::Valu
 
 /* -------- TYPES TABLE (BEGIN) -------- */
 
-#define SWIGTYPE_p_SemaphoreV swig_types[0]
-#define SWIGTYPE_p_Token swig_types[1]
-#define SWIGTYPE_p_char swig_types[2]
-#define SWIGTYPE_p_key_t swig_types[3]
-static swig_type_info *swig_types[5];
-static swig_module_info swig_module = {swig_types, 4, 0, 0, 0, 0};
+#define SWIGTYPE_p_Barrier swig_types[0]
+#define SWIGTYPE_p_Condition swig_types[1]
+#define SWIGTYPE_p_CountdownLatch swig_types[2]
+#define SWIGTYPE_p_Event swig_types[3]
+#define SWIGTYPE_p_NamedSemaphore swig_types[4]
+#define SWIGTYPE_p_RecursiveMutex swig_types[5]
+#define SWIGTYPE_p_RwLock swig_types[6]
+#define SWIGTYPE_p_SemaphoreArray swig_types[7]
+#define SWIGTYPE_p_SemaphoreE swig_types[8]
+#define SWIGTYPE_p_SemaphoreF swig_types[9]
+#define SWIGTYPE_p_SemaphoreLimits swig_types[10]
+#define SWIGTYPE_p_SemaphoreNamespace swig_types[11]
+#define SWIGTYPE_p_SemaphoreP swig_types[12]
+#define SWIGTYPE_p_SemaphoreSetInfo swig_types[13]
+#define SWIGTYPE_p_SemaphoreSharded swig_types[14]
+#define SWIGTYPE_p_SemaphoreV swig_types[15]
+#define SWIGTYPE_p_Token swig_types[16]
+#define SWIGTYPE_p_char swig_types[17]
+#define SWIGTYPE_p_key_t swig_types[18]
+#define SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t swig_types[19]
+#define SWIGTYPE_p_std__vectorT_SemaphoreV_p_t swig_types[20]
+#define SWIGTYPE_p_std__vectorT_unsigned_short_t swig_types[21]
+static swig_type_info *swig_types[23];
+static swig_module_info swig_module = {swig_types, 22, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -1322,14 +1342,33 @@ template <typename T> T SwigValueInit() { return T(); }
 #include <assert.h>
 
 #define NAPI_ENABLE_CPP_EXCEPTIONS
+#include "barrier.h"
+#include "condition.h"
+#include "countdown-latch.h"
 #include "error.h"
+#include "event.h"
+#include "recursive-mutex.h"
+#include "rwlock.h"
+#include "semaphore-array.h"
+#include "semaphore-eventfd.h"
+#include "semaphore-futex.h"
+#include "semaphore-limits.h"
+#include "semaphore-list.h"
+#include "semaphore-namespace.h"
+#include "semaphore-posix.h"
+#include "semaphore-sharded.h"
 #include "semaphore-sysv.h"
+#include "wait-async.h"
 
 #include <errnoname.c>
 #include <napi.h>
 #include <string>
 #include <system_error>
 
+#include <string>
+
+#include <vector>
+
 SWIGINTERN swig_type_info *SWIG_pchar_descriptor(void) {
   static int init = 0;
   static swig_type_info *info = 0;
@@ -1552,6 +1591,245 @@ Napi::Value SWIG_From_bool(Napi::Env env, bool val) { return Napi::Boolean::New(
 SWIGINTERN
 Napi::Value SWIG_From_unsigned_SS_int(Napi::Env env, unsigned int val) { return Napi::Number::New(env, val); }
 
+SWIGINTERN
+int SWIG_AsVal_bool(Napi::Value obj, bool *val) {
+  if (!obj.IsBoolean()) {
+    return SWIG_TypeError;
+  }
+
+  Napi::Boolean b;
+  NAPI_CHECK_RESULT(obj.ToBoolean(), b);
+  if (val)
+    *val = b.Value();
+
+  return SWIG_OK;
+  goto fail;
+fail:
+  return SWIG_ERROR;
+}
+
+#if defined(LLONG_MAX) && !defined(SWIG_LONG_LONG_AVAILABLE)
+#define SWIG_LONG_LONG_AVAILABLE
+#endif
+
+#ifdef SWIG_LONG_LONG_AVAILABLE
+SWIGINTERN
+int SWIG_AsVal_long_SS_long(Napi::Value obj, long long *val) {
+  if (!obj.IsNumber()) {
+    return SWIG_TypeError;
+  }
+  if (val) {
+    Napi::Number num;
+    NAPI_CHECK_RESULT(obj.ToNumber(), num);
+    *val = static_cast<long long>(num.Int64Value());
+  }
+
+  return SWIG_OK;
+  goto fail;
+fail:
+  return SWIG_ERROR;
+}
+#endif
+
+#ifdef SWIG_LONG_LONG_AVAILABLE
+SWIGINTERNINLINE
+Napi::Value SWIG_From_long_SS_long(Napi::Env env, long long val) { return Napi::Number::New(env, val); }
+#endif
+
+SWIGINTERN
+int SWIG_AsVal_unsigned_SS_long(Napi::Value obj, unsigned long *val) {
+  if (!obj.IsNumber()) {
+    return SWIG_TypeError;
+  }
+  if (val) {
+    Napi::Number num;
+    NAPI_CHECK_RESULT(obj.ToNumber(), num);
+    if (num.Int64Value() < 0) {
+      return SWIG_TypeError;
+    }
+    *val = static_cast<unsigned long>(num.Int64Value());
+  }
+
+  return SWIG_OK;
+  goto fail;
+fail:
+  return SWIG_ERROR;
+}
+
+SWIGINTERN int SWIG_AsVal_unsigned_SS_short(Napi::Value obj, unsigned short *val) {
+  unsigned long v;
+  int res = SWIG_AsVal_unsigned_SS_long(obj, &v);
+  if (SWIG_IsOK(res)) {
+    if ((v > USHRT_MAX)) {
+      return SWIG_OverflowError;
+    } else {
+      if (val)
+        *val = static_cast<unsigned short>(v);
+    }
+  }
+  return res;
+}
+
+SWIGINTERNINLINE
+Napi::Value SWIG_From_unsigned_SS_long(Napi::Env env, unsigned long val) { return Napi::Number::New(env, val); }
+
+SWIGINTERNINLINE Napi::Value SWIG_From_unsigned_SS_short(Napi::Env env, unsigned short value) {
+  return SWIG_From_unsigned_SS_long(env, value);
+}
+
+#ifdef SWIG_LONG_LONG_AVAILABLE
+SWIGINTERN
+int SWIG_AsVal_unsigned_SS_long_SS_long(Napi::Value obj, unsigned long long *val) {
+  if (!obj.IsNumber()) {
+    return SWIG_TypeError;
+  }
+  if (val) {
+    Napi::Number num;
+    NAPI_CHECK_RESULT(obj.ToNumber(), num);
+    if (num.Int64Value() < 0) {
+      return SWIG_TypeError;
+    }
+    *val = static_cast<unsigned long long>(num.Int64Value());
+  }
+
+  return SWIG_OK;
+  goto fail;
+fail:
+  return SWIG_ERROR;
+}
+#endif
+
+SWIGINTERNINLINE int SWIG_AsVal_size_t(Napi::Value obj, size_t *val) {
+  int res = SWIG_TypeError;
+#ifdef SWIG_LONG_LONG_AVAILABLE
+  if (sizeof(size_t) <= sizeof(unsigned long)) {
+#endif
+    unsigned long v;
+    res = SWIG_AsVal_unsigned_SS_long(obj, val ? &v : 0);
+    if (SWIG_IsOK(res) && val)
+      *val = static_cast<size_t>(v);
+#ifdef SWIG_LONG_LONG_AVAILABLE
+  } else if (sizeof(size_t) <= sizeof(unsigned long long)) {
+    unsigned long long v;
+    res = SWIG_AsVal_unsigned_SS_long_SS_long(obj, val ? &v : 0);
+    if (SWIG_IsOK(res) && val)
+      *val = static_cast<size_t>(v);
+  }
+#endif
+  return res;
+}
+
+#ifdef SWIG_LONG_LONG_AVAILABLE
+SWIGINTERNINLINE
+Napi::Value SWIG_From_unsigned_SS_long_SS_long(Napi::Env env, unsigned long long val) {
+  return Napi::Number::New(env, val);
+}
+#endif
+
+SWIGINTERNINLINE Napi::Value SWIG_From_size_t(Napi::Env env, size_t value) {
+#ifdef SWIG_LONG_LONG_AVAILABLE
+  if (sizeof(size_t) <= sizeof(unsigned long)) {
+#endif
+    return SWIG_From_unsigned_SS_long(env, static_cast<unsigned long>(value));
+#ifdef SWIG_LONG_LONG_AVAILABLE
+  } else {
+    /* assume sizeof(size_t) <= sizeof(unsigned long long) */
+    return SWIG_From_unsigned_SS_long_SS_long(env, static_cast<unsigned long long>(value));
+  }
+#endif
+}
+
+SWIGINTERN std::vector<unsigned short>::value_type const &
+std_vector_Sl_unsigned_SS_short_Sg__get(std::vector<unsigned short> *self, int i) {
+  int size = int(self->size());
+  if (i >= 0 && i < size)
+    return (*self)[i];
+  else
+    throw std::out_of_range("vector index out of range");
+}
+SWIGINTERN void std_vector_Sl_unsigned_SS_short_Sg__set(std::vector<unsigned short> *self, int i,
+                                                         std::vector<unsigned short>::value_type const &val) {
+  int size = int(self->size());
+  if (i >= 0 && i < size)
+    (*self)[i] = val;
+  else
+    throw std::out_of_range("vector index out of range");
+}
+SWIGINTERN std::vector<SemaphoreSetInfo>::value_type const &
+std_vector_Sl_SemaphoreSetInfo_Sg__get(std::vector<SemaphoreSetInfo> *self, int i) {
+  int size = int(self->size());
+  if (i >= 0 && i < size)
+    return (*self)[i];
+  else
+    throw std::out_of_range("vector index out of range");
+}
+SWIGINTERN void std_vector_Sl_SemaphoreSetInfo_Sg__set(std::vector<SemaphoreSetInfo> *self, int i,
+                                                        std::vector<SemaphoreSetInfo>::value_type const &val) {
+  int size = int(self->size());
+  if (i >= 0 && i < size)
+    (*self)[i] = val;
+  else
+    throw std::out_of_range("vector index out of range");
+}
+SWIGINTERN std::vector<SemaphoreV *>::value_type const &
+std_vector_Sl_SemaphoreV_Sm__Sg__get(std::vector<SemaphoreV *> *self, int i) {
+  int size = int(self->size());
+  if (i >= 0 && i < size)
+    return (*self)[i];
+  else
+    throw std::out_of_range("vector index out of range");
+}
+SWIGINTERN void std_vector_Sl_SemaphoreV_Sm__Sg__set(std::vector<SemaphoreV *> *self, int i,
+                                                      std::vector<SemaphoreV *>::value_type const &val) {
+  int size = int(self->size());
+  if (i >= 0 && i < size)
+    (*self)[i] = val;
+  else
+    throw std::out_of_range("vector index out of range");
+}
+SWIGINTERN napi_value SemaphoreE_waitAsync__SWIG_0(SemaphoreE *self, napi_env env) { return waitAsync(env, self, 1); }
+SWIGINTERN napi_value SemaphoreE_waitAsync__SWIG_1(SemaphoreE *self, napi_env env, unsigned int value) {
+  return waitAsync(env, self, value);
+}
+SWIGINTERN void SemaphoreE_cancelAndClose(SemaphoreE *self) { cancelAndClose(self); }
+SWIGINTERN napi_value SemaphoreF_waitAsync(SemaphoreF *self, napi_env env) { return waitAsync(env, self); }
+SWIGINTERN void SemaphoreF_cancelAndClose(SemaphoreF *self) { cancelAndClose(self); }
+
+SWIGINTERN int SWIG_AsPtr_std_string(Napi::Value obj, std::string **val) {
+  char *buf = 0;
+  size_t size = 0;
+  int alloc = SWIG_OLDOBJ;
+  if (SWIG_IsOK((SWIG_AsCharPtrAndSize(obj, &buf, &size, &alloc)))) {
+    if (buf) {
+      if (val)
+        *val = new std::string(buf, size - 1);
+      if (alloc == SWIG_NEWOBJ)
+        delete[] buf;
+      return SWIG_NEWOBJ;
+    } else {
+      if (val)
+        *val = 0;
+      return SWIG_OLDOBJ;
+    }
+  } else {
+    static int init = 0;
+    static swig_type_info *descriptor = 0;
+    if (!init) {
+      descriptor = SWIG_TypeQuery("std::string"
+                                  " *");
+      init = 1;
+    }
+    if (descriptor) {
+      std::string *vptr;
+      int res = SWIG_ConvertPtr(obj, (void **)&vptr, descriptor, 0);
+      if (SWIG_IsOK(res) && val)
+        *val = vptr;
+      return res;
+    }
+  }
+  return SWIG_ERROR;
+}
+
 #define SWIG_NAPI_INIT main_initialize
 
 // jsnapi_class_prologue_template
@@ -1642,88 +1920,247 @@ void _exports_Token_inst::GetMembers(Napi::Env env,
   /* add static class functions and variables */
 }
 // jsnapi_class_prologue_template
-template <typename SWIG_OBJ_WRAP> class _exports_SemaphoreV_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+template <typename SWIG_OBJ_WRAP>
+class _exports_SemaphoreLimits_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
 public:
-  _exports_SemaphoreV_templ(const Napi::CallbackInfo &);
-  _exports_SemaphoreV_templ(bool, const Napi::CallbackInfo &);
+  _exports_SemaphoreLimits_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreLimits_templ(bool, const Napi::CallbackInfo &);
   // jsnapi_class_method_declaration
-  static Napi::Value _wrap_SemaphoreV_createExclusive(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreLimits_maxSetSize_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreLimits_maxSetSize_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  static Napi::Value _wrap_SemaphoreV_create(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreLimits_maxSemaphores_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreLimits_maxSemaphores_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  static Napi::Value _wrap_SemaphoreV_open(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreLimits_maxOpsPerCall_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreLimits_maxOpsPerCall_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  static Napi::Value _wrap_SemaphoreV_unlink(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreLimits_maxSets_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreLimits_maxSets_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_wait__SWIG_0(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreLimits_maxValue_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreLimits_maxValue_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_wait__SWIG_1(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreLimits_setsInUse_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreLimits_setsInUse_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_wait(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreLimits_semaphoresInUse_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreLimits_semaphoresInUse_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_trywait__SWIG_0(const Napi::CallbackInfo &);
+  Napi::Value _wrap_new_SemaphoreLimits(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreLimits_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                                const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                         const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreLimits_inst : public _exports_SemaphoreLimits_templ<_exports_SemaphoreLimits_inst> {
+public:
+  using _exports_SemaphoreLimits_templ::_exports_SemaphoreLimits_templ;
+  virtual ~_exports_SemaphoreLimits_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreLimits_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreLimits_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreLimits (_exports_SemaphoreLimits) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreLimits_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreLimits_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreLimits_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreLimits_inst>::DefineClass(env, "SemaphoreLimits", symbolTable);
+}
+
+void _exports_SemaphoreLimits_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreLimits_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreLimits_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_register_member_variable
+  members.erase("maxSetSize");
+  members.insert(
+      {"maxSetSize", _exports_SemaphoreLimits_templ::InstanceAccessor(
+                         "maxSetSize", &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxSetSize_get,
+                         &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxSetSize_set,
+                         static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("maxSemaphores");
+  members.insert(
+      {"maxSemaphores",
+       _exports_SemaphoreLimits_templ::InstanceAccessor(
+           "maxSemaphores", &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxSemaphores_get,
+           &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxSemaphores_set,
+           static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("maxOpsPerCall");
+  members.insert(
+      {"maxOpsPerCall",
+       _exports_SemaphoreLimits_templ::InstanceAccessor(
+           "maxOpsPerCall", &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxOpsPerCall_get,
+           &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxOpsPerCall_set,
+           static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("maxSets");
+  members.insert(
+      {"maxSets", _exports_SemaphoreLimits_templ::InstanceAccessor(
+                      "maxSets", &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxSets_get,
+                      &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxSets_set,
+                      static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("maxValue");
+  members.insert(
+      {"maxValue", _exports_SemaphoreLimits_templ::InstanceAccessor(
+                       "maxValue", &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxValue_get,
+                       &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_maxValue_set,
+                       static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("setsInUse");
+  members.insert(
+      {"setsInUse", _exports_SemaphoreLimits_templ::InstanceAccessor(
+                        "setsInUse", &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_setsInUse_get,
+                        &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_setsInUse_set,
+                        static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("semaphoresInUse");
+  members.insert(
+      {"semaphoresInUse",
+       _exports_SemaphoreLimits_templ::InstanceAccessor(
+           "semaphoresInUse", &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_semaphoresInUse_get,
+           &_exports_SemaphoreLimits_templ::_wrap_SemaphoreLimits_semaphoresInUse_set,
+           static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+
+  /* add static class functions and variables */
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_SemaphoreSetInfo_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreSetInfo_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreSetInfo_templ(bool, const Napi::CallbackInfo &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_trywait__SWIG_1(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreSetInfo_key_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_key_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_trywait(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreSetInfo_id_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_id_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_post__SWIG_0(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreSetInfo_owner_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_owner_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_post__SWIG_1(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreSetInfo_mode_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_mode_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_post(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreSetInfo_nsems_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_nsems_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_valueOf(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreSetInfo_otime_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_otime_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_refs(const Napi::CallbackInfo &);
+  Napi::Value _wrap_SemaphoreSetInfo_ctime_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_ctime_set(const Napi::CallbackInfo &, const Napi::Value &);
   // jsnapi_class_method_declaration
-  Napi::Value _wrap_SemaphoreV_close(const Napi::CallbackInfo &);
-  virtual ~_exports_SemaphoreV_templ();
+  Napi::Value _wrap_SemaphoreSetInfo_values_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_values_set(const Napi::CallbackInfo &, const Napi::Value &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfo_refs_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_refs_set(const Napi::CallbackInfo &, const Napi::Value &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfo_waitingToDecrement_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_waitingToDecrement_set(const Napi::CallbackInfo &, const Napi::Value &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfo_waitingForZero_get(const Napi::CallbackInfo &);
+  // jsnapi_class_setter_declaration
+  void _wrap_SemaphoreSetInfo_waitingForZero_set(const Napi::CallbackInfo &, const Napi::Value &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreSetInfo(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreSetInfo_templ();
   // jsnapi_class_epilogue_template
   static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
   void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
 };
 
 template <typename SWIG_OBJ_WRAP>
-void _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
-                                                                           const Napi::Value &value) {
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                                 const Napi::Value &value) {
   SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
 }
 
 template <typename SWIG_OBJ_WRAP>
-void _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
-                                                                    const Napi::Value &value) {
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                          const Napi::Value &value) {
   SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
 }
 // jsnapi_class_instance
-class _exports_SemaphoreV_inst : public _exports_SemaphoreV_templ<_exports_SemaphoreV_inst> {
+class _exports_SemaphoreSetInfo_inst : public _exports_SemaphoreSetInfo_templ<_exports_SemaphoreSetInfo_inst> {
 public:
-  using _exports_SemaphoreV_templ::_exports_SemaphoreV_templ;
-  virtual ~_exports_SemaphoreV_inst(){
+  using _exports_SemaphoreSetInfo_templ::_exports_SemaphoreSetInfo_templ;
+  virtual ~_exports_SemaphoreSetInfo_inst(){
 
   };
-  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &,
-                         std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &);
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreSetInfo_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreSetInfo_templ::PropertyDescriptor> &);
   static Napi::Function GetClass(Napi::Env);
 };
-/* Class: SemaphoreV (_exports_SemaphoreV) */
+/* Class: SemaphoreSetInfo (_exports_SemaphoreSetInfo) */
 // jsnapi_getclass
-Napi::Function _exports_SemaphoreV_inst::GetClass(Napi::Env env) {
-  std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> members, staticMembers;
+Napi::Function _exports_SemaphoreSetInfo_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreSetInfo_templ::PropertyDescriptor> members, staticMembers;
   GetMembers(env, members, staticMembers);
 
-  std::vector<_exports_SemaphoreV_inst::PropertyDescriptor> symbolTable;
+  std::vector<_exports_SemaphoreSetInfo_inst::PropertyDescriptor> symbolTable;
   for (auto it = members.begin(); it != members.end(); it++)
     symbolTable.push_back(it->second);
   for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
     symbolTable.push_back(it->second);
 
-  return Napi::ObjectWrap<_exports_SemaphoreV_inst>::DefineClass(env, "SemaphoreV", symbolTable);
+  return Napi::ObjectWrap<_exports_SemaphoreSetInfo_inst>::DefineClass(env, "SemaphoreSetInfo", symbolTable);
 }
 
-void _exports_SemaphoreV_inst::GetMembers(
-    Napi::Env env, std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &members,
-    std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &staticMembers) {
+void _exports_SemaphoreSetInfo_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreSetInfo_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreSetInfo_templ::PropertyDescriptor> &staticMembers) {
   std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
       baseStaticMembers;
   SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
@@ -1731,143 +2168,18776 @@ void _exports_SemaphoreV_inst::GetMembers(
   staticMembers.insert(staticMembers.begin(), staticMembers.end());
 
   /* register wrapper functions */
-  // jsnapi_member_function_descriptor
-  members.erase("wait");
-  members.insert({"wait", _exports_SemaphoreV_templ::InstanceMethod(
-                              "wait", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_wait,
-                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_member_function_descriptor
-  members.erase("trywait");
-  members.insert({"trywait", _exports_SemaphoreV_templ::InstanceMethod(
-                                 "trywait", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_trywait,
-                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_member_function_descriptor
-  members.erase("post");
-  members.insert({"post", _exports_SemaphoreV_templ::InstanceMethod(
-                              "post", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_post,
-                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_member_function_descriptor
-  members.erase("valueOf");
-  members.insert({"valueOf", _exports_SemaphoreV_templ::InstanceMethod(
-                                 "valueOf", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_valueOf,
-                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_member_function_descriptor
-  members.erase("refs");
-  members.insert({"refs", _exports_SemaphoreV_templ::InstanceMethod(
-                              "refs", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_refs,
-                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_member_function_descriptor
-  members.erase("close");
-  members.insert({"close", _exports_SemaphoreV_templ::InstanceMethod(
-                               "close", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_close,
+  // jsnapi_register_member_variable
+  members.erase("key");
+  members.insert(
+      {"key", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                  "key", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_key_get,
+                  &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_key_set,
+                  static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("id");
+  members.insert(
+      {"id", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                 "id", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_id_get,
+                 &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_id_set,
+                 static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("owner");
+  members.insert(
+      {"owner", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                    "owner", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_owner_get,
+                    &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_owner_set,
+                    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("mode");
+  members.insert(
+      {"mode", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                   "mode", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_mode_get,
+                   &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_mode_set,
+                   static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("nsems");
+  members.insert(
+      {"nsems", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                    "nsems", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_nsems_get,
+                    &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_nsems_set,
+                    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("otime");
+  members.insert(
+      {"otime", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                    "otime", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_otime_get,
+                    &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_otime_set,
+                    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("ctime");
+  members.insert(
+      {"ctime", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                    "ctime", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_ctime_get,
+                    &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_ctime_set,
+                    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("values");
+  members.insert(
+      {"values", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                     "values", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_values_get,
+                     &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_values_set,
+                     static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("refs");
+  members.insert(
+      {"refs", _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+                   "refs", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_refs_get,
+                   &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_refs_set,
+                   static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("waitingToDecrement");
+  members.insert(
+      {"waitingToDecrement",
+       _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+           "waitingToDecrement", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_waitingToDecrement_get,
+           &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_waitingToDecrement_set,
+           static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+  // jsnapi_register_member_variable
+  members.erase("waitingForZero");
+  members.insert(
+      {"waitingForZero",
+       _exports_SemaphoreSetInfo_templ::InstanceAccessor(
+           "waitingForZero", &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_waitingForZero_get,
+           &_exports_SemaphoreSetInfo_templ::_wrap_SemaphoreSetInfo_waitingForZero_set,
+           static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable))});
+
+  /* add static class functions and variables */
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_UnsignedShortList_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_UnsignedShortList_templ(const Napi::CallbackInfo &);
+  _exports_UnsignedShortList_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_UnsignedShortList__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_UnsignedShortList__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_UnsignedShortList__SWIG_2(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_UnsignedShortList(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_size(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_capacity(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_reserve(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_isEmpty(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_clear(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_add(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_get(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_UnsignedShortList_set(const Napi::CallbackInfo &);
+  virtual ~_exports_UnsignedShortList_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                                  const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                           const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_UnsignedShortList_inst : public _exports_UnsignedShortList_templ<_exports_UnsignedShortList_inst> {
+public:
+  using _exports_UnsignedShortList_templ::_exports_UnsignedShortList_templ;
+  virtual ~_exports_UnsignedShortList_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_UnsignedShortList_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_UnsignedShortList_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: UnsignedShortList (_exports_UnsignedShortList) */
+// jsnapi_getclass
+Napi::Function _exports_UnsignedShortList_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_UnsignedShortList_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_UnsignedShortList_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_UnsignedShortList_inst>::DefineClass(env, "UnsignedShortList", symbolTable);
+}
+
+void _exports_UnsignedShortList_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_UnsignedShortList_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_UnsignedShortList_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("size");
+  members.insert({"size", _exports_UnsignedShortList_templ::InstanceMethod(
+                              "size", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_size,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("capacity");
+  members.insert({"capacity", _exports_UnsignedShortList_templ::InstanceMethod(
+                                  "capacity", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_capacity,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("reserve");
+  members.insert({"reserve", _exports_UnsignedShortList_templ::InstanceMethod(
+                                 "reserve", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_reserve,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("isEmpty");
+  members.insert({"isEmpty", _exports_UnsignedShortList_templ::InstanceMethod(
+                                 "isEmpty", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_isEmpty,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("clear");
+  members.insert({"clear", _exports_UnsignedShortList_templ::InstanceMethod(
+                               "clear", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_clear,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("add");
+  members.insert({"add", _exports_UnsignedShortList_templ::InstanceMethod(
+                             "add", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_add,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("get");
+  members.insert({"get", _exports_UnsignedShortList_templ::InstanceMethod(
+                             "get", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_get,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("set");
+  members.insert({"set", _exports_UnsignedShortList_templ::InstanceMethod(
+                             "set", &_exports_UnsignedShortList_templ::_wrap_UnsignedShortList_set,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_SemaphoreSetInfoList_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreSetInfoList_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreSetInfoList_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreSetInfoList__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreSetInfoList__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreSetInfoList__SWIG_2(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreSetInfoList(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_size(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_capacity(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_reserve(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_isEmpty(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_clear(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_add(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_get(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSetInfoList_set(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreSetInfoList_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                                     const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                              const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreSetInfoList_inst
+    : public _exports_SemaphoreSetInfoList_templ<_exports_SemaphoreSetInfoList_inst> {
+public:
+  using _exports_SemaphoreSetInfoList_templ::_exports_SemaphoreSetInfoList_templ;
+  virtual ~_exports_SemaphoreSetInfoList_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreSetInfoList_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreSetInfoList_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreSetInfoList (_exports_SemaphoreSetInfoList) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreSetInfoList_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreSetInfoList_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreSetInfoList_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreSetInfoList_inst>::DefineClass(env, "SemaphoreSetInfoList", symbolTable);
+}
+
+void _exports_SemaphoreSetInfoList_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreSetInfoList_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreSetInfoList_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("size");
+  members.insert({"size", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                              "size", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_size,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("capacity");
+  members.insert({"capacity", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                                  "capacity", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_capacity,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("reserve");
+  members.insert({"reserve", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                                 "reserve", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_reserve,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("isEmpty");
+  members.insert({"isEmpty", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                                 "isEmpty", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_isEmpty,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("clear");
+  members.insert({"clear", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                               "clear", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_clear,
                                static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("add");
+  members.insert({"add", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                             "add", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_add,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("get");
+  members.insert({"get", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                             "get", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_get,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("set");
+  members.insert({"set", _exports_SemaphoreSetInfoList_templ::InstanceMethod(
+                             "set", &_exports_SemaphoreSetInfoList_templ::_wrap_SemaphoreSetInfoList_set,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_SemaphoreV_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreV_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreV_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_acquireAny(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_limits(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_list(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_reap__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV_reap__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_reap(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_wait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_wait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_trywait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_trywait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_timedwait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_post__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_post__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_post(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_postWaiters__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_postWaiters__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV__wrap_SemaphoreV_postWaiters(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_waitZero(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_tryWaitZero(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_timedWaitZero(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_waitAvailable(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_tryWaitAvailable(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_timedWaitAvailable(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_drain(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_valueOf(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreV_close(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreV_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                           const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                    const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreV_inst : public _exports_SemaphoreV_templ<_exports_SemaphoreV_inst> {
+public:
+  using _exports_SemaphoreV_templ::_exports_SemaphoreV_templ;
+  virtual ~_exports_SemaphoreV_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreV (_exports_SemaphoreV) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreV_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreV_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreV_inst>::DefineClass(env, "SemaphoreV", symbolTable);
+}
+
+void _exports_SemaphoreV_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreV_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_SemaphoreV_templ::InstanceMethod(
+                              "wait", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert({"trywait", _exports_SemaphoreV_templ::InstanceMethod(
+                                 "trywait", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_trywait,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwait");
+  members.insert({"timedwait", _exports_SemaphoreV_templ::InstanceMethod(
+                                   "timedwait", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_timedwait,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("post");
+  members.insert({"post", _exports_SemaphoreV_templ::InstanceMethod(
+                              "post", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_post,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("postWaiters");
+  members.insert(
+      {"postWaiters", _exports_SemaphoreV_templ::InstanceMethod(
+                          "postWaiters", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_postWaiters,
+                          static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("waitZero");
+  members.insert({"waitZero", _exports_SemaphoreV_templ::InstanceMethod(
+                                  "waitZero", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_waitZero,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("tryWaitZero");
+  members.insert({"tryWaitZero", _exports_SemaphoreV_templ::InstanceMethod(
+                                     "tryWaitZero", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_tryWaitZero,
+                                     static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedWaitZero");
+  members.insert({"timedWaitZero", _exports_SemaphoreV_templ::InstanceMethod(
+                                       "timedWaitZero", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_timedWaitZero,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("waitAvailable");
+  members.insert({"waitAvailable", _exports_SemaphoreV_templ::InstanceMethod(
+                                       "waitAvailable", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_waitAvailable,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("tryWaitAvailable");
+  members.insert(
+      {"tryWaitAvailable", _exports_SemaphoreV_templ::InstanceMethod(
+                               "tryWaitAvailable", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_tryWaitAvailable,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedWaitAvailable");
+  members.insert(
+      {"timedWaitAvailable", _exports_SemaphoreV_templ::InstanceMethod(
+                                 "timedWaitAvailable", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_timedWaitAvailable,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("drain");
+  members.insert({"drain", _exports_SemaphoreV_templ::InstanceMethod(
+                               "drain", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_drain,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("valueOf");
+  members.insert({"valueOf", _exports_SemaphoreV_templ::InstanceMethod(
+                                 "valueOf", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_valueOf,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_SemaphoreV_templ::InstanceMethod(
+                              "refs", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_SemaphoreV_templ::InstanceMethod(
+                               "close", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("acquireAny");
+  staticMembers.insert(
+      {"acquireAny", StaticMethod("acquireAny", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_acquireAny,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("limits");
+  staticMembers.insert(
+      {"limits", StaticMethod("limits", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_limits,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("list");
+  staticMembers.insert(
+      {"list", StaticMethod("list", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_list,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("reap");
+  staticMembers.insert(
+      {"reap", StaticMethod("reap", &_exports_SemaphoreV_templ::_wrap_SemaphoreV__wrap_SemaphoreV_reap,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_SemaphoreVList_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreVList_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreVList_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreVList__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreVList__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreVList__SWIG_2(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_new_SemaphoreVList(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_size(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_capacity(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_reserve(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_isEmpty(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_clear(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_add(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_get(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreVList_set(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreVList_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                               const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                        const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreVList_inst : public _exports_SemaphoreVList_templ<_exports_SemaphoreVList_inst> {
+public:
+  using _exports_SemaphoreVList_templ::_exports_SemaphoreVList_templ;
+  virtual ~_exports_SemaphoreVList_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreVList_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreVList_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreVList (_exports_SemaphoreVList) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreVList_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreVList_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreVList_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreVList_inst>::DefineClass(env, "SemaphoreVList", symbolTable);
+}
+
+void _exports_SemaphoreVList_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreVList_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreVList_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("size");
+  members.insert({"size", _exports_SemaphoreVList_templ::InstanceMethod(
+                              "size", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_size,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("capacity");
+  members.insert({"capacity", _exports_SemaphoreVList_templ::InstanceMethod(
+                                  "capacity", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_capacity,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("reserve");
+  members.insert({"reserve", _exports_SemaphoreVList_templ::InstanceMethod(
+                                 "reserve", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_reserve,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("isEmpty");
+  members.insert({"isEmpty", _exports_SemaphoreVList_templ::InstanceMethod(
+                                 "isEmpty", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_isEmpty,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("clear");
+  members.insert({"clear", _exports_SemaphoreVList_templ::InstanceMethod(
+                               "clear", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_clear,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("add");
+  members.insert({"add", _exports_SemaphoreVList_templ::InstanceMethod(
+                             "add", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_add,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("get");
+  members.insert({"get", _exports_SemaphoreVList_templ::InstanceMethod(
+                             "get", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_get,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("set");
+  members.insert({"set", _exports_SemaphoreVList_templ::InstanceMethod(
+                             "set", &_exports_SemaphoreVList_templ::_wrap_SemaphoreVList_set,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_SemaphoreE_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreE_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreE_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreE_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreE_fromFd(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreE_receive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_wait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_wait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE__wrap_SemaphoreE_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_trywait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_trywait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE__wrap_SemaphoreE_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_post__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_post__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE__wrap_SemaphoreE_post(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_valueOf(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_fd(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_send(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_waitAsync__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_waitAsync__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE__wrap_SemaphoreE_waitAsync(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreE_close(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreE_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                           const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                    const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreE_inst : public _exports_SemaphoreE_templ<_exports_SemaphoreE_inst> {
+public:
+  using _exports_SemaphoreE_templ::_exports_SemaphoreE_templ;
+  virtual ~_exports_SemaphoreE_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreE_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreE_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreE (_exports_SemaphoreE) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreE_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreE_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreE_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreE_inst>::DefineClass(env, "SemaphoreE", symbolTable);
+}
+
+void _exports_SemaphoreE_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreE_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreE_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_SemaphoreE_templ::InstanceMethod(
+                              "wait", &_exports_SemaphoreE_templ::_wrap_SemaphoreE__wrap_SemaphoreE_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert({"trywait", _exports_SemaphoreE_templ::InstanceMethod(
+                                 "trywait", &_exports_SemaphoreE_templ::_wrap_SemaphoreE__wrap_SemaphoreE_trywait,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("post");
+  members.insert({"post", _exports_SemaphoreE_templ::InstanceMethod(
+                              "post", &_exports_SemaphoreE_templ::_wrap_SemaphoreE__wrap_SemaphoreE_post,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("valueOf");
+  members.insert({"valueOf", _exports_SemaphoreE_templ::InstanceMethod(
+                                 "valueOf", &_exports_SemaphoreE_templ::_wrap_SemaphoreE_valueOf,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("fd");
+  members.insert({"fd", _exports_SemaphoreE_templ::InstanceMethod(
+                            "fd", &_exports_SemaphoreE_templ::_wrap_SemaphoreE_fd,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("send");
+  members.insert({"send", _exports_SemaphoreE_templ::InstanceMethod(
+                              "send", &_exports_SemaphoreE_templ::_wrap_SemaphoreE_send,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("waitAsync");
+  members.insert({"waitAsync", _exports_SemaphoreE_templ::InstanceMethod(
+                                   "waitAsync", &_exports_SemaphoreE_templ::_wrap_SemaphoreE__wrap_SemaphoreE_waitAsync,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_SemaphoreE_templ::InstanceMethod(
+                               "close", &_exports_SemaphoreE_templ::_wrap_SemaphoreE_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_SemaphoreE_templ::_wrap_SemaphoreE_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("fromFd");
+  staticMembers.insert(
+      {"fromFd", StaticMethod("fromFd", &_exports_SemaphoreE_templ::_wrap_SemaphoreE_fromFd,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("receive");
+  staticMembers.insert(
+      {"receive", StaticMethod("receive", &_exports_SemaphoreE_templ::_wrap_SemaphoreE_receive,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_SemaphoreP_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreP_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreP_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreP_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreP_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreP_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreP_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_wait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_wait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP__wrap_SemaphoreP_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_trywait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_trywait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP__wrap_SemaphoreP_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_post__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_post__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP__wrap_SemaphoreP_post(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_valueOf(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreP_close(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreP_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                           const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                    const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreP_inst : public _exports_SemaphoreP_templ<_exports_SemaphoreP_inst> {
+public:
+  using _exports_SemaphoreP_templ::_exports_SemaphoreP_templ;
+  virtual ~_exports_SemaphoreP_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreP_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreP_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreP (_exports_SemaphoreP) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreP_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreP_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreP_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreP_inst>::DefineClass(env, "SemaphoreP", symbolTable);
+}
+
+void _exports_SemaphoreP_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreP_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreP_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_SemaphoreP_templ::InstanceMethod(
+                              "wait", &_exports_SemaphoreP_templ::_wrap_SemaphoreP__wrap_SemaphoreP_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert({"trywait", _exports_SemaphoreP_templ::InstanceMethod(
+                                 "trywait", &_exports_SemaphoreP_templ::_wrap_SemaphoreP__wrap_SemaphoreP_trywait,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("post");
+  members.insert({"post", _exports_SemaphoreP_templ::InstanceMethod(
+                              "post", &_exports_SemaphoreP_templ::_wrap_SemaphoreP__wrap_SemaphoreP_post,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("valueOf");
+  members.insert({"valueOf", _exports_SemaphoreP_templ::InstanceMethod(
+                                 "valueOf", &_exports_SemaphoreP_templ::_wrap_SemaphoreP_valueOf,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_SemaphoreP_templ::InstanceMethod(
+                              "refs", &_exports_SemaphoreP_templ::_wrap_SemaphoreP_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_SemaphoreP_templ::InstanceMethod(
+                               "close", &_exports_SemaphoreP_templ::_wrap_SemaphoreP_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive", &_exports_SemaphoreP_templ::_wrap_SemaphoreP_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_SemaphoreP_templ::_wrap_SemaphoreP_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_SemaphoreP_templ::_wrap_SemaphoreP_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_SemaphoreP_templ::_wrap_SemaphoreP_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_SemaphoreF_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreF_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreF_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreF_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreF_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreF_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreF_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreF_uringAvailable(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_wait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_wait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF__wrap_SemaphoreF_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_trywait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_trywait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF__wrap_SemaphoreF_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_post__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_post__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF__wrap_SemaphoreF_post(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_valueOf(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_isFutex(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_waitAsync(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreF_close(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreF_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                           const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                    const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreF_inst : public _exports_SemaphoreF_templ<_exports_SemaphoreF_inst> {
+public:
+  using _exports_SemaphoreF_templ::_exports_SemaphoreF_templ;
+  virtual ~_exports_SemaphoreF_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreF_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreF_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreF (_exports_SemaphoreF) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreF_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreF_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreF_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreF_inst>::DefineClass(env, "SemaphoreF", symbolTable);
+}
+
+void _exports_SemaphoreF_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreF_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreF_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_SemaphoreF_templ::InstanceMethod(
+                              "wait", &_exports_SemaphoreF_templ::_wrap_SemaphoreF__wrap_SemaphoreF_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert({"trywait", _exports_SemaphoreF_templ::InstanceMethod(
+                                 "trywait", &_exports_SemaphoreF_templ::_wrap_SemaphoreF__wrap_SemaphoreF_trywait,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("post");
+  members.insert({"post", _exports_SemaphoreF_templ::InstanceMethod(
+                              "post", &_exports_SemaphoreF_templ::_wrap_SemaphoreF__wrap_SemaphoreF_post,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("valueOf");
+  members.insert({"valueOf", _exports_SemaphoreF_templ::InstanceMethod(
+                                 "valueOf", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_valueOf,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_SemaphoreF_templ::InstanceMethod(
+                              "refs", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("isFutex");
+  members.insert({"isFutex", _exports_SemaphoreF_templ::InstanceMethod(
+                                 "isFutex", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_isFutex,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("waitAsync");
+  members.insert({"waitAsync", _exports_SemaphoreF_templ::InstanceMethod(
+                                   "waitAsync", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_waitAsync,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_SemaphoreF_templ::InstanceMethod(
+                               "close", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("uringAvailable");
+  staticMembers.insert(
+      {"uringAvailable", StaticMethod("uringAvailable", &_exports_SemaphoreF_templ::_wrap_SemaphoreF_uringAvailable,
+                                      static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_CountdownLatch_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_CountdownLatch_templ(const Napi::CallbackInfo &);
+  _exports_CountdownLatch_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_CountdownLatch_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_CountdownLatch_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_CountdownLatch_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_CountdownLatch_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_countDown__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_countDown__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch__wrap_CountdownLatch_countDown(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_timedwait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_count(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_CountdownLatch_close(const Napi::CallbackInfo &);
+  virtual ~_exports_CountdownLatch_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                               const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                        const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_CountdownLatch_inst : public _exports_CountdownLatch_templ<_exports_CountdownLatch_inst> {
+public:
+  using _exports_CountdownLatch_templ::_exports_CountdownLatch_templ;
+  virtual ~_exports_CountdownLatch_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_CountdownLatch_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_CountdownLatch_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: CountdownLatch (_exports_CountdownLatch) */
+// jsnapi_getclass
+Napi::Function _exports_CountdownLatch_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_CountdownLatch_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_CountdownLatch_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_CountdownLatch_inst>::DefineClass(env, "CountdownLatch", symbolTable);
+}
+
+void _exports_CountdownLatch_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_CountdownLatch_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_CountdownLatch_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("countDown");
+  members.insert(
+      {"countDown", _exports_CountdownLatch_templ::InstanceMethod(
+                        "countDown",
+                        &_exports_CountdownLatch_templ::_wrap_CountdownLatch__wrap_CountdownLatch_countDown,
+                        static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_CountdownLatch_templ::InstanceMethod(
+                              "wait", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert({"trywait", _exports_CountdownLatch_templ::InstanceMethod(
+                                 "trywait", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_trywait,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwait");
+  members.insert({"timedwait", _exports_CountdownLatch_templ::InstanceMethod(
+                                   "timedwait", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_timedwait,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("count");
+  members.insert({"count", _exports_CountdownLatch_templ::InstanceMethod(
+                               "count", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_count,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_CountdownLatch_templ::InstanceMethod(
+                              "refs", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_CountdownLatch_templ::InstanceMethod(
+                               "close", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive",
+                                       &_exports_CountdownLatch_templ::_wrap_CountdownLatch_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_CountdownLatch_templ::_wrap_CountdownLatch_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_Barrier_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_Barrier_templ(const Napi::CallbackInfo &);
+  _exports_Barrier_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Barrier_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Barrier_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Barrier_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Barrier_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_timedwait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_arrive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_passed(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_timedwaitFor(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_parties(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_arrived(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_isBroken(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_reset(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Barrier_close(const Napi::CallbackInfo &);
+  virtual ~_exports_Barrier_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_Barrier_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                        const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_Barrier_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                 const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_Barrier_inst : public _exports_Barrier_templ<_exports_Barrier_inst> {
+public:
+  using _exports_Barrier_templ::_exports_Barrier_templ;
+  virtual ~_exports_Barrier_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_Barrier_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_Barrier_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: Barrier (_exports_Barrier) */
+// jsnapi_getclass
+Napi::Function _exports_Barrier_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_Barrier_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_Barrier_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_Barrier_inst>::DefineClass(env, "Barrier", symbolTable);
+}
+
+void _exports_Barrier_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_Barrier_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_Barrier_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_Barrier_templ::InstanceMethod(
+                              "wait", &_exports_Barrier_templ::_wrap_Barrier_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwait");
+  members.insert({"timedwait", _exports_Barrier_templ::InstanceMethod(
+                                   "timedwait", &_exports_Barrier_templ::_wrap_Barrier_timedwait,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("arrive");
+  members.insert({"arrive", _exports_Barrier_templ::InstanceMethod(
+                                "arrive", &_exports_Barrier_templ::_wrap_Barrier_arrive,
+                                static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("passed");
+  members.insert({"passed", _exports_Barrier_templ::InstanceMethod(
+                                "passed", &_exports_Barrier_templ::_wrap_Barrier_passed,
+                                static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwaitFor");
+  members.insert({"timedwaitFor", _exports_Barrier_templ::InstanceMethod(
+                                      "timedwaitFor", &_exports_Barrier_templ::_wrap_Barrier_timedwaitFor,
+                                      static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("parties");
+  members.insert({"parties", _exports_Barrier_templ::InstanceMethod(
+                                 "parties", &_exports_Barrier_templ::_wrap_Barrier_parties,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("arrived");
+  members.insert({"arrived", _exports_Barrier_templ::InstanceMethod(
+                                 "arrived", &_exports_Barrier_templ::_wrap_Barrier_arrived,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("isBroken");
+  members.insert({"isBroken", _exports_Barrier_templ::InstanceMethod(
+                                  "isBroken", &_exports_Barrier_templ::_wrap_Barrier_isBroken,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("reset");
+  members.insert({"reset", _exports_Barrier_templ::InstanceMethod(
+                               "reset", &_exports_Barrier_templ::_wrap_Barrier_reset,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_Barrier_templ::InstanceMethod(
+                              "refs", &_exports_Barrier_templ::_wrap_Barrier_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_Barrier_templ::InstanceMethod(
+                               "close", &_exports_Barrier_templ::_wrap_Barrier_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive", &_exports_Barrier_templ::_wrap_Barrier_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_Barrier_templ::_wrap_Barrier_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_Barrier_templ::_wrap_Barrier_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_Barrier_templ::_wrap_Barrier_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_RwLock_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_RwLock_templ(const Napi::CallbackInfo &);
+  _exports_RwLock_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RwLock_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RwLock_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RwLock_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RwLock_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_readLock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_tryReadLock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_timedReadLock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_readUnlock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_writeLock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_tryWriteLock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_timedWriteLock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_writeUnlock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_readers(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_writersWaiting(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_isWriteLocked(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RwLock_close(const Napi::CallbackInfo &);
+  virtual ~_exports_RwLock_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_RwLock_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                       const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_RwLock_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_RwLock_inst : public _exports_RwLock_templ<_exports_RwLock_inst> {
+public:
+  using _exports_RwLock_templ::_exports_RwLock_templ;
+  virtual ~_exports_RwLock_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_RwLock_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_RwLock_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: RwLock (_exports_RwLock) */
+// jsnapi_getclass
+Napi::Function _exports_RwLock_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_RwLock_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_RwLock_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_RwLock_inst>::DefineClass(env, "RwLock", symbolTable);
+}
+
+void _exports_RwLock_inst::GetMembers(Napi::Env env,
+                                      std::map<std::string, _exports_RwLock_templ::PropertyDescriptor> &members,
+                                      std::map<std::string, _exports_RwLock_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("readLock");
+  members.insert({"readLock", _exports_RwLock_templ::InstanceMethod(
+                                  "readLock", &_exports_RwLock_templ::_wrap_RwLock_readLock,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("tryReadLock");
+  members.insert({"tryReadLock", _exports_RwLock_templ::InstanceMethod(
+                                     "tryReadLock", &_exports_RwLock_templ::_wrap_RwLock_tryReadLock,
+                                     static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedReadLock");
+  members.insert({"timedReadLock", _exports_RwLock_templ::InstanceMethod(
+                                       "timedReadLock", &_exports_RwLock_templ::_wrap_RwLock_timedReadLock,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("readUnlock");
+  members.insert({"readUnlock", _exports_RwLock_templ::InstanceMethod(
+                                    "readUnlock", &_exports_RwLock_templ::_wrap_RwLock_readUnlock,
+                                    static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("writeLock");
+  members.insert({"writeLock", _exports_RwLock_templ::InstanceMethod(
+                                   "writeLock", &_exports_RwLock_templ::_wrap_RwLock_writeLock,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("tryWriteLock");
+  members.insert({"tryWriteLock", _exports_RwLock_templ::InstanceMethod(
+                                      "tryWriteLock", &_exports_RwLock_templ::_wrap_RwLock_tryWriteLock,
+                                      static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedWriteLock");
+  members.insert({"timedWriteLock", _exports_RwLock_templ::InstanceMethod(
+                                        "timedWriteLock", &_exports_RwLock_templ::_wrap_RwLock_timedWriteLock,
+                                        static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("writeUnlock");
+  members.insert({"writeUnlock", _exports_RwLock_templ::InstanceMethod(
+                                     "writeUnlock", &_exports_RwLock_templ::_wrap_RwLock_writeUnlock,
+                                     static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("readers");
+  members.insert({"readers", _exports_RwLock_templ::InstanceMethod(
+                                 "readers", &_exports_RwLock_templ::_wrap_RwLock_readers,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("writersWaiting");
+  members.insert({"writersWaiting", _exports_RwLock_templ::InstanceMethod(
+                                        "writersWaiting", &_exports_RwLock_templ::_wrap_RwLock_writersWaiting,
+                                        static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("isWriteLocked");
+  members.insert({"isWriteLocked", _exports_RwLock_templ::InstanceMethod(
+                                       "isWriteLocked", &_exports_RwLock_templ::_wrap_RwLock_isWriteLocked,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_RwLock_templ::InstanceMethod(
+                              "refs", &_exports_RwLock_templ::_wrap_RwLock_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_RwLock_templ::InstanceMethod(
+                               "close", &_exports_RwLock_templ::_wrap_RwLock_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive", &_exports_RwLock_templ::_wrap_RwLock_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_RwLock_templ::_wrap_RwLock_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_RwLock_templ::_wrap_RwLock_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_RwLock_templ::_wrap_RwLock_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_Event_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_Event_templ(const Napi::CallbackInfo &);
+  _exports_Event_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Event_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Event_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Event_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Event_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_set(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_reset(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_isSet(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_timedwait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_waiters(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Event_close(const Napi::CallbackInfo &);
+  virtual ~_exports_Event_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_Event_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                      const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_Event_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                               const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_Event_inst : public _exports_Event_templ<_exports_Event_inst> {
+public:
+  using _exports_Event_templ::_exports_Event_templ;
+  virtual ~_exports_Event_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_Event_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_Event_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: Event (_exports_Event) */
+// jsnapi_getclass
+Napi::Function _exports_Event_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_Event_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_Event_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_Event_inst>::DefineClass(env, "Event", symbolTable);
+}
+
+void _exports_Event_inst::GetMembers(Napi::Env env,
+                                     std::map<std::string, _exports_Event_templ::PropertyDescriptor> &members,
+                                     std::map<std::string, _exports_Event_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("set");
+  members.insert({"set", _exports_Event_templ::InstanceMethod(
+                             "set", &_exports_Event_templ::_wrap_Event_set,
+                             static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("reset");
+  members.insert({"reset", _exports_Event_templ::InstanceMethod(
+                               "reset", &_exports_Event_templ::_wrap_Event_reset,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("isSet");
+  members.insert({"isSet", _exports_Event_templ::InstanceMethod(
+                               "isSet", &_exports_Event_templ::_wrap_Event_isSet,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_Event_templ::InstanceMethod(
+                              "wait", &_exports_Event_templ::_wrap_Event_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert({"trywait", _exports_Event_templ::InstanceMethod(
+                                 "trywait", &_exports_Event_templ::_wrap_Event_trywait,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwait");
+  members.insert({"timedwait", _exports_Event_templ::InstanceMethod(
+                                   "timedwait", &_exports_Event_templ::_wrap_Event_timedwait,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("waiters");
+  members.insert({"waiters", _exports_Event_templ::InstanceMethod(
+                                 "waiters", &_exports_Event_templ::_wrap_Event_waiters,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_Event_templ::InstanceMethod(
+                              "refs", &_exports_Event_templ::_wrap_Event_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_Event_templ::InstanceMethod(
+                               "close", &_exports_Event_templ::_wrap_Event_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive", &_exports_Event_templ::_wrap_Event_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_Event_templ::_wrap_Event_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_Event_templ::_wrap_Event_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_Event_templ::_wrap_Event_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP> class _exports_Condition_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_Condition_templ(const Napi::CallbackInfo &);
+  _exports_Condition_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Condition_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Condition_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Condition_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_Condition_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_lock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_trylock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_unlock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_timedwait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_notifyOne(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_notifyAll(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_waiters(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_Condition_close(const Napi::CallbackInfo &);
+  virtual ~_exports_Condition_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_Condition_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                          const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_Condition_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                   const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_Condition_inst : public _exports_Condition_templ<_exports_Condition_inst> {
+public:
+  using _exports_Condition_templ::_exports_Condition_templ;
+  virtual ~_exports_Condition_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_Condition_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_Condition_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: Condition (_exports_Condition) */
+// jsnapi_getclass
+Napi::Function _exports_Condition_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_Condition_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_Condition_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_Condition_inst>::DefineClass(env, "Condition", symbolTable);
+}
+
+void _exports_Condition_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_Condition_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_Condition_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("lock");
+  members.insert({"lock", _exports_Condition_templ::InstanceMethod(
+                              "lock", &_exports_Condition_templ::_wrap_Condition_lock,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trylock");
+  members.insert({"trylock", _exports_Condition_templ::InstanceMethod(
+                                 "trylock", &_exports_Condition_templ::_wrap_Condition_trylock,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("unlock");
+  members.insert({"unlock", _exports_Condition_templ::InstanceMethod(
+                                "unlock", &_exports_Condition_templ::_wrap_Condition_unlock,
+                                static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_Condition_templ::InstanceMethod(
+                              "wait", &_exports_Condition_templ::_wrap_Condition_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwait");
+  members.insert({"timedwait", _exports_Condition_templ::InstanceMethod(
+                                   "timedwait", &_exports_Condition_templ::_wrap_Condition_timedwait,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("notifyOne");
+  members.insert({"notifyOne", _exports_Condition_templ::InstanceMethod(
+                                   "notifyOne", &_exports_Condition_templ::_wrap_Condition_notifyOne,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("notifyAll");
+  members.insert({"notifyAll", _exports_Condition_templ::InstanceMethod(
+                                   "notifyAll", &_exports_Condition_templ::_wrap_Condition_notifyAll,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("waiters");
+  members.insert({"waiters", _exports_Condition_templ::InstanceMethod(
+                                 "waiters", &_exports_Condition_templ::_wrap_Condition_waiters,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_Condition_templ::InstanceMethod(
+                              "refs", &_exports_Condition_templ::_wrap_Condition_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_Condition_templ::InstanceMethod(
+                               "close", &_exports_Condition_templ::_wrap_Condition_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive", &_exports_Condition_templ::_wrap_Condition_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_Condition_templ::_wrap_Condition_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_Condition_templ::_wrap_Condition_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_Condition_templ::_wrap_Condition_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_RecursiveMutex_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_RecursiveMutex_templ(const Napi::CallbackInfo &);
+  _exports_RecursiveMutex_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RecursiveMutex_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RecursiveMutex_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RecursiveMutex_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_RecursiveMutex_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RecursiveMutex_lock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RecursiveMutex_trylock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RecursiveMutex_unlock(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RecursiveMutex_lockCount(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RecursiveMutex_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_RecursiveMutex_close(const Napi::CallbackInfo &);
+  virtual ~_exports_RecursiveMutex_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                               const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                        const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_RecursiveMutex_inst : public _exports_RecursiveMutex_templ<_exports_RecursiveMutex_inst> {
+public:
+  using _exports_RecursiveMutex_templ::_exports_RecursiveMutex_templ;
+  virtual ~_exports_RecursiveMutex_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_RecursiveMutex_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_RecursiveMutex_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: RecursiveMutex (_exports_RecursiveMutex) */
+// jsnapi_getclass
+Napi::Function _exports_RecursiveMutex_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_RecursiveMutex_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_RecursiveMutex_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_RecursiveMutex_inst>::DefineClass(env, "RecursiveMutex", symbolTable);
+}
+
+void _exports_RecursiveMutex_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_RecursiveMutex_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_RecursiveMutex_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("lock");
+  members.insert({"lock", _exports_RecursiveMutex_templ::InstanceMethod(
+                              "lock", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_lock,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trylock");
+  members.insert({"trylock", _exports_RecursiveMutex_templ::InstanceMethod(
+                                 "trylock", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_trylock,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("unlock");
+  members.insert({"unlock", _exports_RecursiveMutex_templ::InstanceMethod(
+                                "unlock", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_unlock,
+                                static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("lockCount");
+  members.insert({"lockCount", _exports_RecursiveMutex_templ::InstanceMethod(
+                                   "lockCount", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_lockCount,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_RecursiveMutex_templ::InstanceMethod(
+                              "refs", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_RecursiveMutex_templ::InstanceMethod(
+                               "close", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive",
+                                       &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_RecursiveMutex_templ::_wrap_RecursiveMutex_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_SemaphoreArray_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreArray_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreArray_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreArray_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreArray_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreArray_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreArray_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_timedwait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_post(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_transfer(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_tryTransfer(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_timedTransfer(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_acquireAny(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_valueOf(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_size(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreArray_close(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreArray_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                               const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                        const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreArray_inst : public _exports_SemaphoreArray_templ<_exports_SemaphoreArray_inst> {
+public:
+  using _exports_SemaphoreArray_templ::_exports_SemaphoreArray_templ;
+  virtual ~_exports_SemaphoreArray_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreArray_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreArray_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreArray (_exports_SemaphoreArray) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreArray_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreArray_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreArray_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreArray_inst>::DefineClass(env, "SemaphoreArray", symbolTable);
+}
+
+void _exports_SemaphoreArray_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreArray_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreArray_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_SemaphoreArray_templ::InstanceMethod(
+                              "wait", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert({"trywait", _exports_SemaphoreArray_templ::InstanceMethod(
+                                 "trywait", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_trywait,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwait");
+  members.insert({"timedwait", _exports_SemaphoreArray_templ::InstanceMethod(
+                                   "timedwait", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_timedwait,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("post");
+  members.insert({"post", _exports_SemaphoreArray_templ::InstanceMethod(
+                              "post", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_post,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("transfer");
+  members.insert({"transfer", _exports_SemaphoreArray_templ::InstanceMethod(
+                                  "transfer", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_transfer,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("tryTransfer");
+  members.insert({"tryTransfer", _exports_SemaphoreArray_templ::InstanceMethod(
+                                     "tryTransfer", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_tryTransfer,
+                                     static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedTransfer");
+  members.insert(
+      {"timedTransfer", _exports_SemaphoreArray_templ::InstanceMethod(
+                            "timedTransfer", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_timedTransfer,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("acquireAny");
+  members.insert({"acquireAny", _exports_SemaphoreArray_templ::InstanceMethod(
+                                    "acquireAny", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_acquireAny,
+                                    static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("valueOf");
+  members.insert({"valueOf", _exports_SemaphoreArray_templ::InstanceMethod(
+                                 "valueOf", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_valueOf,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("size");
+  members.insert({"size", _exports_SemaphoreArray_templ::InstanceMethod(
+                              "size", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_size,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_SemaphoreArray_templ::InstanceMethod(
+                              "refs", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_SemaphoreArray_templ::InstanceMethod(
+                               "close", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive",
+                                       &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_SemaphoreArray_templ::_wrap_SemaphoreArray_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_SemaphoreSharded_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreSharded_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreSharded_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreSharded_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreSharded_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreSharded_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreSharded_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_wait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_wait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded__wrap_SemaphoreSharded_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_trywait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_trywait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded__wrap_SemaphoreSharded_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_timedwait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_post__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_post__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded__wrap_SemaphoreSharded_post(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_valueOf(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_capacity(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_shards(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_rebalance(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreSharded_close(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreSharded_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                                 const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                          const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreSharded_inst : public _exports_SemaphoreSharded_templ<_exports_SemaphoreSharded_inst> {
+public:
+  using _exports_SemaphoreSharded_templ::_exports_SemaphoreSharded_templ;
+  virtual ~_exports_SemaphoreSharded_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreSharded_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreSharded_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreSharded (_exports_SemaphoreSharded) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreSharded_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreSharded_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreSharded_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreSharded_inst>::DefineClass(env, "SemaphoreSharded", symbolTable);
+}
+
+void _exports_SemaphoreSharded_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreSharded_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreSharded_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert(
+      {"wait", _exports_SemaphoreSharded_templ::InstanceMethod(
+                   "wait", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded__wrap_SemaphoreSharded_wait,
+                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert(
+      {"trywait", _exports_SemaphoreSharded_templ::InstanceMethod(
+                      "trywait",
+                      &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded__wrap_SemaphoreSharded_trywait,
+                      static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("timedwait");
+  members.insert({"timedwait", _exports_SemaphoreSharded_templ::InstanceMethod(
+                                   "timedwait", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_timedwait,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("post");
+  members.insert(
+      {"post", _exports_SemaphoreSharded_templ::InstanceMethod(
+                   "post", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded__wrap_SemaphoreSharded_post,
+                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("valueOf");
+  members.insert({"valueOf", _exports_SemaphoreSharded_templ::InstanceMethod(
+                                 "valueOf", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_valueOf,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("capacity");
+  members.insert({"capacity", _exports_SemaphoreSharded_templ::InstanceMethod(
+                                  "capacity", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_capacity,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("shards");
+  members.insert({"shards", _exports_SemaphoreSharded_templ::InstanceMethod(
+                                "shards", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_shards,
+                                static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("rebalance");
+  members.insert({"rebalance", _exports_SemaphoreSharded_templ::InstanceMethod(
+                                   "rebalance", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_rebalance,
+                                   static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_SemaphoreSharded_templ::InstanceMethod(
+                              "refs", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_SemaphoreSharded_templ::InstanceMethod(
+                               "close", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive",
+                                       &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_SemaphoreSharded_templ::_wrap_SemaphoreSharded_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_SemaphoreNamespace_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_SemaphoreNamespace_templ(const Napi::CallbackInfo &);
+  _exports_SemaphoreNamespace_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreNamespace_createExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreNamespace_create(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreNamespace_open(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  static Napi::Value _wrap_SemaphoreNamespace_unlink(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreNamespace_createSemaphore(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreNamespace_createSemaphoreExclusive(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreNamespace_openSemaphore(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreNamespace_capacity(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreNamespace_used(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_SemaphoreNamespace_close(const Napi::CallbackInfo &);
+  virtual ~_exports_SemaphoreNamespace_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                                   const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                            const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_SemaphoreNamespace_inst : public _exports_SemaphoreNamespace_templ<_exports_SemaphoreNamespace_inst> {
+public:
+  using _exports_SemaphoreNamespace_templ::_exports_SemaphoreNamespace_templ;
+  virtual ~_exports_SemaphoreNamespace_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_SemaphoreNamespace_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_SemaphoreNamespace_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: SemaphoreNamespace (_exports_SemaphoreNamespace) */
+// jsnapi_getclass
+Napi::Function _exports_SemaphoreNamespace_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_SemaphoreNamespace_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_SemaphoreNamespace_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_SemaphoreNamespace_inst>::DefineClass(env, "SemaphoreNamespace", symbolTable);
+}
+
+void _exports_SemaphoreNamespace_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_SemaphoreNamespace_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_SemaphoreNamespace_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("createSemaphore");
+  members.insert(
+      {"createSemaphore", _exports_SemaphoreNamespace_templ::InstanceMethod(
+                              "createSemaphore",
+                              &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_createSemaphore,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("createSemaphoreExclusive");
+  members.insert(
+      {"createSemaphoreExclusive",
+       _exports_SemaphoreNamespace_templ::InstanceMethod(
+           "createSemaphoreExclusive",
+           &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_createSemaphoreExclusive,
+           static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("openSemaphore");
+  members.insert(
+      {"openSemaphore", _exports_SemaphoreNamespace_templ::InstanceMethod(
+                            "openSemaphore", &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_openSemaphore,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("capacity");
+  members.insert({"capacity", _exports_SemaphoreNamespace_templ::InstanceMethod(
+                                  "capacity", &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_capacity,
+                                  static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("used");
+  members.insert({"used", _exports_SemaphoreNamespace_templ::InstanceMethod(
+                              "used", &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_used,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_SemaphoreNamespace_templ::InstanceMethod(
+                               "close", &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+  // jsnapi_register_static_function
+  staticMembers.erase("createExclusive");
+  staticMembers.insert(
+      {"createExclusive", StaticMethod("createExclusive",
+                                       &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_createExclusive,
+                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("create");
+  staticMembers.insert(
+      {"create", StaticMethod("create", &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_create,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("open");
+  staticMembers.insert(
+      {"open", StaticMethod("open", &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_open,
+                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_register_static_function
+  staticMembers.erase("unlink");
+  staticMembers.insert(
+      {"unlink", StaticMethod("unlink", &_exports_SemaphoreNamespace_templ::_wrap_SemaphoreNamespace_unlink,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+}
+// jsnapi_class_prologue_template
+template <typename SWIG_OBJ_WRAP>
+class _exports_NamedSemaphore_templ : public SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP> {
+public:
+  _exports_NamedSemaphore_templ(const Napi::CallbackInfo &);
+  _exports_NamedSemaphore_templ(bool, const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_wait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_wait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore__wrap_NamedSemaphore_wait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_trywait__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_trywait__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore__wrap_NamedSemaphore_trywait(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_post__SWIG_0(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_post__SWIG_1(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore__wrap_NamedSemaphore_post(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_valueOf(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_refs(const Napi::CallbackInfo &);
+  // jsnapi_class_method_declaration
+  Napi::Value _wrap_NamedSemaphore_close(const Napi::CallbackInfo &);
+  virtual ~_exports_NamedSemaphore_templ();
+  // jsnapi_class_epilogue_template
+  static void JS_veto_set_static_variable(const Napi::CallbackInfo &, const Napi::Value &);
+  void JS_veto_set_variable(const Napi::CallbackInfo &, const Napi::Value &);
+};
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::JS_veto_set_static_variable(const Napi::CallbackInfo &info,
+                                                                               const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+
+template <typename SWIG_OBJ_WRAP>
+void _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::JS_veto_set_variable(const Napi::CallbackInfo &info,
+                                                                        const Napi::Value &value) {
+  SWIG_NAPI_Raise(info.Env(), "Tried to write read-only variable.");
+}
+// jsnapi_class_instance
+class _exports_NamedSemaphore_inst : public _exports_NamedSemaphore_templ<_exports_NamedSemaphore_inst> {
+public:
+  using _exports_NamedSemaphore_templ::_exports_NamedSemaphore_templ;
+  virtual ~_exports_NamedSemaphore_inst(){
+
+  };
+  static void GetMembers(Napi::Env, std::map<std::string, _exports_NamedSemaphore_templ::PropertyDescriptor> &,
+                         std::map<std::string, _exports_NamedSemaphore_templ::PropertyDescriptor> &);
+  static Napi::Function GetClass(Napi::Env);
+};
+/* Class: NamedSemaphore (_exports_NamedSemaphore) */
+// jsnapi_getclass
+Napi::Function _exports_NamedSemaphore_inst::GetClass(Napi::Env env) {
+  std::map<std::string, _exports_NamedSemaphore_templ::PropertyDescriptor> members, staticMembers;
+  GetMembers(env, members, staticMembers);
+
+  std::vector<_exports_NamedSemaphore_inst::PropertyDescriptor> symbolTable;
+  for (auto it = members.begin(); it != members.end(); it++)
+    symbolTable.push_back(it->second);
+  for (auto it = staticMembers.begin(); it != staticMembers.end(); it++)
+    symbolTable.push_back(it->second);
+
+  return Napi::ObjectWrap<_exports_NamedSemaphore_inst>::DefineClass(env, "NamedSemaphore", symbolTable);
+}
+
+void _exports_NamedSemaphore_inst::GetMembers(
+    Napi::Env env, std::map<std::string, _exports_NamedSemaphore_templ::PropertyDescriptor> &members,
+    std::map<std::string, _exports_NamedSemaphore_templ::PropertyDescriptor> &staticMembers) {
+  std::map<std::string, SWIG_NAPI_ObjectWrap_templ<SWIG_NAPI_ObjectWrap_inst>::PropertyDescriptor> baseMembers,
+      baseStaticMembers;
+  SWIG_NAPI_ObjectWrap_inst::GetMembers(env, baseMembers, baseStaticMembers);
+  members.insert(baseMembers.begin(), baseMembers.end());
+  staticMembers.insert(staticMembers.begin(), staticMembers.end());
+
+  /* register wrapper functions */
+  // jsnapi_member_function_descriptor
+  members.erase("wait");
+  members.insert({"wait", _exports_NamedSemaphore_templ::InstanceMethod(
+                              "wait", &_exports_NamedSemaphore_templ::_wrap_NamedSemaphore__wrap_NamedSemaphore_wait,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("trywait");
+  members.insert(
+      {"trywait", _exports_NamedSemaphore_templ::InstanceMethod(
+                      "trywait", &_exports_NamedSemaphore_templ::_wrap_NamedSemaphore__wrap_NamedSemaphore_trywait,
+                      static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("post");
+  members.insert({"post", _exports_NamedSemaphore_templ::InstanceMethod(
+                              "post", &_exports_NamedSemaphore_templ::_wrap_NamedSemaphore__wrap_NamedSemaphore_post,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("valueOf");
+  members.insert({"valueOf", _exports_NamedSemaphore_templ::InstanceMethod(
+                                 "valueOf", &_exports_NamedSemaphore_templ::_wrap_NamedSemaphore_valueOf,
+                                 static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("refs");
+  members.insert({"refs", _exports_NamedSemaphore_templ::InstanceMethod(
+                              "refs", &_exports_NamedSemaphore_templ::_wrap_NamedSemaphore_refs,
+                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  // jsnapi_member_function_descriptor
+  members.erase("close");
+  members.insert({"close", _exports_NamedSemaphore_templ::InstanceMethod(
+                               "close", &_exports_NamedSemaphore_templ::_wrap_NamedSemaphore_close,
+                               static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+
+  /* add static class functions and variables */
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token_key_set(const Napi::CallbackInfo &info,
+                                                              const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = (Token *)0;
+  key_t arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  void *argp2;
+  int res2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Token_key_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    {
+      res2 = SWIG_ConvertPtr(value, &argp2, SWIGTYPE_p_key_t, 0);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
+                                                 "Token_key_set"
+                                                 "', argument "
+                                                 "2"
+                                                 " of type '"
+                                                 "key_t"
+                                                 "'");
+      }
+      if (!argp2) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                             "in method '"
+                                             "Token_key_set"
+                                             "', argument "
+                                             "2"
+                                             " of type '"
+                                             "key_t"
+                                             "'");
+      } else {
+        arg2 = *(reinterpret_cast<key_t *>(argp2));
+      }
+    }
+  }
+  if (arg1)
+    (arg1)->key = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token_key_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = (Token *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  key_t result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Token_key_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  result = ((arg1)->key);
+  jsresult = SWIG_NewPointerObj((new key_t(result)), SWIGTYPE_p_key_t, SWIG_POINTER_OWN | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+template <typename SWIG_OBJ_WRAP>
+// js_ctor
+// This is the main constructor
+_exports_Token_templ<SWIG_OBJ_WRAP>::_exports_Token_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+
+  this->info = SWIGTYPE_p_Token;
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  this->owned = true;
+
+  char *arg1 = (char *)0;
+  char arg2;
+  int res1;
+  char *buf1 = 0;
+  int alloc1 = 0;
+  char val2;
+  int ecode2 = 0;
+  Token *result;
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_new_Token.");
+  }
+  res1 = SWIG_AsCharPtrAndSize(info[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "new_Token"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "char const *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<char *>(buf1);
+  ecode2 = SWIG_AsVal_char(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "new_Token"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "char"
+                                               "'");
+  }
+  arg2 = static_cast<char>(val2);
+  {
+    try {
+      result = (Token *)new Token((char const *)arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  if (alloc1 == SWIG_NEWOBJ)
+    delete[] buf1;
+
+  this->self = result;
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the bypass constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_Token_templ<SWIG_OBJ_WRAP>::_exports_Token_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token___ref__(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = (Token *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  key_t result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Token___ref__.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Token___ref__"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (arg1)->operator*();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj((new key_t(result)), SWIGTYPE_p_key_t, SWIG_POINTER_OWN | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token_valueOf(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = (Token *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Token_valueOf.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Token_valueOf"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (int)(arg1)->valueOf();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_Token_templ<SWIG_OBJ_WRAP>::~_exports_Token_templ() {
+  auto arg1 = reinterpret_cast<Token *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxSetSize_set(const Napi::CallbackInfo &info,
+                                                                                         const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxSetSize_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreLimits_maxSetSize_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->maxSetSize = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxSetSize_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxSetSize_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  result = (unsigned int)((arg1)->maxSetSize);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxSemaphores_set(
+    const Napi::CallbackInfo &info, const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxSemaphores_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreLimits_maxSemaphores_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->maxSemaphores = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxSemaphores_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxSemaphores_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  result = (unsigned int)((arg1)->maxSemaphores);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxOpsPerCall_set(
+    const Napi::CallbackInfo &info, const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxOpsPerCall_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreLimits_maxOpsPerCall_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->maxOpsPerCall = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxOpsPerCall_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxOpsPerCall_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  result = (unsigned int)((arg1)->maxOpsPerCall);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxSets_set(const Napi::CallbackInfo &info,
+                                                                                      const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxSets_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreLimits_maxSets_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->maxSets = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxSets_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxSets_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  result = (unsigned int)((arg1)->maxSets);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxValue_set(const Napi::CallbackInfo &info,
+                                                                                       const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxValue_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreLimits_maxValue_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->maxValue = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_maxValue_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_maxValue_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  result = (unsigned int)((arg1)->maxValue);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_setsInUse_set(const Napi::CallbackInfo &info,
+                                                                                        const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_setsInUse_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreLimits_setsInUse_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->setsInUse = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_setsInUse_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_setsInUse_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  result = (unsigned int)((arg1)->setsInUse);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_semaphoresInUse_set(
+    const Napi::CallbackInfo &info, const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_semaphoresInUse_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreLimits_semaphoresInUse_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->semaphoresInUse = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreLimits_semaphoresInUse_get(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits *arg1 = (SemaphoreLimits *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreLimits, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreLimits_semaphoresInUse_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreLimits *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreLimits *>(argp1);
+  result = (unsigned int)((arg1)->semaphoresInUse);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+template <typename SWIG_OBJ_WRAP>
+// js_ctor
+// This is the main constructor
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreLimits_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+
+  this->info = SWIGTYPE_p_SemaphoreLimits;
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  this->owned = true;
+
+  SemaphoreLimits *result;
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_new_SemaphoreLimits.");
+  }
+  {
+    try {
+      result = (SemaphoreLimits *)new SemaphoreLimits();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->self = result;
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the bypass constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreLimits_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreLimits_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreLimits_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreLimits *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_global_function
+Napi::Value _wrap_semaphoreLimits(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_semaphoreLimits.");
+  }
+
+  {
+    try {
+      result = semaphoreLimits();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj((new SemaphoreLimits(result)), SWIGTYPE_p_SemaphoreLimits, SWIG_POINTER_OWN | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_global_function
+Napi::Value _wrap_semaphoreMaxOpsPerCall(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_semaphoreMaxOpsPerCall.");
+  }
+
+  {
+    try {
+      result = (unsigned int)semaphoreMaxOpsPerCall();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_global_function
+Napi::Value _wrap_semaphoreMaxSetSize(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_semaphoreMaxSetSize.");
+  }
+
+  {
+    try {
+      result = (unsigned int)semaphoreMaxSetSize();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_key_set(const Napi::CallbackInfo &info,
+                                                                                    const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_key_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_key_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  if (arg1)
+    (arg1)->key = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_key_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_key_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (int)((arg1)->key);
+  jsresult = SWIG_From_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_id_set(const Napi::CallbackInfo &info,
+                                                                                   const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_id_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_id_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  if (arg1)
+    (arg1)->id = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_id_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_id_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (int)((arg1)->id);
+  jsresult = SWIG_From_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_owner_set(const Napi::CallbackInfo &info,
+                                                                                      const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_owner_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_owner_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->owner = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_owner_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_owner_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (unsigned int)((arg1)->owner);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_mode_set(const Napi::CallbackInfo &info,
+                                                                                     const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_mode_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_mode_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->mode = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_mode_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_mode_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (unsigned int)((arg1)->mode);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_nsems_set(const Napi::CallbackInfo &info,
+                                                                                      const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_nsems_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_nsems_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->nsems = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_nsems_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_nsems_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (unsigned int)((arg1)->nsems);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_otime_set(const Napi::CallbackInfo &info,
+                                                                                      const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  long long arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  long long val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_otime_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_otime_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "long long"
+                                               "'");
+  }
+  arg2 = static_cast<long long>(val2);
+  if (arg1)
+    (arg1)->otime = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_otime_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  long long result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_otime_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (long long)((arg1)->otime);
+  jsresult = SWIG_From_long_SS_long SWIG_NAPI_FROM_CALL_ARGS(static_cast<long long>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_ctime_set(const Napi::CallbackInfo &info,
+                                                                                      const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  long long arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  long long val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_ctime_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_long_SS_long(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_ctime_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "long long"
+                                               "'");
+  }
+  arg2 = static_cast<long long>(val2);
+  if (arg1)
+    (arg1)->ctime = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_ctime_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  long long result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_ctime_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (long long)((arg1)->ctime);
+  jsresult = SWIG_From_long_SS_long SWIG_NAPI_FROM_CALL_ARGS(static_cast<long long>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_values_set(const Napi::CallbackInfo &info,
+                                                                                       const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  std::vector<unsigned short> *arg2 = (std::vector<unsigned short> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  void *argp2 = 0;
+  int res2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_values_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  res2 = SWIG_ConvertPtr(value, &argp2, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
+                                             "SemaphoreSetInfo_values_set"
+                                             "', argument "
+                                             "2"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg2 = reinterpret_cast<std::vector<unsigned short> *>(argp2);
+  if (arg1)
+    (arg1)->values = *arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_values_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<unsigned short> *result = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_values_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (std::vector<unsigned short> *)&((arg1)->values);
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_refs_set(const Napi::CallbackInfo &info,
+                                                                                     const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_refs_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_refs_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->refs = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_refs_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_refs_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (unsigned int)((arg1)->refs);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_waitingToDecrement_set(
+    const Napi::CallbackInfo &info, const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_waitingToDecrement_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_waitingToDecrement_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->waitingToDecrement = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_waitingToDecrement_get(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_waitingToDecrement_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (unsigned int)((arg1)->waitingToDecrement);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_setter
+template <typename SWIG_OBJ_WRAP>
+void _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_waitingForZero_set(
+    const Napi::CallbackInfo &info, const Napi::Value &value) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_waitingForZero_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(value, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfo_waitingForZero_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  if (arg1)
+    (arg1)->waitingForZero = arg2;
+
+  return;
+
+  goto fail;
+fail:
+  return;
+}
+
+// js_getter
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfo_waitingForZero_get(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSetInfo *arg1 = (SemaphoreSetInfo *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfo_waitingForZero_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSetInfo *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSetInfo *>(argp1);
+  result = (unsigned int)((arg1)->waitingForZero);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+template <typename SWIG_OBJ_WRAP>
+// js_ctor
+// This is the main constructor
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreSetInfo_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+
+  this->info = SWIGTYPE_p_SemaphoreSetInfo;
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  this->owned = true;
+
+  SemaphoreSetInfo *result;
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_new_SemaphoreSetInfo.");
+  }
+  {
+    try {
+      result = (SemaphoreSetInfo *)new SemaphoreSetInfo();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->self = result;
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the bypass constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreSetInfo_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreSetInfo_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreSetInfo_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreSetInfo *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_global_function
+Napi::Value _wrap_semaphoreList(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_semaphoreList.");
+  }
+
+  {
+    try {
+      result = semaphoreList();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj((new std::vector<SemaphoreSetInfo>(result)), SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t,
+                                SWIG_POINTER_OWN | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_new_UnsignedShortList__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<unsigned short> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_unsigned_short_t;
+  {
+    try {
+      result = (std::vector<unsigned short> *)new std::vector<unsigned short>();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_new_UnsignedShortList__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<unsigned short>::size_type arg1;
+  size_t val1;
+  int ecode1 = 0;
+  std::vector<unsigned short> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_unsigned_short_t;
+  ecode1 = SWIG_AsVal_size_t(info[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '"
+                                               "new_UnsignedShortList"
+                                               "', argument "
+                                               "1"
+                                               " of type '"
+                                               "std::vector< unsigned short >::size_type"
+                                               "'");
+  }
+  arg1 = static_cast<std::vector<unsigned short>::size_type>(val1);
+  {
+    try {
+      result = (std::vector<unsigned short> *)new std::vector<unsigned short>(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_new_UnsignedShortList__SWIG_2(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<unsigned short> *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<unsigned short> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_unsigned_short_t;
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "new_UnsignedShortList"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > const &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "new_UnsignedShortList"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "std::vector< unsigned short > const &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  {
+    try {
+      result = (std::vector<unsigned short> *)new std::vector<unsigned short>(
+          (std::vector<unsigned short> const &)*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_ctor_dispatcher
+template <typename SWIG_OBJ_WRAP>
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_exports_UnsignedShortList_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_unsigned_short_t;
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+
+  // switch all cases by means of series of if-returns.
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_UnsignedShortList__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_UnsignedShortList__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_UnsignedShortList__SWIG_2(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_UnsignedShortList__SWIG_2(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_UnsignedShortList__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_UnsignedShortList__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // default:
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for construction of _exports_UnsignedShortList");
+
+  goto fail;
+fail:
+  return;
+}
+
+// This is the bypass constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_exports_UnsignedShortList_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_size(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<unsigned short>::size_type result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_size.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_size"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  {
+    try {
+      result = (std::vector<unsigned short>::size_type)(arg1)->size();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_size_t SWIG_NAPI_FROM_CALL_ARGS(static_cast<size_t>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_capacity(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<unsigned short>::size_type result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_capacity.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_capacity"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  {
+    try {
+      result = (std::vector<unsigned short>::size_type)(arg1)->capacity();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_size_t SWIG_NAPI_FROM_CALL_ARGS(static_cast<size_t>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_reserve(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  std::vector<unsigned short>::size_type arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  size_t val2;
+  int ecode2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_reserve.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_reserve"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  ecode2 = SWIG_AsVal_size_t(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "UnsignedShortList_reserve"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "std::vector< unsigned short >::size_type"
+                                               "'");
+  }
+  arg2 = static_cast<std::vector<unsigned short>::size_type>(val2);
+  {
+    try {
+      (arg1)->reserve(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_isEmpty(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_isEmpty.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_isEmpty"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->empty();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_clear(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_clear.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_clear"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  {
+    try {
+      (arg1)->clear();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_add(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  std::vector<unsigned short>::value_type *arg2 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<unsigned short>::value_type temp2;
+  unsigned short val2;
+  int ecode2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_add.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_add"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_short(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "UnsignedShortList_add"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "std::vector< unsigned short >::value_type const &"
+                                               "'");
+  }
+  temp2 = static_cast<std::vector<unsigned short>::value_type>(val2);
+  arg2 = &temp2;
+  {
+    try {
+      (arg1)->push_back((std::vector<unsigned short>::value_type const &)*arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  std::vector<unsigned short>::value_type *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_get.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "UnsignedShortList_get"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      try {
+        result = (std::vector<unsigned short>::value_type *)&std_vector_Sl_unsigned_SS_short_Sg__get(arg1, arg2);
+      } catch (std::out_of_range &_e) {
+        SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+      }
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_short SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned short>(*result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::_wrap_UnsignedShortList_set(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<unsigned short> *arg1 = (std::vector<unsigned short> *)0;
+  int arg2;
+  std::vector<unsigned short>::value_type *arg3 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  std::vector<unsigned short>::value_type temp3;
+  unsigned short val3;
+  int ecode3 = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_UnsignedShortList_set.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_unsigned_short_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "UnsignedShortList_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< unsigned short > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<unsigned short> *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "UnsignedShortList_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_short(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "UnsignedShortList_set"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "std::vector< unsigned short >::value_type const &"
+                                               "'");
+  }
+  temp3 = static_cast<std::vector<unsigned short>::value_type>(val3);
+  arg3 = &temp3;
+  {
+    try {
+      try {
+        std_vector_Sl_unsigned_SS_short_Sg__set(arg1, arg2, (std::vector<unsigned short>::value_type const &)*arg3);
+      } catch (std::out_of_range &_e) {
+        SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+      }
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_UnsignedShortList_templ<SWIG_OBJ_WRAP>::~_exports_UnsignedShortList_templ() {
+  auto arg1 = reinterpret_cast<std::vector<unsigned short> *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_new_SemaphoreSetInfoList__SWIG_0(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<SemaphoreSetInfo> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t;
+  {
+    try {
+      result = (std::vector<SemaphoreSetInfo> *)new std::vector<SemaphoreSetInfo>();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_new_SemaphoreSetInfoList__SWIG_1(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<SemaphoreSetInfo>::size_type arg1;
+  size_t val1;
+  int ecode1 = 0;
+  std::vector<SemaphoreSetInfo> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t;
+  ecode1 = SWIG_AsVal_size_t(info[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '"
+                                               "new_SemaphoreSetInfoList"
+                                               "', argument "
+                                               "1"
+                                               " of type '"
+                                               "std::vector< SemaphoreSetInfo >::size_type"
+                                               "'");
+  }
+  arg1 = static_cast<std::vector<SemaphoreSetInfo>::size_type>(val1);
+  {
+    try {
+      result = (std::vector<SemaphoreSetInfo> *)new std::vector<SemaphoreSetInfo>(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_new_SemaphoreSetInfoList__SWIG_2(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<SemaphoreSetInfo> *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<SemaphoreSetInfo> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t;
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "new_SemaphoreSetInfoList"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > const &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "new_SemaphoreSetInfoList"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "std::vector< SemaphoreSetInfo > const &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  {
+    try {
+      result = (std::vector<SemaphoreSetInfo> *)new std::vector<SemaphoreSetInfo>(
+          (std::vector<SemaphoreSetInfo> const &)*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_ctor_dispatcher
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreSetInfoList_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t;
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+
+  // switch all cases by means of series of if-returns.
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_SemaphoreSetInfoList__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_SemaphoreSetInfoList__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_SemaphoreSetInfoList__SWIG_2(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_SemaphoreSetInfoList__SWIG_2(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_SemaphoreSetInfoList__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_SemaphoreSetInfoList__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // default:
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for construction of _exports_SemaphoreSetInfoList");
+
+  goto fail;
+fail:
+  return;
+}
+
+// This is the bypass constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreSetInfoList_templ(bool,
+                                                                                        const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_size(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<SemaphoreSetInfo>::size_type result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_size.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_size"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  {
+    try {
+      result = (std::vector<SemaphoreSetInfo>::size_type)(arg1)->size();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_size_t SWIG_NAPI_FROM_CALL_ARGS(static_cast<size_t>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_capacity(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<SemaphoreSetInfo>::size_type result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_capacity.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_capacity"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  {
+    try {
+      result = (std::vector<SemaphoreSetInfo>::size_type)(arg1)->capacity();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_size_t SWIG_NAPI_FROM_CALL_ARGS(static_cast<size_t>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_reserve(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  std::vector<SemaphoreSetInfo>::size_type arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  size_t val2;
+  int ecode2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_reserve.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_reserve"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  ecode2 = SWIG_AsVal_size_t(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfoList_reserve"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "std::vector< SemaphoreSetInfo >::size_type"
+                                               "'");
+  }
+  arg2 = static_cast<std::vector<SemaphoreSetInfo>::size_type>(val2);
+  {
+    try {
+      (arg1)->reserve(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_isEmpty(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_isEmpty.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_isEmpty"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->empty();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_clear(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_clear.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_clear"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  {
+    try {
+      (arg1)->clear();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_add(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  std::vector<SemaphoreSetInfo>::value_type *arg2 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  void *argp2 = 0;
+  int res2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_add.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_add"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  res2 = SWIG_ConvertPtr(info[0], &argp2, SWIGTYPE_p_SemaphoreSetInfo, 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
+                                             "SemaphoreSetInfoList_add"
+                                             "', argument "
+                                             "2"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo >::value_type const &"
+                                             "'");
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreSetInfoList_add"
+                                         "', argument "
+                                         "2"
+                                         " of type '"
+                                         "std::vector< SemaphoreSetInfo >::value_type const &"
+                                         "'");
+  }
+  arg2 = reinterpret_cast<std::vector<SemaphoreSetInfo>::value_type *>(argp2);
+  {
+    try {
+      (arg1)->push_back((std::vector<SemaphoreSetInfo>::value_type const &)*arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  std::vector<SemaphoreSetInfo>::value_type *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_get.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfoList_get"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      try {
+        result = (std::vector<SemaphoreSetInfo>::value_type *)&std_vector_Sl_SemaphoreSetInfo_Sg__get(arg1, arg2);
+      } catch (std::out_of_range &_e) {
+        SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+      }
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreSetInfo, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSetInfoList_set(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> *arg1 = (std::vector<SemaphoreSetInfo> *)0;
+  int arg2;
+  std::vector<SemaphoreSetInfo>::value_type *arg3 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  void *argp3 = 0;
+  int res3 = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSetInfoList_set.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSetInfoList_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSetInfoList_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  res3 = SWIG_ConvertPtr(info[1], &argp3, SWIGTYPE_p_SemaphoreSetInfo, 0);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '"
+                                             "SemaphoreSetInfoList_set"
+                                             "', argument "
+                                             "3"
+                                             " of type '"
+                                             "std::vector< SemaphoreSetInfo >::value_type const &"
+                                             "'");
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreSetInfoList_set"
+                                         "', argument "
+                                         "3"
+                                         " of type '"
+                                         "std::vector< SemaphoreSetInfo >::value_type const &"
+                                         "'");
+  }
+  arg3 = reinterpret_cast<std::vector<SemaphoreSetInfo>::value_type *>(argp3);
+  {
+    try {
+      try {
+        std_vector_Sl_SemaphoreSetInfo_Sg__set(arg1, arg2, (std::vector<SemaphoreSetInfo>::value_type const &)*arg3);
+      } catch (std::out_of_range &_e) {
+        SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+      }
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreSetInfoList_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreSetInfoList_templ() {
+  auto arg1 = reinterpret_cast<std::vector<SemaphoreSetInfo> *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  int val3;
+  int ecode3 = 0;
+  SemaphoreV *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreV_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreV_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg3 = static_cast<int>(val3);
+  {
+    try {
+      result = (SemaphoreV *)SemaphoreV::createExclusive(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreV, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  int val3;
+  int ecode3 = 0;
+  SemaphoreV *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreV_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreV_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg3 = static_cast<int>(val3);
+  {
+    try {
+      result = (SemaphoreV *)SemaphoreV::create(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreV, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  SemaphoreV *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreV_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (SemaphoreV *)SemaphoreV::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreV, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreV_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      SemaphoreV::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_acquireAny(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = 0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  int result;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_acquireAny.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_acquireAny"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > const &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreV_acquireAny"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "std::vector< SemaphoreV * > const &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_acquireAny"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (int)SemaphoreV::acquireAny((std::vector<SemaphoreV *> const &)*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_limits(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreLimits result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_limits.");
+  }
+
+  {
+    try {
+      result = SemaphoreV::limits();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj((new SemaphoreLimits(result)), SWIGTYPE_p_SemaphoreLimits, SWIG_POINTER_OWN | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_list(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreSetInfo> result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_list.");
+  }
+
+  {
+    try {
+      result = SemaphoreV::list();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj((new std::vector<SemaphoreSetInfo>(result)), SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t,
+                                SWIG_POINTER_OWN | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_reap__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  unsigned int arg1;
+  unsigned int arg2;
+  unsigned int arg3;
+  unsigned int val1;
+  int ecode1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  unsigned int result;
+
+  ecode1 = SWIG_AsVal_unsigned_SS_int(info[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '"
+                                               "SemaphoreV_reap"
+                                               "', argument "
+                                               "1"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg1 = static_cast<unsigned int>(val1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_reap"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreV_reap"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (unsigned int)SemaphoreV::reap(arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_reap__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_reap"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreV_reap"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_reap"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)SemaphoreV::reap(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_reap(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 2 && static_cast<int>(info.Length()) <= 2) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_reap__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_reap__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 3 && static_cast<int>(info.Length()) <= 3) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_reap__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_reap__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function reap.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_wait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_wait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_wait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->wait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_wait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_wait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_wait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_wait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function wait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_trywait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trywait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_trywait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_trywait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->trywait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_trywait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_trywait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_trywait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_trywait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_trywait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function trywait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_timedwait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_timedwait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_timedwait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_timedwait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreV_timedwait"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (bool)(arg1)->timedwait(arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_post__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      (arg1)->post();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_post__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_post"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->post(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_post(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_post__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_post__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_post__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_post__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function post.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_postWaiters__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_postWaiters"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->postWaiters();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_postWaiters__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_postWaiters"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_postWaiters"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (unsigned int)(arg1)->postWaiters(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_postWaiters(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_postWaiters__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_postWaiters__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreV_postWaiters__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreV_postWaiters__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function postWaiters.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_waitZero(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_waitZero.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_waitZero"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      (arg1)->waitZero();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_tryWaitZero(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_tryWaitZero.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_tryWaitZero"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->tryWaitZero();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_timedWaitZero(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_timedWaitZero.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_timedWaitZero"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_timedWaitZero"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->timedWaitZero(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_waitAvailable(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_waitAvailable.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_waitAvailable"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_waitAvailable"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->waitAvailable(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_tryWaitAvailable(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_tryWaitAvailable.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_tryWaitAvailable"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_tryWaitAvailable"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->tryWaitAvailable(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_timedWaitAvailable(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_timedWaitAvailable.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_timedWaitAvailable"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_timedWaitAvailable"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreV_timedWaitAvailable"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (bool)(arg1)->timedWaitAvailable(arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_drain(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_drain.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_drain"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreV_drain"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (unsigned int)(arg1)->drain(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_valueOf(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_valueOf.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_valueOf"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->valueOf();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreV *arg1 = (SemaphoreV *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreV_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreV *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreV_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreV *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreV_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class SemaphoreV can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreV_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_new_SemaphoreVList__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<SemaphoreV *> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreV_p_t;
+  {
+    try {
+      result = (std::vector<SemaphoreV *> *)new std::vector<SemaphoreV *>();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_new_SemaphoreVList__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<SemaphoreV *>::size_type arg1;
+  size_t val1;
+  int ecode1 = 0;
+  std::vector<SemaphoreV *> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreV_p_t;
+  ecode1 = SWIG_AsVal_size_t(info[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '"
+                                               "new_SemaphoreVList"
+                                               "', argument "
+                                               "1"
+                                               " of type '"
+                                               "std::vector< SemaphoreV * >::size_type"
+                                               "'");
+  }
+  arg1 = static_cast<std::vector<SemaphoreV *>::size_type>(val1);
+  {
+    try {
+      result = (std::vector<SemaphoreV *> *)new std::vector<SemaphoreV *>(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_ctor
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_new_SemaphoreVList__SWIG_2(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  std::vector<SemaphoreV *> *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<SemaphoreV *> *result;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreV_p_t;
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "new_SemaphoreVList"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > const &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "new_SemaphoreVList"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "std::vector< SemaphoreV * > const &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  {
+    try {
+      result = (std::vector<SemaphoreV *> *)new std::vector<SemaphoreV *>((std::vector<SemaphoreV *> const &)*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+
+  this->owned = true;
+  this->self = result;
+  return env.Undefined();
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_ctor_dispatcher
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreVList_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  Napi::Object self;
+  NAPI_CHECK_RESULT(info.This().ToObject(), self);
+  this->info = SWIGTYPE_p_std__vectorT_SemaphoreV_p_t;
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+
+  // switch all cases by means of series of if-returns.
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_SemaphoreVList__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_SemaphoreVList__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_SemaphoreVList__SWIG_2(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_SemaphoreVList__SWIG_2(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // js_ctor_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      _wrap_new_SemaphoreVList__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return;
+#else
+    _wrap_new_SemaphoreVList__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return;
+    }
+#endif
+  }
+
+  // default:
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for construction of _exports_SemaphoreVList");
+
+  goto fail;
+fail:
+  return;
+}
+
+// This is the bypass constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreVList_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_size(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<SemaphoreV *>::size_type result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_size.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_size"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  {
+    try {
+      result = (std::vector<SemaphoreV *>::size_type)(arg1)->size();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_size_t SWIG_NAPI_FROM_CALL_ARGS(static_cast<size_t>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_capacity(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<SemaphoreV *>::size_type result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_capacity.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_capacity"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  {
+    try {
+      result = (std::vector<SemaphoreV *>::size_type)(arg1)->capacity();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_size_t SWIG_NAPI_FROM_CALL_ARGS(static_cast<size_t>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_reserve(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  std::vector<SemaphoreV *>::size_type arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  size_t val2;
+  int ecode2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_reserve.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_reserve"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  ecode2 = SWIG_AsVal_size_t(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreVList_reserve"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "std::vector< SemaphoreV * >::size_type"
+                                               "'");
+  }
+  arg2 = static_cast<std::vector<SemaphoreV *>::size_type>(val2);
+  {
+    try {
+      (arg1)->reserve(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_isEmpty(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_isEmpty.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_isEmpty"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->empty();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_clear(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_clear.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_clear"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  {
+    try {
+      (arg1)->clear();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_add(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  std::vector<SemaphoreV *>::value_type *arg2 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  std::vector<SemaphoreV *>::value_type temp2 = 0;
+  void *argp2 = 0;
+  int res2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_add.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_add"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  res2 = SWIG_ConvertPtr(info[0], &argp2, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
+                                             "SemaphoreVList_add"
+                                             "', argument "
+                                             "2"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * >::value_type const &"
+                                             "'");
+  }
+  temp2 = reinterpret_cast<std::vector<SemaphoreV *>::value_type>(argp2);
+  arg2 = reinterpret_cast<std::vector<SemaphoreV *>::value_type *>(&temp2);
+  {
+    try {
+      (arg1)->push_back((std::vector<SemaphoreV *>::value_type const &)*arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_get(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  std::vector<SemaphoreV *>::value_type *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_get.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_get"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreVList_get"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      try {
+        result = (std::vector<SemaphoreV *>::value_type *)&std_vector_Sl_SemaphoreV_Sm__Sg__get(arg1, arg2);
+      } catch (std::out_of_range &_e) {
+        SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+      }
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(*result), SWIGTYPE_p_SemaphoreV, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreVList_set(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  std::vector<SemaphoreV *> *arg1 = (std::vector<SemaphoreV *> *)0;
+  int arg2;
+  std::vector<SemaphoreV *>::value_type *arg3 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  std::vector<SemaphoreV *>::value_type temp3 = 0;
+  void *argp3 = 0;
+  int res3 = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreVList_set.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_std__vectorT_SemaphoreV_p_t, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreVList_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * > *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreVList_set"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  res3 = SWIG_ConvertPtr(info[1], &argp3, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '"
+                                             "SemaphoreVList_set"
+                                             "', argument "
+                                             "3"
+                                             " of type '"
+                                             "std::vector< SemaphoreV * >::value_type const &"
+                                             "'");
+  }
+  temp3 = reinterpret_cast<std::vector<SemaphoreV *>::value_type>(argp3);
+  arg3 = reinterpret_cast<std::vector<SemaphoreV *>::value_type *>(&temp3);
+  {
+    try {
+      try {
+        std_vector_Sl_SemaphoreV_Sm__Sg__set(arg1, arg2, (std::vector<SemaphoreV *>::value_type const &)*arg3);
+      } catch (std::out_of_range &_e) {
+        SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+      }
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreVList_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreVList_templ() {
+  auto arg1 = reinterpret_cast<std::vector<SemaphoreV *> *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  unsigned int arg1;
+  unsigned int val1;
+  int ecode1 = 0;
+  SemaphoreE *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreE_create.");
+  }
+
+  ecode1 = SWIG_AsVal_unsigned_SS_int(info[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '"
+                                               "SemaphoreE_create"
+                                               "', argument "
+                                               "1"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg1 = static_cast<unsigned int>(val1);
+  {
+    try {
+      result = (SemaphoreE *)SemaphoreE::create(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreE, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_fromFd(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  int arg1;
+  int val1;
+  int ecode1 = 0;
+  SemaphoreE *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreE_fromFd.");
+  }
+
+  ecode1 = SWIG_AsVal_int(info[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '"
+                                               "SemaphoreE_fromFd"
+                                               "', argument "
+                                               "1"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg1 = static_cast<int>(val1);
+  {
+    try {
+      result = (SemaphoreE *)SemaphoreE::fromFd(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreE, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_receive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  int arg1;
+  int val1;
+  int ecode1 = 0;
+  SemaphoreE *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreE_receive.");
+  }
+
+  ecode1 = SWIG_AsVal_int(info[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '"
+                                               "SemaphoreE_receive"
+                                               "', argument "
+                                               "1"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg1 = static_cast<int>(val1);
+  {
+    try {
+      result = (SemaphoreE *)SemaphoreE::receive(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreE, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_wait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_wait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreE_wait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->wait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE__wrap_SemaphoreE_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_wait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_wait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_wait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_wait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function wait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_trywait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trywait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_trywait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreE_trywait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->trywait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE__wrap_SemaphoreE_trywait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_trywait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_trywait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_trywait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_trywait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function trywait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_post__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  {
+    try {
+      (arg1)->post();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_post__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreE_post"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->post(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE__wrap_SemaphoreE_post(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_post__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_post__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_post__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_post__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function post.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_valueOf(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreE_valueOf.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_valueOf"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->valueOf();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_fd(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreE_fd.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_fd"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  {
+    try {
+      result = (int)(arg1)->fd();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_send(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreE_send.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_send"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreE_send"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      (arg1)->send(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_waitAsync__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  napi_env arg2 = (napi_env)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  napi_value result = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_waitAsync"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  arg2 = info.Env();
+  {
+    try {
+      result = (napi_value)SemaphoreE_waitAsync__SWIG_0(arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = Napi::Value(env, result);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_waitAsync__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  napi_env arg2 = (napi_env)0;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  napi_value result = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_waitAsync"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  arg2 = info.Env();
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[0], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreE_waitAsync"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (napi_value)SemaphoreE_waitAsync__SWIG_1(arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = Napi::Value(env, result);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE__wrap_SemaphoreE_waitAsync(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_waitAsync__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_waitAsync__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreE_waitAsync__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreE_waitAsync__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function waitAsync.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreE_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreE *arg1 = (SemaphoreE *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreE_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreE, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreE_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreE *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreE *>(argp1);
+  {
+    try {
+      SemaphoreE_cancelAndClose(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreE_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreE *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreE_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class SemaphoreE can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreE_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreE_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  int val3;
+  int ecode3 = 0;
+  SemaphoreP *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreP_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreP_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreP_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreP_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg3 = static_cast<int>(val3);
+  {
+    try {
+      result = (SemaphoreP *)SemaphoreP::createExclusive(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreP, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  int val3;
+  int ecode3 = 0;
+  SemaphoreP *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreP_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreP_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreP_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreP_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg3 = static_cast<int>(val3);
+  {
+    try {
+      result = (SemaphoreP *)SemaphoreP::create(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreP, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  SemaphoreP *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreP_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreP_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (SemaphoreP *)SemaphoreP::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreP, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreP_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreP_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      SemaphoreP::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_wait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_wait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreP_wait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->wait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP__wrap_SemaphoreP_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreP_wait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreP_wait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreP_wait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreP_wait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function wait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_trywait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trywait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_trywait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreP_trywait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->trywait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP__wrap_SemaphoreP_trywait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreP_trywait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreP_trywait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreP_trywait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreP_trywait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function trywait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_post__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  {
+    try {
+      (arg1)->post();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_post__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreP_post"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->post(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP__wrap_SemaphoreP_post(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreP_post__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreP_post__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreP_post__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreP_post__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function post.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_valueOf(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreP_valueOf.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_valueOf"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->valueOf();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreP_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreP_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreP *arg1 = (SemaphoreP *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreP_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreP, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreP_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreP *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreP *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreP_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreP *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreP_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class SemaphoreP can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreP_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreP_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  int val3;
+  int ecode3 = 0;
+  SemaphoreF *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreF_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreF_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreF_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg3 = static_cast<int>(val3);
+  {
+    try {
+      result = (SemaphoreF *)SemaphoreF::createExclusive(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreF, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  int val3;
+  int ecode3 = 0;
+  SemaphoreF *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreF_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreF_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreF_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg3 = static_cast<int>(val3);
+  {
+    try {
+      result = (SemaphoreF *)SemaphoreF::create(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreF, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  SemaphoreF *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreF_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (SemaphoreF *)SemaphoreF::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreF, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreF_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      SemaphoreF::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_uringAvailable(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_uringAvailable.");
+  }
+
+  {
+    try {
+      result = (bool)SemaphoreF::uringAvailable();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_wait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_wait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreF_wait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->wait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF__wrap_SemaphoreF_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreF_wait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreF_wait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreF_wait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreF_wait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function wait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_trywait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trywait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_trywait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreF_trywait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->trywait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF__wrap_SemaphoreF_trywait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreF_trywait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreF_trywait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreF_trywait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreF_trywait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function trywait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_post__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  {
+    try {
+      (arg1)->post();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_post__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreF_post"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->post(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF__wrap_SemaphoreF_post(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreF_post__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreF_post__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreF_post__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreF_post__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function post.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_valueOf(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_valueOf.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_valueOf"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->valueOf();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_isFutex(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_isFutex.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_isFutex"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->isFutex();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_waitAsync(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  napi_env arg2 = (napi_env)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  napi_value result = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_waitAsync.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_waitAsync"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  arg2 = info.Env();
+  {
+    try {
+      result = (napi_value)SemaphoreF_waitAsync(arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = Napi::Value(env, result);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreF_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreF *arg1 = (SemaphoreF *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreF_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreF, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreF_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreF *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreF *>(argp1);
+  {
+    try {
+      SemaphoreF_cancelAndClose(arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreF_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreF *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreF_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class SemaphoreF can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreF_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreF_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  CountdownLatch *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "CountdownLatch_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "CountdownLatch_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "CountdownLatch_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (CountdownLatch *)CountdownLatch::createExclusive(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_CountdownLatch, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  CountdownLatch *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "CountdownLatch_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "CountdownLatch_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "CountdownLatch_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (CountdownLatch *)CountdownLatch::create(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_CountdownLatch, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  CountdownLatch *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "CountdownLatch_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (CountdownLatch *)CountdownLatch::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_CountdownLatch, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "CountdownLatch_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      CountdownLatch::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_countDown__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_countDown"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  {
+    try {
+      (arg1)->countDown();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_countDown__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_countDown"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "CountdownLatch_countDown"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->countDown(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch__wrap_CountdownLatch_countDown(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_CountdownLatch_countDown__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_CountdownLatch_countDown__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_CountdownLatch_countDown__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_CountdownLatch_countDown__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function countDown.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_wait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_trywait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_trywait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trywait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_timedwait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_timedwait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_timedwait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "CountdownLatch_timedwait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->timedwait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_count(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_count.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_count"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->count();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_wrap_CountdownLatch_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  CountdownLatch *arg1 = (CountdownLatch *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_CountdownLatch_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_CountdownLatch, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "CountdownLatch_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "CountdownLatch *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<CountdownLatch *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::~_exports_CountdownLatch_templ() {
+  auto arg1 = reinterpret_cast<CountdownLatch *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_exports_CountdownLatch_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class CountdownLatch can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_CountdownLatch_templ<SWIG_OBJ_WRAP>::_exports_CountdownLatch_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  Barrier *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Barrier_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Barrier_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "Barrier_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (Barrier *)Barrier::createExclusive(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Barrier, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  Barrier *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Barrier_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Barrier_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "Barrier_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (Barrier *)Barrier::create(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Barrier, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  Barrier *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Barrier_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (Barrier *)Barrier::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Barrier, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Barrier_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      Barrier::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_wait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_timedwait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_timedwait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_timedwait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Barrier_timedwait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->timedwait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_arrive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_arrive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_arrive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->arrive();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_passed(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_passed.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_passed"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Barrier_passed"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->passed(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_timedwaitFor(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_timedwaitFor.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_timedwaitFor"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Barrier_timedwaitFor"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "Barrier_timedwaitFor"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (bool)(arg1)->timedwaitFor(arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_parties(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_parties.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_parties"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->parties();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_arrived(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_arrived.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_arrived"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->arrived();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_isBroken(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_isBroken.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_isBroken"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->isBroken();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_reset(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_reset.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_reset"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      (arg1)->reset();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Barrier_templ<SWIG_OBJ_WRAP>::_wrap_Barrier_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Barrier *arg1 = (Barrier *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Barrier_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Barrier, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Barrier_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Barrier *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Barrier *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_Barrier_templ<SWIG_OBJ_WRAP>::~_exports_Barrier_templ() {
+  auto arg1 = reinterpret_cast<Barrier *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_Barrier_templ<SWIG_OBJ_WRAP>::_exports_Barrier_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class Barrier can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_Barrier_templ<SWIG_OBJ_WRAP>::_exports_Barrier_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  RwLock *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RwLock_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "RwLock_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      result = (RwLock *)RwLock::createExclusive(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RwLock, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  RwLock *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RwLock_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "RwLock_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      result = (RwLock *)RwLock::create(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RwLock, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  RwLock *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RwLock_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (RwLock *)RwLock::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RwLock, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RwLock_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      RwLock::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_readLock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_readLock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_readLock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      (arg1)->readLock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_tryReadLock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_tryReadLock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_tryReadLock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->tryReadLock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_timedReadLock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_timedReadLock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_timedReadLock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "RwLock_timedReadLock"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->timedReadLock(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_readUnlock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_readUnlock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_readUnlock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      (arg1)->readUnlock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_writeLock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_writeLock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_writeLock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      (arg1)->writeLock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_tryWriteLock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_tryWriteLock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_tryWriteLock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->tryWriteLock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_timedWriteLock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_timedWriteLock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_timedWriteLock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "RwLock_timedWriteLock"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->timedWriteLock(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_writeUnlock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_writeUnlock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_writeUnlock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      (arg1)->writeUnlock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_readers(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_readers.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_readers"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->readers();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_writersWaiting(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_writersWaiting.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_writersWaiting"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->writersWaiting();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_isWriteLocked(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_isWriteLocked.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_isWriteLocked"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->isWriteLocked();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RwLock_templ<SWIG_OBJ_WRAP>::_wrap_RwLock_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RwLock *arg1 = (RwLock *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RwLock_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RwLock, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RwLock_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RwLock *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RwLock *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_RwLock_templ<SWIG_OBJ_WRAP>::~_exports_RwLock_templ() {
+  auto arg1 = reinterpret_cast<RwLock *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_RwLock_templ<SWIG_OBJ_WRAP>::_exports_RwLock_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class RwLock can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_RwLock_templ<SWIG_OBJ_WRAP>::_exports_RwLock_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  bool arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  bool val3;
+  int ecode3 = 0;
+  Event *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Event_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Event_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_bool(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "Event_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "bool"
+                                               "'");
+  }
+  arg3 = static_cast<bool>(val3);
+  {
+    try {
+      result = (Event *)Event::createExclusive(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Event, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  bool arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  bool val3;
+  int ecode3 = 0;
+  Event *result = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Event_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Event_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_bool(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "Event_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "bool"
+                                               "'");
+  }
+  arg3 = static_cast<bool>(val3);
+  {
+    try {
+      result = (Event *)Event::create(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Event, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  Event *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Event_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (Event *)Event::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Event, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Event_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      Event::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_set(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_set.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_set"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      (arg1)->set();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_reset(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_reset.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_reset"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      (arg1)->reset();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_isSet(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_isSet.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_isSet"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->isSet();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_wait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_trywait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_trywait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trywait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_timedwait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_timedwait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_timedwait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Event_timedwait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->timedwait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_waiters(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_waiters.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_waiters"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->waiters();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Event_templ<SWIG_OBJ_WRAP>::_wrap_Event_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Event *arg1 = (Event *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Event_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Event, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Event_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Event *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Event *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_Event_templ<SWIG_OBJ_WRAP>::~_exports_Event_templ() {
+  auto arg1 = reinterpret_cast<Event *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_Event_templ<SWIG_OBJ_WRAP>::_exports_Event_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class Event can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_Event_templ<SWIG_OBJ_WRAP>::_exports_Event_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  Condition *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Condition_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Condition_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      result = (Condition *)Condition::createExclusive(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Condition, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  Condition *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Condition_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Condition_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      result = (Condition *)Condition::create(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Condition, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  Condition *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Condition_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (Condition *)Condition::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Condition, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "Condition_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      Condition::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_lock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_lock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_lock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      (arg1)->lock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_trylock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_trylock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_trylock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trylock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_unlock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_unlock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_unlock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      (arg1)->unlock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_wait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_timedwait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_timedwait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_timedwait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "Condition_timedwait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->timedwait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_notifyOne(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_notifyOne.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_notifyOne"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      (arg1)->notifyOne();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_notifyAll(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_notifyAll.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_notifyAll"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      (arg1)->notifyAll();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_waiters(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_waiters.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_waiters"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->waiters();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_Condition_templ<SWIG_OBJ_WRAP>::_wrap_Condition_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Condition *arg1 = (Condition *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Condition_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Condition, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "Condition_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Condition *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<Condition *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_Condition_templ<SWIG_OBJ_WRAP>::~_exports_Condition_templ() {
+  auto arg1 = reinterpret_cast<Condition *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_Condition_templ<SWIG_OBJ_WRAP>::_exports_Condition_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class Condition can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_Condition_templ<SWIG_OBJ_WRAP>::_exports_Condition_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  RecursiveMutex *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RecursiveMutex_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "RecursiveMutex_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      result = (RecursiveMutex *)RecursiveMutex::createExclusive(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RecursiveMutex, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  RecursiveMutex *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RecursiveMutex_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "RecursiveMutex_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  {
+    try {
+      result = (RecursiveMutex *)RecursiveMutex::create(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RecursiveMutex, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  RecursiveMutex *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RecursiveMutex_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (RecursiveMutex *)RecursiveMutex::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_RecursiveMutex, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "RecursiveMutex_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      RecursiveMutex::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_lock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RecursiveMutex *arg1 = (RecursiveMutex *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_lock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RecursiveMutex, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_lock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RecursiveMutex *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RecursiveMutex *>(argp1);
+  {
+    try {
+      (arg1)->lock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_trylock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RecursiveMutex *arg1 = (RecursiveMutex *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_trylock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RecursiveMutex, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_trylock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RecursiveMutex *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RecursiveMutex *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trylock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_unlock(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RecursiveMutex *arg1 = (RecursiveMutex *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_unlock.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RecursiveMutex, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_unlock"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RecursiveMutex *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RecursiveMutex *>(argp1);
+  {
+    try {
+      (arg1)->unlock();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_lockCount(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RecursiveMutex *arg1 = (RecursiveMutex *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_lockCount.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RecursiveMutex, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_lockCount"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RecursiveMutex *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RecursiveMutex *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->lockCount();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RecursiveMutex *arg1 = (RecursiveMutex *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RecursiveMutex, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RecursiveMutex *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RecursiveMutex *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_wrap_RecursiveMutex_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  RecursiveMutex *arg1 = (RecursiveMutex *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_RecursiveMutex_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_RecursiveMutex, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "RecursiveMutex_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "RecursiveMutex *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<RecursiveMutex *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::~_exports_RecursiveMutex_templ() {
+  auto arg1 = reinterpret_cast<RecursiveMutex *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_exports_RecursiveMutex_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class RecursiveMutex can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_RecursiveMutex_templ<SWIG_OBJ_WRAP>::_exports_RecursiveMutex_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  int arg4;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  int val4;
+  int ecode4 = 0;
+  SemaphoreArray *result = 0;
+
+  if (static_cast<int>(info.Length()) < 4 || static_cast<int>(info.Length()) > 4) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreArray_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_int(info[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreArray_createExclusive"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg4 = static_cast<int>(val4);
+  {
+    try {
+      result = (SemaphoreArray *)SemaphoreArray::createExclusive(*arg1, arg2, arg3, arg4);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreArray, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  int arg4;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  int val4;
+  int ecode4 = 0;
+  SemaphoreArray *result = 0;
+
+  if (static_cast<int>(info.Length()) < 4 || static_cast<int>(info.Length()) > 4) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreArray_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_int(info[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreArray_create"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg4 = static_cast<int>(val4);
+  {
+    try {
+      result = (SemaphoreArray *)SemaphoreArray::create(*arg1, arg2, arg3, arg4);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreArray, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  SemaphoreArray *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreArray_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_open"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (SemaphoreArray *)SemaphoreArray::open(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreArray, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreArray_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      SemaphoreArray::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_wait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_wait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_wait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_wait"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      (arg1)->wait(arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_trywait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_trywait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_trywait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_trywait"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (bool)(arg1)->trywait(arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_timedwait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  unsigned int arg4;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  unsigned int val4;
+  int ecode4 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_timedwait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_timedwait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_timedwait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_timedwait"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_unsigned_SS_int(info[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreArray_timedwait"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg4 = static_cast<unsigned int>(val4);
+  {
+    try {
+      result = (bool)(arg1)->timedwait(arg2, arg3, arg4);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_post(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_post.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_post"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_post"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      (arg1)->post(arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_transfer(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  unsigned int arg4;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  unsigned int val4;
+  int ecode4 = 0;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_transfer.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_transfer"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_transfer"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_transfer"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_unsigned_SS_int(info[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreArray_transfer"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg4 = static_cast<unsigned int>(val4);
+  {
+    try {
+      (arg1)->transfer(arg2, arg3, arg4);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_tryTransfer(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  unsigned int arg4;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  unsigned int val4;
+  int ecode4 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_tryTransfer.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_tryTransfer"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_tryTransfer"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_tryTransfer"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_unsigned_SS_int(info[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreArray_tryTransfer"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg4 = static_cast<unsigned int>(val4);
+  {
+    try {
+      result = (bool)(arg1)->tryTransfer(arg2, arg3, arg4);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_timedTransfer(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  unsigned int arg4;
+  unsigned int arg5;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  unsigned int val4;
+  int ecode4 = 0;
+  unsigned int val5;
+  int ecode5 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 4 || static_cast<int>(info.Length()) > 4) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_timedTransfer.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_timedTransfer"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_timedTransfer"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreArray_timedTransfer"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_unsigned_SS_int(info[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreArray_timedTransfer"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg4 = static_cast<unsigned int>(val4);
+  ecode5 = SWIG_AsVal_unsigned_SS_int(info[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '"
+                                               "SemaphoreArray_timedTransfer"
+                                               "', argument "
+                                               "5"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg5 = static_cast<unsigned int>(val5);
+  {
+    try {
+      result = (bool)(arg1)->timedTransfer(arg2, arg3, arg4, arg5);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_acquireAny(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  int result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_acquireAny.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_acquireAny"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_acquireAny"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (int)(arg1)->acquireAny(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_valueOf(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_valueOf.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_valueOf"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreArray_valueOf"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (unsigned int)(arg1)->valueOf(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_size(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_size.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_size"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->size();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreArray_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreArray *arg1 = (SemaphoreArray *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreArray_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreArray, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreArray_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreArray *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreArray *>(argp1);
+  {
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreArray_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreArray *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreArray_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class SemaphoreArray can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreArray_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreArray_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_createExclusive(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  unsigned int arg4;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  unsigned int val4;
+  int ecode4 = 0;
+  SemaphoreSharded *result = 0;
+
+  if (static_cast<int>(info.Length()) < 4 || static_cast<int>(info.Length()) > 4) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_createExclusive"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreSharded_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSharded_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreSharded_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_unsigned_SS_int(info[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreSharded_createExclusive"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg4 = static_cast<unsigned int>(val4);
+  {
+    try {
+      result = (SemaphoreSharded *)SemaphoreSharded::createExclusive(*arg1, arg2, arg3, arg4);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_create(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  unsigned int arg4;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  unsigned int val4;
+  int ecode4 = 0;
+  SemaphoreSharded *result = 0;
+
+  if (static_cast<int>(info.Length()) < 4 || static_cast<int>(info.Length()) > 4) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_create.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_create"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreSharded_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSharded_create"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreSharded_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  ecode4 = SWIG_AsVal_unsigned_SS_int(info[3], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '"
+                                               "SemaphoreSharded_create"
+                                               "', argument "
+                                               "4"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg4 = static_cast<unsigned int>(val4);
+  {
+    try {
+      result = (SemaphoreSharded *)SemaphoreSharded::create(*arg1, arg2, arg3, arg4);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  SemaphoreSharded *result = 0;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreSharded_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSharded_open"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (SemaphoreSharded *)SemaphoreSharded::open(*arg1, arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_unlink(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_unlink.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_unlink"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreSharded_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      SemaphoreSharded::unlink(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_wait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      (arg1)->wait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_wait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_wait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSharded_wait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->wait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded__wrap_SemaphoreSharded_wait(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreSharded_wait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreSharded_wait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreSharded_wait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreSharded_wait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function wait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_trywait__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      result = (bool)(arg1)->trywait();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_trywait__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  bool result;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_trywait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSharded_trywait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      result = (bool)(arg1)->trywait(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded__wrap_SemaphoreSharded_trywait(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreSharded_trywait__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreSharded_trywait__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreSharded_trywait__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreSharded_trywait__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function trywait.");
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_timedwait(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  unsigned int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  bool result;
+
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_timedwait.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_timedwait"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSharded_timedwait"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreSharded_timedwait"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (bool)(arg1)->timedwait(arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_bool SWIG_NAPI_FROM_CALL_ARGS(static_cast<bool>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_post__SWIG_0(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      (arg1)->post();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_overloaded_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_post__SWIG_1(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  unsigned int arg2;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int val2;
+  int ecode2 = 0;
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_post"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreSharded_post"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg2 = static_cast<unsigned int>(val2);
+  {
+    try {
+      (arg1)->post(arg2);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function_dispatcher
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded__wrap_SemaphoreSharded_post(
+    const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 0 && static_cast<int>(info.Length()) <= 0) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreSharded_post__SWIG_0(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreSharded_post__SWIG_0(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
+
+  // js_function_dispatch_case
+  if (static_cast<int>(info.Length()) >= 1 && static_cast<int>(info.Length()) <= 1) {
+#ifdef NAPI_CPP_EXCEPTIONS
+    bool tryNext = false;
+    try {
+      jsresult = _wrap_SemaphoreSharded_post__SWIG_1(info);
+    } catch (const Napi::TypeError &) {
+      tryNext = true;
+    } catch (const Napi::Error &e) {
+      throw e;
+    }
+    if (!tryNext)
+      return jsresult;
+#else
+    _wrap_SemaphoreSharded_post__SWIG_1(info);
+    if (env.IsExceptionPending()) {
+      Napi::Error e = env.GetAndClearPendingException();
+      Napi::Value typeErrorValue;
+      bool isTypeError;
+      Napi::Function typeErrorCons;
+      // Yes, this is ugly
+      // TODO: Fix this in Node.js when the core team grows up
+      NAPI_CHECK_RESULT(env.Global().Get("TypeError"), typeErrorValue);
+      typeErrorCons = typeErrorValue.As<Napi::Function>();
+      NAPI_CHECK_RESULT(e.Value().InstanceOf(typeErrorCons), isTypeError);
+      if (!isTypeError) {
+        // This is not the error you are looking for
+        e.ThrowAsJavaScriptException();
+        SWIG_fail;
+      }
+    } else {
+      return jsresult;
+    }
+#endif
+  }
 
-  /* add static class functions and variables */
-  // jsnapi_register_static_function
-  staticMembers.erase("createExclusive");
-  staticMembers.insert(
-      {"createExclusive", StaticMethod("createExclusive", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_createExclusive,
-                                       static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_register_static_function
-  staticMembers.erase("create");
-  staticMembers.insert(
-      {"create", StaticMethod("create", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_create,
-                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_register_static_function
-  staticMembers.erase("open");
-  staticMembers.insert(
-      {"open", StaticMethod("open", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_open,
-                            static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
-  // jsnapi_register_static_function
-  staticMembers.erase("unlink");
-  staticMembers.insert(
-      {"unlink", StaticMethod("unlink", &_exports_SemaphoreV_templ::_wrap_SemaphoreV_unlink,
-                              static_cast<napi_property_attributes>(napi_writable | napi_configurable))});
+  SWIG_Error(SWIG_ERROR, "Illegal arguments for function post.");
+
+  goto fail;
+fail:
+  return Napi::Value();
 }
 
-// js_setter
+// js_function
 template <typename SWIG_OBJ_WRAP>
-void _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token_key_set(const Napi::CallbackInfo &info,
-                                                              const Napi::Value &value) {
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_valueOf(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = (Token *)0;
-  key_t arg2;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
   void *argp1 = 0;
   int res1 = 0;
-  void *argp2;
-  int res2 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_valueOf.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_valueOf"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->valueOf();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_capacity(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_capacity.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_capacity"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->capacity();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_shards(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_shards.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_shards"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->shards();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_rebalance(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_rebalance.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_rebalance"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      (arg1)->rebalance();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = env.Undefined();
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_refs(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+  unsigned int result;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_refs.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreSharded_refs"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreSharded *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->refs();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreSharded_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreSharded *arg1 = (SemaphoreSharded *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreSharded_close.");
+  }
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreSharded, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "Token_key_set"
+                                             "SemaphoreSharded_close"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token *"
+                                             "SemaphoreSharded *"
                                              "'");
   }
-  arg1 = reinterpret_cast<Token *>(argp1);
+  arg1 = reinterpret_cast<SemaphoreSharded *>(argp1);
   {
-    {
-      res2 = SWIG_ConvertPtr(value, &argp2, SWIGTYPE_p_key_t, 0);
-      if (!SWIG_IsOK(res2)) {
-        SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
-                                                 "Token_key_set"
-                                                 "', argument "
-                                                 "2"
-                                                 " of type '"
-                                                 "key_t"
-                                                 "'");
-      }
-      if (!argp2) {
-        SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
-                                             "in method '"
-                                             "Token_key_set"
-                                             "', argument "
-                                             "2"
-                                             " of type '"
-                                             "key_t"
-                                             "'");
-      } else {
-        arg2 = *(reinterpret_cast<key_t *>(argp2));
-      }
+    try {
+      (arg1)->close();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
     }
   }
-  if (arg1)
-    (arg1)->key = arg2;
+  jsresult = env.Undefined();
 
-  return;
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP> _exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreSharded_templ() {
+  auto arg1 = reinterpret_cast<SemaphoreSharded *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
 
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreSharded_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class SemaphoreSharded can not be instantiated");
+  return;
   goto fail;
 fail:
   return;
 }
 
-// js_getter
+// This is the extendable constructor to be used from child classes
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token_key_get(const Napi::CallbackInfo &info) {
+_exports_SemaphoreSharded_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreSharded_templ(bool, const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value _exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_createExclusive(
+    const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = (Token *)0;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
   void *argp1 = 0;
   int res1 = 0;
-  key_t result;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  SemaphoreNamespace *result = 0;
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_createExclusive.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "Token_key_get"
+                                             "SemaphoreNamespace_createExclusive"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token *"
+                                             "Token &"
                                              "'");
   }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreNamespace_createExclusive"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
   arg1 = reinterpret_cast<Token *>(argp1);
-  result = ((arg1)->key);
-  jsresult = SWIG_NewPointerObj((new key_t(result)), SWIGTYPE_p_key_t, SWIG_POINTER_OWN | 0);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
+                                               "SemaphoreNamespace_createExclusive"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreNamespace_createExclusive"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
+  {
+    try {
+      result = (SemaphoreNamespace *)SemaphoreNamespace::createExclusive(*arg1, arg2, arg3);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
 
   return jsresult;
 
@@ -1876,59 +20946,73 @@ fail:
   return Napi::Value();
 }
 
+// js_function
 template <typename SWIG_OBJ_WRAP>
-// js_ctor
-// This is the main constructor
-_exports_Token_templ<SWIG_OBJ_WRAP>::_exports_Token_templ(const Napi::CallbackInfo &info)
-    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+Napi::Value
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_create(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  int arg2;
+  unsigned int arg3;
+  void *argp1 = 0;
+  int res1 = 0;
+  int val2;
+  int ecode2 = 0;
+  unsigned int val3;
+  int ecode3 = 0;
+  SemaphoreNamespace *result = 0;
 
-  this->info = SWIGTYPE_p_Token;
-  if (info.Length() == 1 && info[0].IsExternal()) {
-    // This constructor has been called internally from C++/SWIG
-    // to wrap an already existing C++ object in JS
-    this->self = info[0].As<Napi::External<void>>().Data();
-    this->owned = false;
-    return;
+  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_create.");
   }
-  this->owned = true;
 
-  char *arg1 = (char *)0;
-  char arg2;
-  int res1;
-  char *buf1 = 0;
-  int alloc1 = 0;
-  char val2;
-  int ecode2 = 0;
-  Token *result;
-  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_new_Token.");
-  }
-  res1 = SWIG_AsCharPtrAndSize(info[0], &buf1, NULL, &alloc1);
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "new_Token"
+                                             "SemaphoreNamespace_create"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "char const *"
+                                             "Token &"
                                              "'");
   }
-  arg1 = reinterpret_cast<char *>(buf1);
-  ecode2 = SWIG_AsVal_char(info[1], &val2);
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreNamespace_create"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  ecode2 = SWIG_AsVal_int(info[1], &val2);
   if (!SWIG_IsOK(ecode2)) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
-                                               "new_Token"
+                                               "SemaphoreNamespace_create"
                                                "', argument "
                                                "2"
                                                " of type '"
-                                               "char"
+                                               "int"
                                                "'");
   }
-  arg2 = static_cast<char>(val2);
+  arg2 = static_cast<int>(val2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(info[2], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreNamespace_create"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "unsigned int"
+                                               "'");
+  }
+  arg3 = static_cast<unsigned int>(val3);
   {
     try {
-      result = (Token *)new Token((char const *)arg1, arg2);
+      result = (SemaphoreNamespace *)SemaphoreNamespace::create(*arg1, arg2, arg3);
     } catch (std::system_error &e) {
       throwJavaScriptError(e, info.Env());
       SWIG_fail;
@@ -1936,50 +21020,108 @@ _exports_Token_templ<SWIG_OBJ_WRAP>::_exports_Token_templ(const Napi::CallbackIn
       SWIG_exception(SWIG_RuntimeError, "Unknown exception");
     }
   }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
 
-  if (alloc1 == SWIG_NEWOBJ)
-    delete[] buf1;
+  return jsresult;
 
-  this->self = result;
-  return;
   goto fail;
 fail:
-  return;
+  return Napi::Value();
 }
 
-// This is the bypass constructor to be used from child classes
+// js_function
 template <typename SWIG_OBJ_WRAP>
-_exports_Token_templ<SWIG_OBJ_WRAP>::_exports_Token_templ(bool, const Napi::CallbackInfo &info)
-    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+Napi::Value
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_open(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  Token *arg1 = 0;
+  void *argp1 = 0;
+  int res1 = 0;
+  SemaphoreNamespace *result = 0;
+
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_open.");
+  }
+
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreNamespace_open"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "Token &"
+                                             "'");
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreNamespace_open"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
+  arg1 = reinterpret_cast<Token *>(argp1);
+  {
+    try {
+      result = (SemaphoreNamespace *)SemaphoreNamespace::open(*arg1);
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
+  }
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token___ref__(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_unlink(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = (Token *)0;
+  Token *arg1 = 0;
   void *argp1 = 0;
   int res1 = 0;
-  key_t result;
 
-  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Token___ref__.");
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_unlink.");
   }
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "Token___ref__"
+                                             "SemaphoreNamespace_unlink"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token *"
+                                             "Token &"
                                              "'");
   }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                         "in method '"
+                                         "SemaphoreNamespace_unlink"
+                                         "', argument "
+                                         "1"
+                                         " of type '"
+                                         "Token &"
+                                         "'");
+  }
   arg1 = reinterpret_cast<Token *>(argp1);
   {
     try {
-      result = (arg1)->operator*();
+      SemaphoreNamespace::unlink(*arg1);
     } catch (std::system_error &e) {
       throwJavaScriptError(e, info.Env());
       SWIG_fail;
@@ -1987,7 +21129,7 @@ Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token___ref__(const Napi:
       SWIG_exception(SWIG_RuntimeError, "Unknown exception");
     }
   }
-  jsresult = SWIG_NewPointerObj((new key_t(result)), SWIGTYPE_p_key_t, SWIG_POINTER_OWN | 0);
+  jsresult = env.Undefined();
 
   return jsresult;
 
@@ -1998,32 +21140,73 @@ fail:
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token_valueOf(const Napi::CallbackInfo &info) {
+Napi::Value _exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_createSemaphore(
+    const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = (Token *)0;
+  SemaphoreNamespace *arg1 = (SemaphoreNamespace *)0;
+  std::string *arg2 = 0;
+  int arg3;
   void *argp1 = 0;
   int res1 = 0;
-  int result;
+  int res2 = SWIG_OLDOBJ;
+  int val3;
+  int ecode3 = 0;
+  NamedSemaphore *result = 0;
 
-  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_Token_valueOf.");
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_createSemaphore.");
   }
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_Token, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "Token_valueOf"
+                                             "SemaphoreNamespace_createSemaphore"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token *"
+                                             "SemaphoreNamespace *"
                                              "'");
   }
-  arg1 = reinterpret_cast<Token *>(argp1);
+  arg1 = reinterpret_cast<SemaphoreNamespace *>(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(info[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
+                                               "SemaphoreNamespace_createSemaphore"
+                                               "', argument "
+                                               "2"
+                                               " of type '"
+                                               "std::string const &"
+                                               "'");
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                           "in method '"
+                                           "SemaphoreNamespace_createSemaphore"
+                                           "', argument "
+                                           "2"
+                                           " of type '"
+                                           "std::string const &"
+                                           "'");
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_int(info[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
+                                               "SemaphoreNamespace_createSemaphore"
+                                               "', argument "
+                                               "3"
+                                               " of type '"
+                                               "int"
+                                               "'");
+  }
+  arg3 = static_cast<int>(val3);
   {
     try {
-      result = (int)(arg1)->valueOf();
+      result = (NamedSemaphore *)(arg1)->createSemaphore((std::string const &)*arg2, arg3);
     } catch (std::system_error &e) {
       throwJavaScriptError(e, info.Env());
       SWIG_fail;
@@ -2031,7 +21214,9 @@ Napi::Value _exports_Token_templ<SWIG_OBJ_WRAP>::_wrap_Token_valueOf(const Napi:
       SWIG_exception(SWIG_RuntimeError, "Unknown exception");
     }
   }
-  jsresult = SWIG_From_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<int>(result));
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_NamedSemaphore, 0 | 0);
+  if (SWIG_IsNewObj(res2))
+    delete arg2;
 
   return jsresult;
 
@@ -2040,71 +21225,65 @@ fail:
   return Napi::Value();
 }
 
-// js_dtoroverride
-template <typename SWIG_OBJ_WRAP> _exports_Token_templ<SWIG_OBJ_WRAP>::~_exports_Token_templ() {
-  auto arg1 = reinterpret_cast<Token *>(this->self);
-  if (this->owned && arg1) {
-    delete arg1;
-    this->self = nullptr;
-  }
-}
-
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_createExclusive(const Napi::CallbackInfo &info) {
+Napi::Value _exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_createSemaphoreExclusive(
+    const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = 0;
-  int arg2;
+  SemaphoreNamespace *arg1 = (SemaphoreNamespace *)0;
+  std::string *arg2 = 0;
   int arg3;
   void *argp1 = 0;
   int res1 = 0;
-  int val2;
-  int ecode2 = 0;
+  int res2 = SWIG_OLDOBJ;
   int val3;
   int ecode3 = 0;
-  SemaphoreV *result = 0;
+  NamedSemaphore *result = 0;
 
-  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_createExclusive.");
+  if (static_cast<int>(info.Length()) < 2 || static_cast<int>(info.Length()) > 2) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_createSemaphoreExclusive.");
   }
 
-  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_createExclusive"
+                                             "SemaphoreNamespace_createSemaphoreExclusive"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token &"
+                                             "SemaphoreNamespace *"
                                              "'");
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
-                                         "in method '"
-                                         "SemaphoreV_createExclusive"
-                                         "', argument "
-                                         "1"
-                                         " of type '"
-                                         "Token &"
-                                         "'");
-  }
-  arg1 = reinterpret_cast<Token *>(argp1);
-  ecode2 = SWIG_AsVal_int(info[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
-                                               "SemaphoreV_createExclusive"
+  arg1 = reinterpret_cast<SemaphoreNamespace *>(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(info[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
+                                               "SemaphoreNamespace_createSemaphoreExclusive"
                                                "', argument "
                                                "2"
                                                " of type '"
-                                               "int"
+                                               "std::string const &"
                                                "'");
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                           "in method '"
+                                           "SemaphoreNamespace_createSemaphoreExclusive"
+                                           "', argument "
+                                           "2"
+                                           " of type '"
+                                           "std::string const &"
+                                           "'");
+    }
+    arg2 = ptr;
   }
-  arg2 = static_cast<int>(val2);
-  ecode3 = SWIG_AsVal_int(info[2], &val3);
+  ecode3 = SWIG_AsVal_int(info[1], &val3);
   if (!SWIG_IsOK(ecode3)) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
-                                               "SemaphoreV_createExclusive"
+                                               "SemaphoreNamespace_createSemaphoreExclusive"
                                                "', argument "
                                                "3"
                                                " of type '"
@@ -2114,7 +21293,7 @@ Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_createExc
   arg3 = static_cast<int>(val3);
   {
     try {
-      result = (SemaphoreV *)SemaphoreV::createExclusive(*arg1, arg2, arg3);
+      result = (NamedSemaphore *)(arg1)->createSemaphoreExclusive((std::string const &)*arg2, arg3);
     } catch (std::system_error &e) {
       throwJavaScriptError(e, info.Env());
       SWIG_fail;
@@ -2122,7 +21301,9 @@ Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_createExc
       SWIG_exception(SWIG_RuntimeError, "Unknown exception");
     }
   }
-  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreV, 0 | 0);
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_NamedSemaphore, 0 | 0);
+  if (SWIG_IsNewObj(res2))
+    delete arg2;
 
   return jsresult;
 
@@ -2133,70 +21314,59 @@ fail:
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_create(const Napi::CallbackInfo &info) {
+Napi::Value _exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_openSemaphore(
+    const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = 0;
-  int arg2;
-  int arg3;
+  SemaphoreNamespace *arg1 = (SemaphoreNamespace *)0;
+  std::string *arg2 = 0;
   void *argp1 = 0;
   int res1 = 0;
-  int val2;
-  int ecode2 = 0;
-  int val3;
-  int ecode3 = 0;
-  SemaphoreV *result = 0;
+  int res2 = SWIG_OLDOBJ;
+  NamedSemaphore *result = 0;
 
-  if (static_cast<int>(info.Length()) < 3 || static_cast<int>(info.Length()) > 3) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_create.");
+  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_openSemaphore.");
   }
 
-  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_create"
+                                             "SemaphoreNamespace_openSemaphore"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token &"
+                                             "SemaphoreNamespace *"
                                              "'");
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
-                                         "in method '"
-                                         "SemaphoreV_create"
-                                         "', argument "
-                                         "1"
-                                         " of type '"
-                                         "Token &"
-                                         "'");
-  }
-  arg1 = reinterpret_cast<Token *>(argp1);
-  ecode2 = SWIG_AsVal_int(info[1], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
-                                               "SemaphoreV_create"
+  arg1 = reinterpret_cast<SemaphoreNamespace *>(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(info[0], &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '"
+                                               "SemaphoreNamespace_openSemaphore"
                                                "', argument "
                                                "2"
                                                " of type '"
-                                               "int"
-                                               "'");
-  }
-  arg2 = static_cast<int>(val2);
-  ecode3 = SWIG_AsVal_int(info[2], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '"
-                                               "SemaphoreV_create"
-                                               "', argument "
-                                               "3"
-                                               " of type '"
-                                               "int"
+                                               "std::string const &"
                                                "'");
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
+                                           "in method '"
+                                           "SemaphoreNamespace_openSemaphore"
+                                           "', argument "
+                                           "2"
+                                           " of type '"
+                                           "std::string const &"
+                                           "'");
+    }
+    arg2 = ptr;
   }
-  arg3 = static_cast<int>(val3);
   {
     try {
-      result = (SemaphoreV *)SemaphoreV::create(*arg1, arg2, arg3);
+      result = (NamedSemaphore *)(arg1)->openSemaphore((std::string const &)*arg2);
     } catch (std::system_error &e) {
       throwJavaScriptError(e, info.Env());
       SWIG_fail;
@@ -2204,7 +21374,9 @@ Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_create(co
       SWIG_exception(SWIG_RuntimeError, "Unknown exception");
     }
   }
-  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreV, 0 | 0);
+  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_NamedSemaphore, 0 | 0);
+  if (SWIG_IsNewObj(res2))
+    delete arg2;
 
   return jsresult;
 
@@ -2215,42 +21387,33 @@ fail:
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_open(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_capacity(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = 0;
+  SemaphoreNamespace *arg1 = (SemaphoreNamespace *)0;
   void *argp1 = 0;
   int res1 = 0;
-  SemaphoreV *result = 0;
+  unsigned int result;
 
-  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_open.");
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_capacity.");
   }
 
-  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_open"
+                                             "SemaphoreNamespace_capacity"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token &"
+                                             "SemaphoreNamespace *"
                                              "'");
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
-                                         "in method '"
-                                         "SemaphoreV_open"
-                                         "', argument "
-                                         "1"
-                                         " of type '"
-                                         "Token &"
-                                         "'");
-  }
-  arg1 = reinterpret_cast<Token *>(argp1);
+  arg1 = reinterpret_cast<SemaphoreNamespace *>(argp1);
   {
     try {
-      result = (SemaphoreV *)SemaphoreV::open(*arg1);
+      result = (unsigned int)(arg1)->capacity();
     } catch (std::system_error &e) {
       throwJavaScriptError(e, info.Env());
       SWIG_fail;
@@ -2258,7 +21421,7 @@ Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_open(cons
       SWIG_exception(SWIG_RuntimeError, "Unknown exception");
     }
   }
-  jsresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_SemaphoreV, 0 | 0);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
 
   return jsresult;
 
@@ -2269,41 +21432,77 @@ fail:
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_unlink(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_used(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  Token *arg1 = 0;
+  SemaphoreNamespace *arg1 = (SemaphoreNamespace *)0;
   void *argp1 = 0;
   int res1 = 0;
+  unsigned int result;
 
-  if (static_cast<int>(info.Length()) < 1 || static_cast<int>(info.Length()) > 1) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_unlink.");
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_used.");
   }
 
-  res1 = SWIG_ConvertPtr(info[0], &argp1, SWIGTYPE_p_Token, 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_unlink"
+                                             "SemaphoreNamespace_used"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "Token &"
+                                             "SemaphoreNamespace *"
                                              "'");
   }
-  if (!argp1) {
-    SWIG_exception_fail(SWIG_ValueError, "invalid null reference "
-                                         "in method '"
-                                         "SemaphoreV_unlink"
-                                         "', argument "
-                                         "1"
-                                         " of type '"
-                                         "Token &"
-                                         "'");
+  arg1 = reinterpret_cast<SemaphoreNamespace *>(argp1);
+  {
+    try {
+      result = (unsigned int)(arg1)->used();
+    } catch (std::system_error &e) {
+      throwJavaScriptError(e, info.Env());
+      SWIG_fail;
+    } catch (...) {
+      SWIG_exception(SWIG_RuntimeError, "Unknown exception");
+    }
   }
-  arg1 = reinterpret_cast<Token *>(argp1);
+  jsresult = SWIG_From_unsigned_SS_int SWIG_NAPI_FROM_CALL_ARGS(static_cast<unsigned int>(result));
+
+  return jsresult;
+
+  goto fail;
+fail:
+  return Napi::Value();
+}
+
+// js_function
+template <typename SWIG_OBJ_WRAP>
+Napi::Value
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreNamespace_close(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Napi::Value jsresult;
+  SemaphoreNamespace *arg1 = (SemaphoreNamespace *)0;
+  void *argp1 = 0;
+  int res1 = 0;
+
+  if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreNamespace_close.");
+  }
+
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreNamespace, 0 | 0);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
+                                             "SemaphoreNamespace_close"
+                                             "', argument "
+                                             "1"
+                                             " of type '"
+                                             "SemaphoreNamespace *"
+                                             "'");
+  }
+  arg1 = reinterpret_cast<SemaphoreNamespace *>(argp1);
   {
     try {
-      SemaphoreV::unlink(*arg1);
+      (arg1)->close();
     } catch (std::system_error &e) {
       throwJavaScriptError(e, info.Env());
       SWIG_fail;
@@ -2320,26 +21519,64 @@ fail:
   return Napi::Value();
 }
 
+// js_dtoroverride
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreNamespace_templ(
+    ) {
+  auto arg1 = reinterpret_cast<SemaphoreNamespace *>(this->self);
+  if (this->owned && arg1) {
+    delete arg1;
+    this->self = nullptr;
+  }
+}
+
+// js_veto_ctor
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreNamespace_templ(const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
+  Napi::Env env = info.Env();
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    // This constructor has been called internally from C++/SWIG
+    // to wrap an already existing C++ object in JS as its
+    // base abstract class
+    this->self = info[0].As<Napi::External<void>>().Data();
+    this->owned = false;
+    return;
+  }
+  SWIG_Error(SWIG_ERROR, "Class SemaphoreNamespace can not be instantiated");
+  return;
+  goto fail;
+fail:
+  return;
+}
+
+// This is the extendable constructor to be used from child classes
+template <typename SWIG_OBJ_WRAP>
+_exports_SemaphoreNamespace_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreNamespace_templ(bool,
+                                                                                    const Napi::CallbackInfo &info)
+    : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
+
 // js_overloaded_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_wait__SWIG_0(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_wait__SWIG_0(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   void *argp1 = 0;
   int res1 = 0;
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_wait"
+                                             "NamedSemaphore_wait"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   {
     try {
       (arg1)->wait();
@@ -2361,31 +21598,32 @@ fail:
 
 // js_overloaded_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_wait__SWIG_1(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_wait__SWIG_1(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   unsigned int arg2;
   void *argp1 = 0;
   int res1 = 0;
   unsigned int val2;
   int ecode2 = 0;
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_wait"
+                                             "NamedSemaphore_wait"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
-                                               "SemaphoreV_wait"
+                                               "NamedSemaphore_wait"
                                                "', argument "
                                                "2"
                                                " of type '"
@@ -2414,8 +21652,8 @@ fail:
 
 // js_function_dispatcher
 template <typename SWIG_OBJ_WRAP>
-Napi::Value
-_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_wait(const Napi::CallbackInfo &info) {
+Napi::Value _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore__wrap_NamedSemaphore_wait(
+    const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
 
@@ -2424,7 +21662,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_wait
 #ifdef NAPI_CPP_EXCEPTIONS
     bool tryNext = false;
     try {
-      jsresult = _wrap_SemaphoreV_wait__SWIG_0(info);
+      jsresult = _wrap_NamedSemaphore_wait__SWIG_0(info);
     } catch (const Napi::TypeError &) {
       tryNext = true;
     } catch (const Napi::Error &e) {
@@ -2433,7 +21671,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_wait
     if (!tryNext)
       return jsresult;
 #else
-    _wrap_SemaphoreV_wait__SWIG_0(info);
+    _wrap_NamedSemaphore_wait__SWIG_0(info);
     if (env.IsExceptionPending()) {
       Napi::Error e = env.GetAndClearPendingException();
       Napi::Value typeErrorValue;
@@ -2460,7 +21698,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_wait
 #ifdef NAPI_CPP_EXCEPTIONS
     bool tryNext = false;
     try {
-      jsresult = _wrap_SemaphoreV_wait__SWIG_1(info);
+      jsresult = _wrap_NamedSemaphore_wait__SWIG_1(info);
     } catch (const Napi::TypeError &) {
       tryNext = true;
     } catch (const Napi::Error &e) {
@@ -2469,7 +21707,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_wait
     if (!tryNext)
       return jsresult;
 #else
-    _wrap_SemaphoreV_wait__SWIG_1(info);
+    _wrap_NamedSemaphore_wait__SWIG_1(info);
     if (env.IsExceptionPending()) {
       Napi::Error e = env.GetAndClearPendingException();
       Napi::Value typeErrorValue;
@@ -2500,25 +21738,26 @@ fail:
 
 // js_overloaded_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_trywait__SWIG_0(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_trywait__SWIG_0(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   void *argp1 = 0;
   int res1 = 0;
   bool result;
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_trywait"
+                                             "NamedSemaphore_trywait"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   {
     try {
       result = (bool)(arg1)->trywait();
@@ -2540,10 +21779,11 @@ fail:
 
 // js_overloaded_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_trywait__SWIG_1(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_trywait__SWIG_1(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   unsigned int arg2;
   void *argp1 = 0;
   int res1 = 0;
@@ -2551,21 +21791,21 @@ Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_trywait__
   int ecode2 = 0;
   bool result;
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_trywait"
+                                             "NamedSemaphore_trywait"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
-                                               "SemaphoreV_trywait"
+                                               "NamedSemaphore_trywait"
                                                "', argument "
                                                "2"
                                                " of type '"
@@ -2594,8 +21834,8 @@ fail:
 
 // js_function_dispatcher
 template <typename SWIG_OBJ_WRAP>
-Napi::Value
-_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_trywait(const Napi::CallbackInfo &info) {
+Napi::Value _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore__wrap_NamedSemaphore_trywait(
+    const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
 
@@ -2604,7 +21844,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_tryw
 #ifdef NAPI_CPP_EXCEPTIONS
     bool tryNext = false;
     try {
-      jsresult = _wrap_SemaphoreV_trywait__SWIG_0(info);
+      jsresult = _wrap_NamedSemaphore_trywait__SWIG_0(info);
     } catch (const Napi::TypeError &) {
       tryNext = true;
     } catch (const Napi::Error &e) {
@@ -2613,7 +21853,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_tryw
     if (!tryNext)
       return jsresult;
 #else
-    _wrap_SemaphoreV_trywait__SWIG_0(info);
+    _wrap_NamedSemaphore_trywait__SWIG_0(info);
     if (env.IsExceptionPending()) {
       Napi::Error e = env.GetAndClearPendingException();
       Napi::Value typeErrorValue;
@@ -2640,7 +21880,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_tryw
 #ifdef NAPI_CPP_EXCEPTIONS
     bool tryNext = false;
     try {
-      jsresult = _wrap_SemaphoreV_trywait__SWIG_1(info);
+      jsresult = _wrap_NamedSemaphore_trywait__SWIG_1(info);
     } catch (const Napi::TypeError &) {
       tryNext = true;
     } catch (const Napi::Error &e) {
@@ -2649,7 +21889,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_tryw
     if (!tryNext)
       return jsresult;
 #else
-    _wrap_SemaphoreV_trywait__SWIG_1(info);
+    _wrap_NamedSemaphore_trywait__SWIG_1(info);
     if (env.IsExceptionPending()) {
       Napi::Error e = env.GetAndClearPendingException();
       Napi::Value typeErrorValue;
@@ -2680,24 +21920,25 @@ fail:
 
 // js_overloaded_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_post__SWIG_0(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_post__SWIG_0(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   void *argp1 = 0;
   int res1 = 0;
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_post"
+                                             "NamedSemaphore_post"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   {
     try {
       (arg1)->post();
@@ -2719,31 +21960,32 @@ fail:
 
 // js_overloaded_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_post__SWIG_1(const Napi::CallbackInfo &info) {
+Napi::Value
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_post__SWIG_1(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   unsigned int arg2;
   void *argp1 = 0;
   int res1 = 0;
   unsigned int val2;
   int ecode2 = 0;
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_post"
+                                             "NamedSemaphore_post"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   ecode2 = SWIG_AsVal_unsigned_SS_int(info[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '"
-                                               "SemaphoreV_post"
+                                               "NamedSemaphore_post"
                                                "', argument "
                                                "2"
                                                " of type '"
@@ -2772,8 +22014,8 @@ fail:
 
 // js_function_dispatcher
 template <typename SWIG_OBJ_WRAP>
-Napi::Value
-_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_post(const Napi::CallbackInfo &info) {
+Napi::Value _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore__wrap_NamedSemaphore_post(
+    const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
 
@@ -2782,7 +22024,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_post
 #ifdef NAPI_CPP_EXCEPTIONS
     bool tryNext = false;
     try {
-      jsresult = _wrap_SemaphoreV_post__SWIG_0(info);
+      jsresult = _wrap_NamedSemaphore_post__SWIG_0(info);
     } catch (const Napi::TypeError &) {
       tryNext = true;
     } catch (const Napi::Error &e) {
@@ -2791,7 +22033,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_post
     if (!tryNext)
       return jsresult;
 #else
-    _wrap_SemaphoreV_post__SWIG_0(info);
+    _wrap_NamedSemaphore_post__SWIG_0(info);
     if (env.IsExceptionPending()) {
       Napi::Error e = env.GetAndClearPendingException();
       Napi::Value typeErrorValue;
@@ -2818,7 +22060,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_post
 #ifdef NAPI_CPP_EXCEPTIONS
     bool tryNext = false;
     try {
-      jsresult = _wrap_SemaphoreV_post__SWIG_1(info);
+      jsresult = _wrap_NamedSemaphore_post__SWIG_1(info);
     } catch (const Napi::TypeError &) {
       tryNext = true;
     } catch (const Napi::Error &e) {
@@ -2827,7 +22069,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV__wrap_SemaphoreV_post
     if (!tryNext)
       return jsresult;
 #else
-    _wrap_SemaphoreV_post__SWIG_1(info);
+    _wrap_NamedSemaphore_post__SWIG_1(info);
     if (env.IsExceptionPending()) {
       Napi::Error e = env.GetAndClearPendingException();
       Napi::Value typeErrorValue;
@@ -2858,29 +22100,29 @@ fail:
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_valueOf(const Napi::CallbackInfo &info) {
+Napi::Value _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_valueOf(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   void *argp1 = 0;
   int res1 = 0;
   unsigned int result;
 
   if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_valueOf.");
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_NamedSemaphore_valueOf.");
   }
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_valueOf"
+                                             "NamedSemaphore_valueOf"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   {
     try {
       result = (unsigned int)(arg1)->valueOf();
@@ -2902,29 +22144,29 @@ fail:
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_refs(const Napi::CallbackInfo &info) {
+Napi::Value _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_refs(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   void *argp1 = 0;
   int res1 = 0;
   unsigned int result;
 
   if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_refs.");
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_NamedSemaphore_refs.");
   }
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_refs"
+                                             "NamedSemaphore_refs"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   {
     try {
       result = (unsigned int)(arg1)->refs();
@@ -2946,28 +22188,28 @@ fail:
 
 // js_function
 template <typename SWIG_OBJ_WRAP>
-Napi::Value _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_wrap_SemaphoreV_close(const Napi::CallbackInfo &info) {
+Napi::Value _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_wrap_NamedSemaphore_close(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   Napi::Value jsresult;
-  SemaphoreV *arg1 = (SemaphoreV *)0;
+  NamedSemaphore *arg1 = (NamedSemaphore *)0;
   void *argp1 = 0;
   int res1 = 0;
 
   if (static_cast<int>(info.Length()) < 0 || static_cast<int>(info.Length()) > 0) {
-    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_SemaphoreV_close.");
+    SWIG_Error(SWIG_ERROR, "Illegal number of arguments for _wrap_NamedSemaphore_close.");
   }
 
-  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_SemaphoreV, 0 | 0);
+  res1 = SWIG_ConvertPtr(info.This(), &argp1, SWIGTYPE_p_NamedSemaphore, 0 | 0);
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '"
-                                             "SemaphoreV_close"
+                                             "NamedSemaphore_close"
                                              "', argument "
                                              "1"
                                              " of type '"
-                                             "SemaphoreV *"
+                                             "NamedSemaphore *"
                                              "'");
   }
-  arg1 = reinterpret_cast<SemaphoreV *>(argp1);
+  arg1 = reinterpret_cast<NamedSemaphore *>(argp1);
   {
     try {
       (arg1)->close();
@@ -2988,8 +22230,8 @@ fail:
 }
 
 // js_dtoroverride
-template <typename SWIG_OBJ_WRAP> _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::~_exports_SemaphoreV_templ() {
-  auto arg1 = reinterpret_cast<SemaphoreV *>(this->self);
+template <typename SWIG_OBJ_WRAP> _exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::~_exports_NamedSemaphore_templ() {
+  auto arg1 = reinterpret_cast<NamedSemaphore *>(this->self);
   if (this->owned && arg1) {
     delete arg1;
     this->self = nullptr;
@@ -2998,7 +22240,7 @@ template <typename SWIG_OBJ_WRAP> _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::~_ex
 
 // js_veto_ctor
 template <typename SWIG_OBJ_WRAP>
-_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreV_templ(const Napi::CallbackInfo &info)
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_exports_NamedSemaphore_templ(const Napi::CallbackInfo &info)
     : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {
   Napi::Env env = info.Env();
   if (info.Length() == 1 && info[0].IsExternal()) {
@@ -3009,7 +22251,7 @@ _exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreV_templ(const Napi::
     this->owned = false;
     return;
   }
-  SWIG_Error(SWIG_ERROR, "Class SemaphoreV can not be instantiated");
+  SWIG_Error(SWIG_ERROR, "Class NamedSemaphore can not be instantiated");
   return;
   goto fail;
 fail:
@@ -3018,33 +22260,120 @@ fail:
 
 // This is the extendable constructor to be used from child classes
 template <typename SWIG_OBJ_WRAP>
-_exports_SemaphoreV_templ<SWIG_OBJ_WRAP>::_exports_SemaphoreV_templ(bool, const Napi::CallbackInfo &info)
+_exports_NamedSemaphore_templ<SWIG_OBJ_WRAP>::_exports_NamedSemaphore_templ(bool, const Napi::CallbackInfo &info)
     : SWIG_NAPI_ObjectWrap_templ<SWIG_OBJ_WRAP>(true, info) {}
 
 /* -------- TYPE CONVERSION AND EQUIVALENCE RULES (BEGIN) -------- */
 
-static swig_type_info _swigt__p_SemaphoreV = {"_p_SemaphoreV", "p_SemaphoreV|SemaphoreV *", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_Barrier = {"_p_Barrier", "Barrier *|p_Barrier", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_Condition = {"_p_Condition", "Condition *|p_Condition", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_CountdownLatch = {
+    "_p_CountdownLatch", "CountdownLatch *|p_CountdownLatch", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_Event = {"_p_Event", "Event *|p_Event", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_NamedSemaphore = {
+    "_p_NamedSemaphore", "NamedSemaphore *|p_NamedSemaphore", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_RecursiveMutex = {
+    "_p_RecursiveMutex", "RecursiveMutex *|p_RecursiveMutex", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_RwLock = {"_p_RwLock", "RwLock *|p_RwLock", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreArray = {
+    "_p_SemaphoreArray", "SemaphoreArray *|p_SemaphoreArray", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreE = {"_p_SemaphoreE", "SemaphoreE *|p_SemaphoreE", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreF = {"_p_SemaphoreF", "SemaphoreF *|p_SemaphoreF", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreLimits = {
+    "_p_SemaphoreLimits", "SemaphoreLimits *|p_SemaphoreLimits", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreNamespace = {
+    "_p_SemaphoreNamespace", "SemaphoreNamespace *|p_SemaphoreNamespace", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreP = {"_p_SemaphoreP", "SemaphoreP *|p_SemaphoreP", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreSetInfo = {
+    "_p_SemaphoreSetInfo", "SemaphoreSetInfo *|p_SemaphoreSetInfo", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreSharded = {
+    "_p_SemaphoreSharded", "SemaphoreSharded *|p_SemaphoreSharded", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_SemaphoreV = {"_p_SemaphoreV", "SemaphoreV *|p_SemaphoreV", 0, 0, (void *)0, 0};
 static swig_type_info _swigt__p_Token = {"_p_Token", "Token *|p_Token", 0, 0, (void *)0, 0};
 static swig_type_info _swigt__p_char = {"_p_char", "char *", 0, 0, (void *)0, 0};
 static swig_type_info _swigt__p_key_t = {"_p_key_t", "key_t *", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_std__vectorT_SemaphoreSetInfo_t = {
+    "_p_std__vectorT_SemaphoreSetInfo_t", "std::vector< SemaphoreSetInfo > *|SemaphoreSetInfoList *", 0, 0, (void *)0,
+    0};
+static swig_type_info _swigt__p_std__vectorT_SemaphoreV_p_t = {
+    "_p_std__vectorT_SemaphoreV_p_t", "std::vector< SemaphoreV * > *|SemaphoreVList *", 0, 0, (void *)0, 0};
+static swig_type_info _swigt__p_std__vectorT_unsigned_short_t = {
+    "_p_std__vectorT_unsigned_short_t", "std::vector< unsigned short > *|UnsignedShortList *", 0, 0, (void *)0, 0};
 
 static swig_type_info *swig_type_initial[] = {
+    &_swigt__p_Barrier,
+    &_swigt__p_Condition,
+    &_swigt__p_CountdownLatch,
+    &_swigt__p_Event,
+    &_swigt__p_NamedSemaphore,
+    &_swigt__p_RecursiveMutex,
+    &_swigt__p_RwLock,
+    &_swigt__p_SemaphoreArray,
+    &_swigt__p_SemaphoreE,
+    &_swigt__p_SemaphoreF,
+    &_swigt__p_SemaphoreLimits,
+    &_swigt__p_SemaphoreNamespace,
+    &_swigt__p_SemaphoreP,
+    &_swigt__p_SemaphoreSetInfo,
+    &_swigt__p_SemaphoreSharded,
     &_swigt__p_SemaphoreV,
     &_swigt__p_Token,
     &_swigt__p_char,
     &_swigt__p_key_t,
+    &_swigt__p_std__vectorT_SemaphoreSetInfo_t,
+    &_swigt__p_std__vectorT_SemaphoreV_p_t,
+    &_swigt__p_std__vectorT_unsigned_short_t,
 };
 
+static swig_cast_info _swigc__p_Barrier[] = {{&_swigt__p_Barrier, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_Condition[] = {{&_swigt__p_Condition, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_CountdownLatch[] = {{&_swigt__p_CountdownLatch, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_Event[] = {{&_swigt__p_Event, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_NamedSemaphore[] = {{&_swigt__p_NamedSemaphore, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_RecursiveMutex[] = {{&_swigt__p_RecursiveMutex, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_RwLock[] = {{&_swigt__p_RwLock, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreArray[] = {{&_swigt__p_SemaphoreArray, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreE[] = {{&_swigt__p_SemaphoreE, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreF[] = {{&_swigt__p_SemaphoreF, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreLimits[] = {{&_swigt__p_SemaphoreLimits, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreNamespace[] = {{&_swigt__p_SemaphoreNamespace, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreP[] = {{&_swigt__p_SemaphoreP, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreSetInfo[] = {{&_swigt__p_SemaphoreSetInfo, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_SemaphoreSharded[] = {{&_swigt__p_SemaphoreSharded, 0, 0, 0}, {0, 0, 0, 0}};
 static swig_cast_info _swigc__p_SemaphoreV[] = {{&_swigt__p_SemaphoreV, 0, 0, 0}, {0, 0, 0, 0}};
 static swig_cast_info _swigc__p_Token[] = {{&_swigt__p_Token, 0, 0, 0}, {0, 0, 0, 0}};
 static swig_cast_info _swigc__p_char[] = {{&_swigt__p_char, 0, 0, 0}, {0, 0, 0, 0}};
 static swig_cast_info _swigc__p_key_t[] = {{&_swigt__p_key_t, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_std__vectorT_SemaphoreSetInfo_t[] = {
+    {&_swigt__p_std__vectorT_SemaphoreSetInfo_t, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_std__vectorT_SemaphoreV_p_t[] = {
+    {&_swigt__p_std__vectorT_SemaphoreV_p_t, 0, 0, 0}, {0, 0, 0, 0}};
+static swig_cast_info _swigc__p_std__vectorT_unsigned_short_t[] = {
+    {&_swigt__p_std__vectorT_unsigned_short_t, 0, 0, 0}, {0, 0, 0, 0}};
 
 static swig_cast_info *swig_cast_initial[] = {
+    _swigc__p_Barrier,
+    _swigc__p_Condition,
+    _swigc__p_CountdownLatch,
+    _swigc__p_Event,
+    _swigc__p_NamedSemaphore,
+    _swigc__p_RecursiveMutex,
+    _swigc__p_RwLock,
+    _swigc__p_SemaphoreArray,
+    _swigc__p_SemaphoreE,
+    _swigc__p_SemaphoreF,
+    _swigc__p_SemaphoreLimits,
+    _swigc__p_SemaphoreNamespace,
+    _swigc__p_SemaphoreP,
+    _swigc__p_SemaphoreSetInfo,
+    _swigc__p_SemaphoreSharded,
     _swigc__p_SemaphoreV,
     _swigc__p_Token,
     _swigc__p_char,
     _swigc__p_key_t,
+    _swigc__p_std__vectorT_SemaphoreSetInfo_t,
+    _swigc__p_std__vectorT_SemaphoreV_p_t,
+    _swigc__p_std__vectorT_unsigned_short_t,
 };
 
 /* -------- TYPE CONVERSION AND EQUIVALENCE RULES (END) -------- */
@@ -3341,16 +22670,196 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
   Napi::FunctionReference *_exports_Token_ctor_ref = new Napi::FunctionReference();
   *_exports_Token_ctor_ref = Napi::Persistent(_exports_Token_ctor);
   env.GetInstanceData<EnvInstanceData>()->ctor[0] = _exports_Token_ctor_ref;
+  /* Class: SemaphoreLimits (_exports_SemaphoreLimits) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreLimits_ctor = _exports_SemaphoreLimits_inst::GetClass(env);
+  exports.Set("SemaphoreLimits", _exports_SemaphoreLimits_ctor);
+  if (SWIGTYPE_p_SemaphoreLimits->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreLimits->clientdata = new size_t(1);
+  }
+  Napi::FunctionReference *_exports_SemaphoreLimits_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreLimits_ctor_ref = Napi::Persistent(_exports_SemaphoreLimits_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[1] = _exports_SemaphoreLimits_ctor_ref;
+  /* Class: SemaphoreSetInfo (_exports_SemaphoreSetInfo) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreSetInfo_ctor = _exports_SemaphoreSetInfo_inst::GetClass(env);
+  exports.Set("SemaphoreSetInfo", _exports_SemaphoreSetInfo_ctor);
+  if (SWIGTYPE_p_SemaphoreSetInfo->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreSetInfo->clientdata = new size_t(2);
+  }
+  Napi::FunctionReference *_exports_SemaphoreSetInfo_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreSetInfo_ctor_ref = Napi::Persistent(_exports_SemaphoreSetInfo_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[2] = _exports_SemaphoreSetInfo_ctor_ref;
+  /* Class: UnsignedShortList (_exports_UnsignedShortList) */
+  // jsnapi_registerclass
+  Napi::Function _exports_UnsignedShortList_ctor = _exports_UnsignedShortList_inst::GetClass(env);
+  exports.Set("UnsignedShortList", _exports_UnsignedShortList_ctor);
+  if (SWIGTYPE_p_std__vectorT_unsigned_short_t->clientdata == nullptr) {
+    SWIGTYPE_p_std__vectorT_unsigned_short_t->clientdata = new size_t(3);
+  }
+  Napi::FunctionReference *_exports_UnsignedShortList_ctor_ref = new Napi::FunctionReference();
+  *_exports_UnsignedShortList_ctor_ref = Napi::Persistent(_exports_UnsignedShortList_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[3] = _exports_UnsignedShortList_ctor_ref;
+  /* Class: SemaphoreSetInfoList (_exports_SemaphoreSetInfoList) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreSetInfoList_ctor = _exports_SemaphoreSetInfoList_inst::GetClass(env);
+  exports.Set("SemaphoreSetInfoList", _exports_SemaphoreSetInfoList_ctor);
+  if (SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t->clientdata == nullptr) {
+    SWIGTYPE_p_std__vectorT_SemaphoreSetInfo_t->clientdata = new size_t(4);
+  }
+  Napi::FunctionReference *_exports_SemaphoreSetInfoList_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreSetInfoList_ctor_ref = Napi::Persistent(_exports_SemaphoreSetInfoList_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[4] = _exports_SemaphoreSetInfoList_ctor_ref;
   /* Class: SemaphoreV (_exports_SemaphoreV) */
   // jsnapi_registerclass
   Napi::Function _exports_SemaphoreV_ctor = _exports_SemaphoreV_inst::GetClass(env);
   exports.Set("SemaphoreV", _exports_SemaphoreV_ctor);
   if (SWIGTYPE_p_SemaphoreV->clientdata == nullptr) {
-    SWIGTYPE_p_SemaphoreV->clientdata = new size_t(1);
+    SWIGTYPE_p_SemaphoreV->clientdata = new size_t(5);
   }
   Napi::FunctionReference *_exports_SemaphoreV_ctor_ref = new Napi::FunctionReference();
   *_exports_SemaphoreV_ctor_ref = Napi::Persistent(_exports_SemaphoreV_ctor);
-  env.GetInstanceData<EnvInstanceData>()->ctor[1] = _exports_SemaphoreV_ctor_ref;
+  env.GetInstanceData<EnvInstanceData>()->ctor[5] = _exports_SemaphoreV_ctor_ref;
+  /* Class: SemaphoreVList (_exports_SemaphoreVList) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreVList_ctor = _exports_SemaphoreVList_inst::GetClass(env);
+  exports.Set("SemaphoreVList", _exports_SemaphoreVList_ctor);
+  if (SWIGTYPE_p_std__vectorT_SemaphoreV_p_t->clientdata == nullptr) {
+    SWIGTYPE_p_std__vectorT_SemaphoreV_p_t->clientdata = new size_t(6);
+  }
+  Napi::FunctionReference *_exports_SemaphoreVList_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreVList_ctor_ref = Napi::Persistent(_exports_SemaphoreVList_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[6] = _exports_SemaphoreVList_ctor_ref;
+  /* Class: SemaphoreE (_exports_SemaphoreE) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreE_ctor = _exports_SemaphoreE_inst::GetClass(env);
+  exports.Set("SemaphoreE", _exports_SemaphoreE_ctor);
+  if (SWIGTYPE_p_SemaphoreE->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreE->clientdata = new size_t(7);
+  }
+  Napi::FunctionReference *_exports_SemaphoreE_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreE_ctor_ref = Napi::Persistent(_exports_SemaphoreE_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[7] = _exports_SemaphoreE_ctor_ref;
+  /* Class: SemaphoreP (_exports_SemaphoreP) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreP_ctor = _exports_SemaphoreP_inst::GetClass(env);
+  exports.Set("SemaphoreP", _exports_SemaphoreP_ctor);
+  if (SWIGTYPE_p_SemaphoreP->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreP->clientdata = new size_t(8);
+  }
+  Napi::FunctionReference *_exports_SemaphoreP_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreP_ctor_ref = Napi::Persistent(_exports_SemaphoreP_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[8] = _exports_SemaphoreP_ctor_ref;
+  /* Class: SemaphoreF (_exports_SemaphoreF) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreF_ctor = _exports_SemaphoreF_inst::GetClass(env);
+  exports.Set("SemaphoreF", _exports_SemaphoreF_ctor);
+  if (SWIGTYPE_p_SemaphoreF->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreF->clientdata = new size_t(9);
+  }
+  Napi::FunctionReference *_exports_SemaphoreF_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreF_ctor_ref = Napi::Persistent(_exports_SemaphoreF_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[9] = _exports_SemaphoreF_ctor_ref;
+  /* Class: CountdownLatch (_exports_CountdownLatch) */
+  // jsnapi_registerclass
+  Napi::Function _exports_CountdownLatch_ctor = _exports_CountdownLatch_inst::GetClass(env);
+  exports.Set("CountdownLatch", _exports_CountdownLatch_ctor);
+  if (SWIGTYPE_p_CountdownLatch->clientdata == nullptr) {
+    SWIGTYPE_p_CountdownLatch->clientdata = new size_t(10);
+  }
+  Napi::FunctionReference *_exports_CountdownLatch_ctor_ref = new Napi::FunctionReference();
+  *_exports_CountdownLatch_ctor_ref = Napi::Persistent(_exports_CountdownLatch_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[10] = _exports_CountdownLatch_ctor_ref;
+  /* Class: Barrier (_exports_Barrier) */
+  // jsnapi_registerclass
+  Napi::Function _exports_Barrier_ctor = _exports_Barrier_inst::GetClass(env);
+  exports.Set("Barrier", _exports_Barrier_ctor);
+  if (SWIGTYPE_p_Barrier->clientdata == nullptr) {
+    SWIGTYPE_p_Barrier->clientdata = new size_t(11);
+  }
+  Napi::FunctionReference *_exports_Barrier_ctor_ref = new Napi::FunctionReference();
+  *_exports_Barrier_ctor_ref = Napi::Persistent(_exports_Barrier_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[11] = _exports_Barrier_ctor_ref;
+  /* Class: RwLock (_exports_RwLock) */
+  // jsnapi_registerclass
+  Napi::Function _exports_RwLock_ctor = _exports_RwLock_inst::GetClass(env);
+  exports.Set("RwLock", _exports_RwLock_ctor);
+  if (SWIGTYPE_p_RwLock->clientdata == nullptr) {
+    SWIGTYPE_p_RwLock->clientdata = new size_t(12);
+  }
+  Napi::FunctionReference *_exports_RwLock_ctor_ref = new Napi::FunctionReference();
+  *_exports_RwLock_ctor_ref = Napi::Persistent(_exports_RwLock_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[12] = _exports_RwLock_ctor_ref;
+  /* Class: Event (_exports_Event) */
+  // jsnapi_registerclass
+  Napi::Function _exports_Event_ctor = _exports_Event_inst::GetClass(env);
+  exports.Set("Event", _exports_Event_ctor);
+  if (SWIGTYPE_p_Event->clientdata == nullptr) {
+    SWIGTYPE_p_Event->clientdata = new size_t(13);
+  }
+  Napi::FunctionReference *_exports_Event_ctor_ref = new Napi::FunctionReference();
+  *_exports_Event_ctor_ref = Napi::Persistent(_exports_Event_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[13] = _exports_Event_ctor_ref;
+  /* Class: Condition (_exports_Condition) */
+  // jsnapi_registerclass
+  Napi::Function _exports_Condition_ctor = _exports_Condition_inst::GetClass(env);
+  exports.Set("Condition", _exports_Condition_ctor);
+  if (SWIGTYPE_p_Condition->clientdata == nullptr) {
+    SWIGTYPE_p_Condition->clientdata = new size_t(14);
+  }
+  Napi::FunctionReference *_exports_Condition_ctor_ref = new Napi::FunctionReference();
+  *_exports_Condition_ctor_ref = Napi::Persistent(_exports_Condition_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[14] = _exports_Condition_ctor_ref;
+  /* Class: RecursiveMutex (_exports_RecursiveMutex) */
+  // jsnapi_registerclass
+  Napi::Function _exports_RecursiveMutex_ctor = _exports_RecursiveMutex_inst::GetClass(env);
+  exports.Set("RecursiveMutex", _exports_RecursiveMutex_ctor);
+  if (SWIGTYPE_p_RecursiveMutex->clientdata == nullptr) {
+    SWIGTYPE_p_RecursiveMutex->clientdata = new size_t(15);
+  }
+  Napi::FunctionReference *_exports_RecursiveMutex_ctor_ref = new Napi::FunctionReference();
+  *_exports_RecursiveMutex_ctor_ref = Napi::Persistent(_exports_RecursiveMutex_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[15] = _exports_RecursiveMutex_ctor_ref;
+  /* Class: SemaphoreArray (_exports_SemaphoreArray) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreArray_ctor = _exports_SemaphoreArray_inst::GetClass(env);
+  exports.Set("SemaphoreArray", _exports_SemaphoreArray_ctor);
+  if (SWIGTYPE_p_SemaphoreArray->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreArray->clientdata = new size_t(16);
+  }
+  Napi::FunctionReference *_exports_SemaphoreArray_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreArray_ctor_ref = Napi::Persistent(_exports_SemaphoreArray_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[16] = _exports_SemaphoreArray_ctor_ref;
+  /* Class: SemaphoreSharded (_exports_SemaphoreSharded) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreSharded_ctor = _exports_SemaphoreSharded_inst::GetClass(env);
+  exports.Set("SemaphoreSharded", _exports_SemaphoreSharded_ctor);
+  if (SWIGTYPE_p_SemaphoreSharded->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreSharded->clientdata = new size_t(17);
+  }
+  Napi::FunctionReference *_exports_SemaphoreSharded_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreSharded_ctor_ref = Napi::Persistent(_exports_SemaphoreSharded_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[17] = _exports_SemaphoreSharded_ctor_ref;
+  /* Class: SemaphoreNamespace (_exports_SemaphoreNamespace) */
+  // jsnapi_registerclass
+  Napi::Function _exports_SemaphoreNamespace_ctor = _exports_SemaphoreNamespace_inst::GetClass(env);
+  exports.Set("SemaphoreNamespace", _exports_SemaphoreNamespace_ctor);
+  if (SWIGTYPE_p_SemaphoreNamespace->clientdata == nullptr) {
+    SWIGTYPE_p_SemaphoreNamespace->clientdata = new size_t(18);
+  }
+  Napi::FunctionReference *_exports_SemaphoreNamespace_ctor_ref = new Napi::FunctionReference();
+  *_exports_SemaphoreNamespace_ctor_ref = Napi::Persistent(_exports_SemaphoreNamespace_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[18] = _exports_SemaphoreNamespace_ctor_ref;
+  /* Class: NamedSemaphore (_exports_NamedSemaphore) */
+  // jsnapi_registerclass
+  Napi::Function _exports_NamedSemaphore_ctor = _exports_NamedSemaphore_inst::GetClass(env);
+  exports.Set("NamedSemaphore", _exports_NamedSemaphore_ctor);
+  if (SWIGTYPE_p_NamedSemaphore->clientdata == nullptr) {
+    SWIGTYPE_p_NamedSemaphore->clientdata = new size_t(19);
+  }
+  Napi::FunctionReference *_exports_NamedSemaphore_ctor_ref = new Napi::FunctionReference();
+  *_exports_NamedSemaphore_ctor_ref = Napi::Persistent(_exports_NamedSemaphore_ctor);
+  env.GetInstanceData<EnvInstanceData>()->ctor[19] = _exports_NamedSemaphore_ctor_ref;
 
   /* enable inheritance */
 
@@ -3374,6 +22883,46 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
   } while (0);
 
+  // Inheritance for _exports_SemaphoreLimits (SemaphoreLimits) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreLimits_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreLimits_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreSetInfo (SemaphoreSetInfo) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreSetInfo_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreSetInfo_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_UnsignedShortList (UnsignedShortList) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_UnsignedShortList_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_UnsignedShortList_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreSetInfoList (SemaphoreSetInfoList) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreSetInfoList_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreSetInfoList_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
   // Inheritance for _exports_SemaphoreV (SemaphoreV) <- SWIG_NAPI_ObjectWrap
   // jsnapi_setup_inheritance
   do {
@@ -3384,7 +22933,169 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
   } while (0);
 
+  // Inheritance for _exports_SemaphoreVList (SemaphoreVList) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreVList_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreVList_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreE (SemaphoreE) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreE_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreE_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreP (SemaphoreP) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreP_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreP_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreF (SemaphoreF) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreF_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreF_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_CountdownLatch (CountdownLatch) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_CountdownLatch_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_CountdownLatch_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_Barrier (Barrier) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_Barrier_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_Barrier_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_RwLock (RwLock) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_RwLock_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_RwLock_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_Event (Event) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_Event_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_Event_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_Condition (Condition) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_Condition_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_Condition_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_RecursiveMutex (RecursiveMutex) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_RecursiveMutex_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_RecursiveMutex_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreArray (SemaphoreArray) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreArray_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreArray_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreSharded (SemaphoreSharded) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreSharded_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreSharded_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_SemaphoreNamespace (SemaphoreNamespace) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_SemaphoreNamespace_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_SemaphoreNamespace_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
+  // Inheritance for _exports_NamedSemaphore (NamedSemaphore) <- SWIG_NAPI_ObjectWrap
+  // jsnapi_setup_inheritance
+  do {
+    Napi::Value protoBase, protoSub;
+    NAPI_CHECK_RESULT(_exports_NamedSemaphore_ctor.Get("prototype"), protoSub);
+    NAPI_CHECK_RESULT(SWIG_NAPI_ObjectWrap_ctor.Get("prototype"), protoBase);
+    NAPI_CHECK_MAYBE(setProto.Call({_exports_NamedSemaphore_ctor, SWIG_NAPI_ObjectWrap_ctor}));
+    NAPI_CHECK_MAYBE(setProto.Call({protoSub, protoBase}));
+  } while (0);
+
   /* create and register namespace objects */
+  // jsnapi_register_global_function
+  do {
+    Napi::PropertyDescriptor pd = Napi::PropertyDescriptor::Function("semaphoreLimits", _wrap_semaphoreLimits);
+    NAPI_CHECK_MAYBE(exports.DefineProperties({pd}));
+  } while (0);
+  // jsnapi_register_global_function
+  do {
+    Napi::PropertyDescriptor pd =
+        Napi::PropertyDescriptor::Function("semaphoreMaxOpsPerCall",
+                                                                             _wrap_semaphoreMaxOpsPerCall);
+    NAPI_CHECK_MAYBE(exports.DefineProperties({pd}));
+  } while (0);
+  // jsnapi_register_global_function
+  do {
+    Napi::PropertyDescriptor pd = Napi::PropertyDescriptor::Function("semaphoreMaxSetSize", _wrap_semaphoreMaxSetSize);
+    NAPI_CHECK_MAYBE(exports.DefineProperties({pd}));
+  } while (0);
+  // jsnapi_register_global_function
+  do {
+    Napi::PropertyDescriptor pd = Napi::PropertyDescriptor::Function("semaphoreList", _wrap_semaphoreList);
+    NAPI_CHECK_MAYBE(exports.DefineProperties({pd}));
+  } while (0);
 
   return exports;
   goto fail;
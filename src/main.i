@@ -2,8 +2,23 @@
 
 %{
 #define NAPI_ENABLE_CPP_EXCEPTIONS
+#include "barrier.h"
+#include "condition.h"
+#include "countdown-latch.h"
 #include "error.h"
+#include "event.h"
+#include "recursive-mutex.h"
+#include "rwlock.h"
+#include "semaphore-array.h"
+#include "semaphore-eventfd.h"
+#include "semaphore-futex.h"
+#include "semaphore-limits.h"
+#include "semaphore-list.h"
+#include "semaphore-namespace.h"
+#include "semaphore-posix.h"
+#include "semaphore-sharded.h"
 #include "semaphore-sysv.h"
+#include "wait-async.h"
 
 #include <napi.h>
 #include <errnoname.c>
@@ -12,6 +27,8 @@
 %}
 
 %include exception.i
+%include std_string.i
+%include std_vector.i
 %exception {
   try {
     $action
@@ -23,5 +40,48 @@
   }
 }
 
+// the promise-returning waits take the Napi::Env of the call rather than a JS argument, and return the promise
+typedef struct napi_env__ *napi_env;
+typedef struct napi_value__ *napi_value;
+%typemap(in, numinputs=0) napi_env "$1 = info.Env();"
+%typemap(out) napi_value "$result = Napi::Value(env, $1);"
+
 %include "token.h"
+%include "semaphore-limits.h"
+%include "semaphore-list.h"
+%template(UnsignedShortList) std::vector<unsigned short>;
+%template(SemaphoreSetInfoList) std::vector<SemaphoreSetInfo>;
 %include "semaphore-sysv.h"
+%template(SemaphoreVList) std::vector<SemaphoreV *>;
+%ignore SemaphoreE::close;
+%rename(close) SemaphoreE::cancelAndClose;
+%extend SemaphoreE {
+  napi_value waitAsync(napi_env env) { return waitAsync(env, $self, 1); }
+  napi_value waitAsync(napi_env env, unsigned value) { return waitAsync(env, $self, value); }
+  // rejects the pending waitAsync() promises with ECANCELED
+  void cancelAndClose() { cancelAndClose($self); }
+}
+%include "semaphore-eventfd.h"
+%include "semaphore-posix.h"
+// the tickets of SemaphoreF's waits are settled by the bindings, so JS has waitAsync() returning a promise instead
+%ignore FutexWaitError;
+%ignore SemaphoreF::completionFd;
+%ignore SemaphoreF::completed;
+%ignore SemaphoreF::waitAsync();
+%ignore SemaphoreF::close;
+%rename(close) SemaphoreF::cancelAndClose;
+%extend SemaphoreF {
+  napi_value waitAsync(napi_env env) { return waitAsync(env, $self); }
+  // rejects the pending waitAsync() promises with ECANCELED
+  void cancelAndClose() { cancelAndClose($self); }
+}
+%include "semaphore-futex.h"
+%include "countdown-latch.h"
+%include "barrier.h"
+%include "rwlock.h"
+%include "event.h"
+%include "condition.h"
+%include "recursive-mutex.h"
+%include "semaphore-array.h"
+%include "semaphore-sharded.h"
+%include "semaphore-namespace.h"
@@ -1,95 +1,253 @@
 #include "syscalls.h"
 #include <cerrno>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <queue>
+#include <random>
+#include <unistd.h>
+#include <vector>
 
-static const char *const syscall_names[4] = {"MOCK_SEMGET", "MOCK_SEMOP", "MOCK_SEMCTL", "MOCK_FTOK"};
+#define MOCK_SYSCALLS 5
+
+static const char *const syscall_names[MOCK_SYSCALLS] = {"MOCK_SEMGET", "MOCK_SEMOP", "MOCK_SEMCTL", "MOCK_FTOK",
+                                                         "MOCK_SEMTIMEDOP"};
+
+struct MockFault {
+  MockSyscall syscall;
+  int errno_value;       // 0 for a latency only fault
+  unsigned microseconds; // latency added before the call is handled
+  double probability;
+};
+
+// all of the mock state is shared between threads and guarded by this mutex, except the per thread queues which are
+// only ever touched by their own thread
+static std::mutex mock_mutex;
+static std::condition_variable sequence_changed;
+static unsigned completed_sequence;
 
 static std::queue<MockCall> call_queue;
+static std::map<int, std::queue<MockCall>> semid_queues;
+static thread_local std::queue<MockCall> thread_queue;
+static std::vector<MockFault> faults;
+static std::mt19937 fault_random;
+static unsigned fault_counts[MOCK_SYSCALLS];
+static unsigned call_counts[MOCK_SYSCALLS];
 
-void mock_push_expected_call(MockCall call) { call_queue.push(call); }
+// how long a call waits for the calls sequenced before it, before failing with ETIMEDOUT
+static const std::chrono::seconds sequence_timeout(5);
+
+void mock_push_expected_call(MockCall call) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  call_queue.push(call);
+}
+
+void mock_push_thread_call(MockCall call) { thread_queue.push(call); }
+
+void mock_push_semid_call(MockCall call) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  bool semop = call.syscall == MOCK_SEMOP || call.syscall == MOCK_SEMTIMEDOP;
+  int semid = semop ? call.args.semop.semid : call.args.semctl.semid;
+  semid_queues[semid].push(call);
+}
 
 void mock_reset(void) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
   while (!call_queue.empty()) {
     call_queue.pop();
   }
+  while (!thread_queue.empty()) {
+    thread_queue.pop();
+  }
+  semid_queues.clear();
+  faults.clear();
+  completed_sequence = 0;
+  memset(fault_counts, 0, sizeof(fault_counts));
+  memset(call_counts, 0, sizeof(call_counts));
+}
+
+size_t mock_pending_calls(void) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  size_t pending = call_queue.size() + thread_queue.size();
+  for (const auto &entry : semid_queues) {
+    pending += entry.second.size();
+  }
+  return pending;
 }
 
-static MockCall *pop_call(MockSyscall expected_syscall, bool *args_match) {
-  *args_match = true;
-  static MockCall call;
+unsigned mock_call_count(MockSyscall syscall) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  return call_counts[syscall];
+}
+
+void mock_fault_seed(unsigned seed) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  fault_random.seed(seed);
+}
+
+void mock_fault_inject(MockSyscall syscall, int errno_value, double probability) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  faults.push_back({syscall, errno_value, 0, probability});
+}
+
+void mock_latency_inject(MockSyscall syscall, unsigned microseconds, double probability) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  faults.push_back({syscall, 0, microseconds, probability});
+}
+
+unsigned mock_fault_count(MockSyscall syscall) {
+  std::lock_guard<std::mutex> lock(mock_mutex);
+  return fault_counts[syscall];
+}
+
+// returns true if an error fault fired, in which case errno is set and the queued call must not be consumed
+static bool inject_fault(MockSyscall syscall) {
+  std::uniform_real_distribution<double> roll(0.0, 1.0);
+  unsigned latency = 0;
+  int errno_value = 0;
+
+  {
+    std::lock_guard<std::mutex> lock(mock_mutex);
+    call_counts[syscall]++;
+    for (const MockFault &fault : faults) {
+      if (fault.syscall != syscall || roll(fault_random) >= fault.probability) {
+        continue;
+      }
+      latency += fault.microseconds;
+      if (fault.errno_value) {
+        fault_counts[syscall]++;
+        errno_value = fault.errno_value;
+        break;
+      }
+    }
+  }
 
-  if (call_queue.empty()) {
+  // sleep without the lock so other threads are not held up by the latency
+  if (latency) {
+    usleep(latency);
+  }
+  if (errno_value) {
+    errno = errno_value;
+    return true;
+  }
+  return false;
+}
+
+// Calls are taken from the calling thread's queue first, then the queue for the semid (semop, semtimedop and semctl
+// only), then the shared queue. A call with a sequence number waits until every lower sequence number has been made.
+static bool pop_call(MockSyscall expected_syscall, int semid, MockCall *call) {
+  if (inject_fault(expected_syscall)) {
+    return false;
+  }
+
+  std::unique_lock<std::mutex> lock(mock_mutex);
+  std::queue<MockCall> *queue = &call_queue;
+  if (!thread_queue.empty()) {
+    queue = &thread_queue;
+  } else if (semid != -1) {
+    auto found = semid_queues.find(semid);
+    if (found != semid_queues.end() && !found->second.empty()) {
+      queue = &found->second;
+    }
+  }
+
+  if (queue->empty()) {
     fprintf(stderr, "[MOCK] No call queued\n");
     errno = ENOSYS; // Function not implemented
-    return nullptr;
+    return false;
   }
 
-  call = call_queue.front();
-  call_queue.pop();
+  *call = queue->front();
+  queue->pop();
 
-  if (call.syscall != expected_syscall) {
+  if (call->syscall != expected_syscall) {
     fprintf(stderr, "[MOCK] Expected syscall %s but got %s\n", syscall_names[expected_syscall],
-            syscall_names[call.syscall]);
+            syscall_names[call->syscall]);
     errno = ENODATA; // No data available (args mismatch)
-    *args_match = false;
-    return nullptr;
+    return false;
+  }
+
+  if (call->sequence) {
+    if (!sequence_changed.wait_for(lock, sequence_timeout,
+                                   [call] { return completed_sequence + 1 >= call->sequence; })) {
+      fprintf(stderr, "[MOCK] %s sequence %u timed out waiting for sequence %u\n", syscall_names[expected_syscall],
+              call->sequence, completed_sequence + 1);
+      errno = ETIMEDOUT;
+      return false;
+    }
+    completed_sequence = call->sequence;
+    sequence_changed.notify_all();
   }
 
-  errno = call.errno_value;
-  return &call;
+  errno = call->errno_value;
+  return true;
 }
 
 // ---------------- Mocks ------------------
 
 extern "C" int semget(key_t key, int nsems, int semflg) {
-  bool args_match;
-  MockCall *call = pop_call(MOCK_SEMGET, &args_match);
-  if (!call)
+  MockCall call;
+  if (!pop_call(MOCK_SEMGET, -1, &call))
     return -1;
 
-  if (call->args.semget.key != key || call->args.semget.nsems != nsems || call->args.semget.semflg != semflg) {
+  if (call.args.semget.key != key || call.args.semget.nsems != nsems || call.args.semget.semflg != semflg) {
     fprintf(
         stderr,
         "[MOCK] semget args mismatch: called with key=%d nsems=%d semflg=%d but expected key=%d nsems=%d semflg=%d\n",
-        key, nsems, semflg, call->args.semget.key, call->args.semget.nsems, call->args.semget.semflg);
+        key, nsems, semflg, call.args.semget.key, call.args.semget.nsems, call.args.semget.semflg);
     errno = ENODATA; // No data available (args mismatch)
     return -1;
   }
-  return call->return_value;
+  return call.return_value;
 }
 
-extern "C" int semop(int semid, struct sembuf *sops, size_t nsops) {
-  bool args_match;
-  MockCall *call = pop_call(MOCK_SEMOP, &args_match);
-  if (!call)
-    return -1;
-
-  if (call->args.semop.semid != semid || call->args.semop.nsops != nsops) {
-    fprintf(stderr, "[MOCK] semop args mismatch: called with semid=%d nsops=%zu but expected semid=%d nsops=%zu\n",
-            semid, nsops, call->args.semop.semid, call->args.semop.nsops);
+static int check_semop(const char *name, const MockCall &call, int semid, struct sembuf *sops, size_t nsops) {
+  if (call.args.semop.semid != semid || call.args.semop.nsops != nsops) {
+    fprintf(stderr, "[MOCK] %s args mismatch: called with semid=%d nsops=%zu but expected semid=%d nsops=%zu\n", name,
+            semid, nsops, call.args.semop.semid, call.args.semop.nsops);
     errno = ENODATA;
     return -1;
   }
 
   // Validate each sembuf in the array
   for (size_t i = 0; i < nsops; i++) {
-    const sembuf &op = call->args.semop.sops[i];
+    const sembuf &op = call.args.semop.sops[i];
     if (op.sem_num != sops[i].sem_num || op.sem_op != sops[i].sem_op || op.sem_flg != sops[i].sem_flg) {
       fprintf(stderr,
-              "[MOCK] semop args mismatch: called with sembuf[%zu]={sem_num=%d, sem_op=%d, sem_flg=%d} but expected "
+              "[MOCK] %s args mismatch: called with sembuf[%zu]={sem_num=%d, sem_op=%d, sem_flg=%d} but expected "
               "sembuf[%zu]={sem_num=%d, sem_op=%d, sem_flg=%d}\n",
-              i, sops[i].sem_num, sops[i].sem_op, sops[i].sem_flg, i, op.sem_num, op.sem_op, op.sem_flg);
+              name, i, sops[i].sem_num, sops[i].sem_op, sops[i].sem_flg, i, op.sem_num, op.sem_op, op.sem_flg);
       errno = ENODATA;
       return -1;
     }
   }
 
-  return call->return_value;
+  return call.return_value;
+}
+
+extern "C" int semop(int semid, struct sembuf *sops, size_t nsops) {
+  MockCall call;
+  if (!pop_call(MOCK_SEMOP, semid, &call))
+    return -1;
+
+  return check_semop("semop", call, semid, sops, nsops);
+}
+
+#ifdef __linux__
+extern "C" int semtimedop(int semid, struct sembuf *sops, size_t nsops, const struct timespec *timeout) {
+  (void)timeout; // the mocked result is returned at once, whatever the timeout
+  MockCall call;
+  if (!pop_call(MOCK_SEMTIMEDOP, semid, &call))
+    return -1;
+
+  return check_semop("semtimedop", call, semid, sops, nsops);
 }
+#endif
 
 extern "C" int semctl(int semid, int semnum, int cmd, ...) {
   va_list ap;
@@ -97,45 +255,43 @@ extern "C" int semctl(int semid, int semnum, int cmd, ...) {
   semun arg = va_arg(ap, semun);
   va_end(ap);
 
-  bool args_match;
-  MockCall *call = pop_call(MOCK_SEMCTL, &args_match);
-  if (!call)
+  MockCall call;
+  if (!pop_call(MOCK_SEMCTL, semid, &call))
     return -1;
 
-  if (call->args.semctl.semid != semid || call->args.semctl.semnum != semnum || call->args.semctl.cmd != cmd) {
+  if (call.args.semctl.semid != semid || call.args.semctl.semnum != semnum || call.args.semctl.cmd != cmd) {
     fprintf(
         stderr,
         "[MOCK] semctl args mismatch: called with semid=%d semnum=%d cmd=%d but expected semid=%d semnum=%d cmd=%d\n",
-        semid, semnum, cmd, call->args.semctl.semid, call->args.semctl.semnum, call->args.semctl.cmd);
+        semid, semnum, cmd, call.args.semctl.semid, call.args.semctl.semnum, call.args.semctl.cmd);
     errno = ENODATA;
     return -1;
   }
 
   if (cmd == SETVAL) {
-    if (arg.val != call->args.semctl.arg.val) {
+    if (arg.val != call.args.semctl.arg.val) {
       fprintf(stderr, "[MOCK] semctl args mismatch: called with arg.val=%d but expected arg.val=%d\n", arg.val,
-              call->args.semctl.arg.val);
+              call.args.semctl.arg.val);
       errno = ENODATA;
       return -1;
     }
   }
 
-  return call->return_value;
+  return call.return_value;
 }
 
 extern "C" key_t ftok(const char *pathname, int proj_id) {
-  bool args_match;
-  MockCall *call = pop_call(MOCK_FTOK, &args_match);
-  if (!call)
+  MockCall call;
+  if (!pop_call(MOCK_FTOK, -1, &call))
     return -1;
 
-  if (strcmp(call->args.ftok_args.pathname, pathname) != 0 || call->args.ftok_args.proj_id != proj_id) {
+  if (strcmp(call.args.ftok_args.pathname, pathname) != 0 || call.args.ftok_args.proj_id != proj_id) {
     fprintf(stderr,
             "[MOCK] ftok args mismatch: called with pathname=%s proj_id=%d but expected pathname=%s proj_id=%d\n",
-            pathname, proj_id, call->args.ftok_args.pathname, call->args.ftok_args.proj_id);
+            pathname, proj_id, call.args.ftok_args.pathname, call.args.ftok_args.proj_id);
     errno = ENODATA;
     return -1;
   }
 
-  return call->return_value;
+  return call.return_value;
 }
\ No newline at end of file
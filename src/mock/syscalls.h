@@ -17,7 +17,7 @@ union semun {
 extern "C" {
 #endif
 
-typedef enum { MOCK_SEMGET, MOCK_SEMOP, MOCK_SEMCTL, MOCK_FTOK } MockSyscall;
+typedef enum { MOCK_SEMGET, MOCK_SEMOP, MOCK_SEMCTL, MOCK_FTOK, MOCK_SEMTIMEDOP } MockSyscall;
 
 typedef struct {
   MockSyscall syscall;
@@ -34,7 +34,7 @@ typedef struct {
       int semid;
       const struct sembuf *sops;
       size_t nsops;
-    } semop;
+    } semop; // also semtimedop, whose timeout is not checked
 
     struct {
       int semid;
@@ -49,10 +49,32 @@ typedef struct {
     } ftok_args;
   } args;
 
+  // when non zero the call is not made until the calls with sequence numbers 1 to sequence - 1 have been made
+  unsigned sequence;
 } MockCall;
 
+// Expected calls can be queued on the shared queue, on the calling thread's own queue, or on a queue for the semid of
+// a semop, semtimedop or semctl call. A mocked syscall takes from its thread's queue first, then its semid's queue,
+// then the shared queue, so concurrent threads can each script their own calls. The mock is safe to use from many
+// threads; mock_reset only clears the queue of the thread that calls it.
 void mock_push_expected_call(MockCall call);
+void mock_push_thread_call(MockCall call);
+void mock_push_semid_call(MockCall call);
 void mock_reset(void);
+size_t mock_pending_calls(void);
+
+// Counting: every call into the mock is counted per syscall, whether it was expected, mismatched or faulted, so tests
+// can pin the number of kernel calls a public API call makes. Counts are cleared by mock_reset.
+unsigned mock_call_count(MockSyscall syscall);
+
+// Fault injection: before an expected call is consumed, each fault registered for that syscall is rolled and, on a
+// hit, the syscall fails with errno_value without consuming the queue. This lets retry loops run against the same
+// expectations they would see without faults. A probability of 1.0 for an error that is retried (EINTR) never
+// terminates, so storms should use probabilities below 1.
+void mock_fault_seed(unsigned seed);
+void mock_fault_inject(MockSyscall syscall, int errno_value, double probability);
+void mock_latency_inject(MockSyscall syscall, unsigned microseconds, double probability);
+unsigned mock_fault_count(MockSyscall syscall);
 
 #ifdef __cplusplus
 }
@@ -1,7 +1,11 @@
 #include "syscalls.h"
+#include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <sys/sem.h>
+#include <thread>
+#include <vector>
 
 class MockSyscallsTest : public ::testing::Test {
 protected:
@@ -70,6 +74,23 @@ TEST_F(MockSyscallsTest, SemopMockWorks) {
   EXPECT_EQ(errno, 0);
 }
 
+#ifdef __linux__
+TEST_F(MockSyscallsTest, SemtimedopMockWorks) {
+  struct sembuf ops[1] = {{0, 0, 0}};
+  struct timespec timeout = {0, 1000000};
+
+  mock_push_expected_call({.syscall = MOCK_SEMTIMEDOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 1234, .sops = ops, .nsops = 1}}});
+
+  EXPECT_EQ(semtimedop(1234, ops, 1, &timeout), -1);
+  EXPECT_EQ(errno, EAGAIN);
+  EXPECT_EQ(mock_call_count(MOCK_SEMTIMEDOP), 1u);
+  EXPECT_EQ(mock_call_count(MOCK_SEMOP), 0u);
+}
+#endif
+
 TEST_F(MockSyscallsTest, SemctlMockWorks) {
   mock_push_expected_call({.syscall = MOCK_SEMCTL,
                            .return_value = 5,
@@ -108,6 +129,7 @@ TEST_F(MockSyscallsTest, MockCallsRunInOrder) {
   EXPECT_EQ(errno, 0);
 
   // Queue should be empty now
+  EXPECT_EQ(mock_pending_calls(), 0u);
   EXPECT_EQ(ftok("test", 42), -1);
   EXPECT_EQ(errno, ENOSYS);
 }
@@ -211,6 +233,209 @@ TEST_F(MockSyscallsTest, SemctlArgumentMismatchTests) {
   EXPECT_EQ(errno, ENODATA);
 }
 
+TEST_F(MockSyscallsTest, FaultDoesNotConsumeQueuedCall) {
+  mock_fault_inject(MOCK_SEMGET, ENOSPC, 1.0);
+  mock_push_expected_call({.syscall = MOCK_SEMGET,
+                           .return_value = 5678,
+                           .errno_value = 0,
+                           .args = {.semget = {.key = 1234, .nsems = 2, .semflg = 0600}}});
+
+  EXPECT_EQ(semget(1234, 2, 0600), -1);
+  EXPECT_EQ(errno, ENOSPC);
+  EXPECT_EQ(semget(1234, 2, 0600), -1);
+  EXPECT_EQ(errno, ENOSPC);
+  EXPECT_EQ(mock_fault_count(MOCK_SEMGET), 2u);
+  EXPECT_EQ(mock_fault_count(MOCK_SEMOP), 0u);
+
+  // faults are cleared by a reset, so the queued call is still there afterwards if re-queued
+  mock_reset();
+  mock_push_expected_call({.syscall = MOCK_SEMGET,
+                           .return_value = 5678,
+                           .errno_value = 0,
+                           .args = {.semget = {.key = 1234, .nsems = 2, .semflg = 0600}}});
+  EXPECT_EQ(semget(1234, 2, 0600), 5678);
+  EXPECT_EQ(mock_fault_count(MOCK_SEMGET), 0u);
+}
+
+TEST_F(MockSyscallsTest, FaultsOnlyApplyToTheirSyscall) {
+  mock_fault_inject(MOCK_SEMOP, EINTR, 1.0);
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 5,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 1234, .semnum = 0, .cmd = GETVAL}}});
+
+  EXPECT_EQ(semctl(1234, 0, GETVAL), 5);
+  EXPECT_EQ(errno, 0);
+}
+
+TEST_F(MockSyscallsTest, FaultsAreReproducibleWithASeed) {
+  struct sembuf ops[1] = {{0, 1, SEM_UNDO}};
+  std::vector<int> runs[2];
+
+  for (auto &run : runs) {
+    mock_reset();
+    mock_fault_seed(26);
+    mock_fault_inject(MOCK_SEMOP, EINTR, 0.3);
+    mock_fault_inject(MOCK_SEMOP, EIDRM, 0.1);
+    for (int i = 0; i < 100; i++) {
+      mock_push_expected_call({.syscall = MOCK_SEMOP,
+                               .return_value = 0,
+                               .errno_value = 0,
+                               .args = {.semop = {.semid = 1234, .sops = ops, .nsops = 1}}});
+    }
+    for (int i = 0; i < 100; i++) {
+      run.push_back(semop(1234, ops, 1) == -1 ? errno : 0);
+    }
+  }
+
+  EXPECT_EQ(runs[0], runs[1]);
+  EXPECT_GT(mock_fault_count(MOCK_SEMOP), 0u);
+  EXPECT_LT(mock_fault_count(MOCK_SEMOP), 100u);
+}
+
+TEST_F(MockSyscallsTest, LatencyIsAddedBeforeTheCall) {
+  mock_latency_inject(MOCK_SEMCTL, 20000, 1.0);
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 5,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 1234, .semnum = 0, .cmd = GETVAL}}});
+
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(semctl(1234, 0, GETVAL), 5);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(20000));
+  EXPECT_EQ(mock_fault_count(MOCK_SEMCTL), 0u);
+}
+
+TEST_F(MockSyscallsTest, CallsAreCountedPerSyscall) {
+  struct sembuf ops[1] = {{0, 1, SEM_UNDO}};
+
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 1234, .sops = ops, .nsops = 1}}});
+  mock_fault_inject(MOCK_SEMCTL, EINTR, 1.0);
+
+  EXPECT_EQ(semop(1234, ops, 1), 0);
+  EXPECT_EQ(semop(1234, ops, 1), -1); // nothing queued, still counted
+  EXPECT_EQ(semctl(1234, 0, GETVAL), -1);
+
+  EXPECT_EQ(mock_call_count(MOCK_SEMOP), 2u);
+  EXPECT_EQ(mock_call_count(MOCK_SEMCTL), 1u);
+  EXPECT_EQ(mock_call_count(MOCK_SEMGET), 0u);
+  EXPECT_EQ(mock_call_count(MOCK_FTOK), 0u);
+
+  mock_reset();
+  EXPECT_EQ(mock_call_count(MOCK_SEMOP), 0u);
+}
+
+TEST_F(MockSyscallsTest, SharedQueueIsSafeAcrossThreads) {
+  struct sembuf ops[1] = {{0, 1, SEM_UNDO}};
+  const int threads = 8;
+  const int calls = 500;
+
+  for (int i = 0; i < threads * calls; i++) {
+    mock_push_expected_call({.syscall = MOCK_SEMOP,
+                             .return_value = 0,
+                             .errno_value = 0,
+                             .args = {.semop = {.semid = 1234, .sops = ops, .nsops = 1}}});
+  }
+
+  std::vector<std::thread> workers;
+  std::vector<int> failures(threads);
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t] {
+      for (int i = 0; i < calls; i++) {
+        failures[t] += semop(1234, ops, 1) != 0;
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  EXPECT_EQ(failures, std::vector<int>(threads, 0));
+  EXPECT_EQ(mock_call_count(MOCK_SEMOP), unsigned(threads * calls));
+  EXPECT_EQ(mock_pending_calls(), 0u);
+}
+
+TEST_F(MockSyscallsTest, ThreadQueuesAreTakenFirst) {
+  struct sembuf ops[1] = {{0, 1, SEM_UNDO}};
+
+  // the shared queue has a call that would fail if taken instead of the thread's own
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 5,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 1234, .semnum = 0, .cmd = GETVAL}}});
+
+  std::vector<std::thread> workers;
+  std::vector<int> results(4, -1);
+  for (int t = 0; t < 4; t++) {
+    workers.emplace_back([&, t] {
+      mock_push_thread_call({.syscall = MOCK_SEMOP,
+                             .return_value = t,
+                             .errno_value = 0,
+                             .args = {.semop = {.semid = 1000 + t, .sops = ops, .nsops = 1}}});
+      results[t] = semop(1000 + t, ops, 1);
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  EXPECT_EQ(results, std::vector<int>({0, 1, 2, 3}));
+  EXPECT_EQ(semctl(1234, 0, GETVAL), 5);
+}
+
+TEST_F(MockSyscallsTest, SemidQueuesAreTakenBeforeTheSharedQueue) {
+  struct sembuf ops[1] = {{0, 1, SEM_UNDO}};
+
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 1,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 1, .semnum = 0, .cmd = GETVAL}}});
+  mock_push_semid_call({.syscall = MOCK_SEMOP,
+                        .return_value = 0,
+                        .errno_value = 0,
+                        .args = {.semop = {.semid = 2, .sops = ops, .nsops = 1}}});
+  mock_push_semid_call({.syscall = MOCK_SEMCTL,
+                        .return_value = 2,
+                        .errno_value = 0,
+                        .args = {.semctl = {.semid = 2, .semnum = 0, .cmd = GETVAL}}});
+
+  EXPECT_EQ(semop(2, ops, 1), 0);
+  EXPECT_EQ(semctl(1, 0, GETVAL), 1);
+  EXPECT_EQ(semctl(2, 0, GETVAL), 2);
+  EXPECT_EQ(mock_pending_calls(), 0u);
+}
+
+TEST_F(MockSyscallsTest, SequencedCallsWaitForEarlierCalls) {
+  struct sembuf ops[1] = {{0, 1, SEM_UNDO}};
+  std::atomic<bool> made(false);
+
+  mock_push_semid_call({.syscall = MOCK_SEMOP,
+                        .return_value = 0,
+                        .errno_value = 0,
+                        .args = {.semop = {.semid = 1, .sops = ops, .nsops = 1}},
+                        .sequence = 2});
+  mock_push_semid_call({.syscall = MOCK_SEMOP,
+                        .return_value = 0,
+                        .errno_value = 0,
+                        .args = {.semop = {.semid = 2, .sops = ops, .nsops = 1}},
+                        .sequence = 1});
+
+  // the thread started first has the later sequence number so must wait for the call made here
+  std::thread later([&] {
+    EXPECT_EQ(semop(1, ops, 1), 0);
+    made = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(made);
+
+  EXPECT_EQ(semop(2, ops, 1), 0);
+  later.join();
+  EXPECT_TRUE(made);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,389 @@
+#include "recording.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <mutex>
+#include <new>
+#include <pthread.h>
+#include <string>
+#include <sys/ipc.h>
+#include <sys/sem.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+// An LD_PRELOAD interposer that passes semget/semop/semtimedop/semctl through to libc and records each call.
+//
+// Each thread appends to its own single producer, single consumer ring without locking or syscalls beyond the two
+// clock reads. A flusher thread drains the rings to the recording file every SEMREC_FLUSH_MS (default 100). When a
+// ring is full, records are dropped and counted rather than blocking the caller.
+//
+// SEMREC_FILE names the recording, default semrec.%p.bin, where %p is replaced with the pid so forked children write
+// their own file.
+
+#ifdef _SEM_SEMUN_UNDEFINED
+union semun {
+  int val;               /* Value for SETVAL */
+  struct semid_ds *buf;  /* Buffer for IPC_STAT, IPC_SET */
+  unsigned short *array; /* Array for GETALL, SETALL */
+  struct seminfo *__buf; /* Buffer for IPC_INFO (Linux-specific) */
+};
+#endif
+
+#define RING_SIZE 16384 // a power of 2, about 1MB per recording thread
+
+struct Ring {
+  Record records[RING_SIZE];
+  std::atomic<uint32_t> head{0}; // next slot the owning thread writes
+  std::atomic<uint32_t> tail{0}; // next slot the flusher reads
+  std::atomic<bool> owned{true}; // false once the owning thread has exited, so the ring can be reused
+  Ring *next = nullptr;
+};
+
+typedef int (*semget_t)(key_t, int, int);
+typedef int (*semop_t)(int, struct sembuf *, size_t);
+typedef int (*semctl_t)(int, int, int, ...);
+#ifdef __linux__
+typedef int (*semtimedop_t)(int, struct sembuf *, size_t, const struct timespec *);
+#endif
+
+static std::atomic<Ring *> rings{nullptr};
+static std::atomic<uint64_t> dropped{0};
+static std::atomic<int> started{0}; // 0 not started, 1 starting, 2 running
+static int recording_fd = -1;
+static std::mutex flush_mutex;
+static std::mutex flusher_mutex;
+static std::condition_variable flusher_wake;
+static bool flusher_stop = false;
+static std::thread *flusher = nullptr;
+
+static uint64_t now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int32_t threadId() {
+  static thread_local int32_t tid = 0;
+  if (!tid) {
+#ifdef __linux__
+    tid = (int32_t)syscall(SYS_gettid);
+#else
+    tid = (int32_t)(uintptr_t)pthread_self();
+#endif
+  }
+  return tid;
+}
+
+template <typename F> static F real(const char *name) {
+  void *symbol = dlsym(RTLD_NEXT, name);
+  if (!symbol) {
+    fprintf(stderr, "[SEMREC] cannot find %s in libc\n", name);
+    abort();
+  }
+  return (F)symbol;
+}
+
+// ---------------- Flushing ------------------
+
+static void openRecording() {
+  const char *pattern = getenv("SEMREC_FILE");
+  std::string path = pattern && *pattern ? pattern : "semrec.%p.bin";
+  size_t at = path.find("%p");
+  if (at != std::string::npos) {
+    path.replace(at, 2, std::to_string(getpid()));
+  }
+
+  recording_fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (recording_fd == -1) {
+    fprintf(stderr, "[SEMREC] cannot open %s: %s\n", path.c_str(), strerror(errno));
+    return;
+  }
+  RecordingHeader header;
+  memcpy(header.magic, RECORDING_MAGIC, sizeof(header.magic));
+  header.record_size = sizeof(Record);
+  header.pid = getpid();
+  if (write(recording_fd, &header, sizeof(header)) != sizeof(header)) {
+    fprintf(stderr, "[SEMREC] cannot write %s: %s\n", path.c_str(), strerror(errno));
+  }
+}
+
+static void drain(Ring *ring) {
+  uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+  uint32_t head = ring->head.load(std::memory_order_acquire);
+
+  while (tail != head) {
+    // write the contiguous run up to the end of the ring or the head, whichever is first
+    uint32_t first = tail % RING_SIZE;
+    uint32_t count = std::min(head - tail, RING_SIZE - first);
+    if (recording_fd != -1) {
+      size_t bytes = count * sizeof(Record);
+      if (write(recording_fd, &ring->records[first], bytes) != (ssize_t)bytes) {
+        fprintf(stderr, "[SEMREC] short write: %s\n", strerror(errno));
+      }
+    }
+    tail += count;
+    ring->tail.store(tail, std::memory_order_release);
+  }
+}
+
+extern "C" void semrec_flush(void) {
+  std::lock_guard<std::mutex> lock(flush_mutex);
+  for (Ring *ring = rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+    drain(ring);
+  }
+}
+
+extern "C" uint64_t semrec_dropped(void) { return dropped.load(std::memory_order_relaxed); }
+
+static void flushPeriodically() {
+  const char *interval = getenv("SEMREC_FLUSH_MS");
+  std::chrono::milliseconds period(interval ? atoi(interval) : 100);
+
+  // flusher_mutex is only held for the wait, so flushing never nests it with flush_mutex
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(flusher_mutex);
+      if (flusher_wake.wait_for(lock, period, [] { return flusher_stop; })) {
+        return;
+      }
+    }
+    semrec_flush();
+  }
+}
+
+static void stop() {
+  if (started.load() != 2) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(flusher_mutex);
+    flusher_stop = true;
+  }
+  flusher_wake.notify_one();
+  flusher->join();
+  semrec_flush();
+  close(recording_fd);
+  recording_fd = -1;
+  started = 0;
+  if (dropped.load()) {
+    fprintf(stderr, "[SEMREC] %llu records dropped, lower SEMREC_FLUSH_MS\n", (unsigned long long)dropped.load());
+  }
+}
+
+// fork with both mutexes held, so neither is copied into the child locked by a thread that does not exist there
+static void forking() {
+  flusher_mutex.lock();
+  flush_mutex.lock();
+}
+
+static void forkedParent() {
+  flush_mutex.unlock();
+  flusher_mutex.unlock();
+}
+
+// in a forked child the flusher thread is gone and the rings hold the parent's records, so start again
+static void forkedChild() {
+  flush_mutex.unlock();
+  flusher_mutex.unlock();
+  // the parent's flusher may be counted as waiting on the condition variable, which would block notify_one here
+  new (&flusher_wake) std::condition_variable();
+  for (Ring *ring = rings.load(); ring; ring = ring->next) {
+    ring->tail.store(ring->head.load());
+    ring->owned = false;
+  }
+  if (started.load() == 2) {
+    close(recording_fd);
+    recording_fd = -1;
+    flusher = nullptr; // the parent's thread object, which cannot be joined here
+  }
+  flusher_stop = false;
+  dropped = 0; // counted against the parent's recording
+  started = 0;
+}
+
+static void start() {
+  int expected = 0;
+  if (started.load(std::memory_order_acquire) == 2 || !started.compare_exchange_strong(expected, 1)) {
+    while (started.load(std::memory_order_acquire) == 1) {
+      std::this_thread::yield();
+    }
+    return;
+  }
+  static std::once_flag registered;
+  std::call_once(registered, [] {
+    pthread_atfork(forking, forkedParent, forkedChild);
+    atexit(stop);
+  });
+  openRecording();
+  flusher = new std::thread(flushPeriodically);
+  started.store(2, std::memory_order_release);
+}
+
+// ---------------- Recording ------------------
+
+static Ring *threadRing() {
+  static thread_local struct Owner {
+    Ring *ring = nullptr;
+    ~Owner() {
+      if (ring) {
+        ring->owned = false;
+      }
+    }
+  } owner;
+
+  if (owner.ring && owner.ring->owned) {
+    return owner.ring;
+  }
+
+  // reuse the ring of an exited thread once the flusher has emptied it, otherwise add a new one
+  for (Ring *ring = rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+    bool unowned = false;
+    if (ring->tail.load() == ring->head.load() && ring->owned.compare_exchange_strong(unowned, true)) {
+      return owner.ring = ring;
+    }
+  }
+  Ring *ring = new Ring();
+  ring->next = rings.load();
+  while (!rings.compare_exchange_weak(ring->next, ring)) {
+  }
+  return owner.ring = ring;
+}
+
+// set while the thread is between beginRecord and endRecord, so a semaphore call made by a signal handler that
+// interrupted it is passed through and counted as dropped rather than written over the record in progress
+static thread_local bool recording = false;
+
+static Record *beginRecord(RecordSyscall syscall) {
+  if (recording) {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  if (started.load(std::memory_order_acquire) != 2) {
+    start();
+  }
+  Ring *ring = threadRing();
+  uint32_t head = ring->head.load(std::memory_order_relaxed);
+  if (head - ring->tail.load(std::memory_order_acquire) == RING_SIZE) {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  recording = true;
+  Record *record = &ring->records[head % RING_SIZE];
+  memset(record, 0, sizeof(*record));
+  record->syscall = syscall;
+  record->tid = threadId();
+  return record;
+}
+
+static void endRecord(Record *record, int result, int errno_value) {
+  record->duration = now() - record->start;
+  record->result = result;
+  record->errno_value = result == -1 ? errno_value : 0;
+  Ring *ring = threadRing();
+  ring->head.store(ring->head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  recording = false;
+}
+
+static void recordOps(Record *record, int semid, struct sembuf *sops, size_t nsops) {
+  record->semid = semid;
+  record->nsops = nsops > 255 ? 255 : nsops;
+  for (size_t i = 0; i < nsops && i < RECORDING_MAX_SOPS; i++) {
+    record->sops[i] = {sops[i].sem_num, sops[i].sem_op, sops[i].sem_flg};
+  }
+}
+
+// ---------------- Interposers ------------------
+
+extern "C" int semget(key_t key, int nsems, int semflg) {
+  static semget_t libc_semget = real<semget_t>("semget");
+  Record *record = beginRecord(RECORD_SEMGET);
+  if (!record) {
+    return libc_semget(key, nsems, semflg);
+  }
+  record->semid = key;
+  record->arg = nsems;
+  record->value = semflg;
+  record->start = now();
+  int result = libc_semget(key, nsems, semflg);
+  int saved = errno;
+  endRecord(record, result, saved);
+  errno = saved;
+  return result;
+}
+
+extern "C" int semop(int semid, struct sembuf *sops, size_t nsops) {
+  static semop_t libc_semop = real<semop_t>("semop");
+  Record *record = beginRecord(RECORD_SEMOP);
+  if (!record) {
+    return libc_semop(semid, sops, nsops);
+  }
+  recordOps(record, semid, sops, nsops);
+  record->start = now();
+  int result = libc_semop(semid, sops, nsops);
+  int saved = errno;
+  endRecord(record, result, saved);
+  errno = saved;
+  return result;
+}
+
+#ifdef __linux__
+// rounded up, so a timeout shorter than a millisecond is not replayed as a trywait, or -1 for no timeout
+static int32_t milliseconds(const struct timespec *timeout) {
+  if (!timeout) {
+    return -1;
+  }
+  const uint64_t milliseconds = (uint64_t)timeout->tv_sec * 1000 + (timeout->tv_nsec + 999999) / 1000000;
+  return milliseconds > INT32_MAX ? INT32_MAX : (int32_t)milliseconds;
+}
+
+extern "C" int semtimedop(int semid, struct sembuf *sops, size_t nsops, const struct timespec *timeout) {
+  static semtimedop_t libc_semtimedop = real<semtimedop_t>("semtimedop");
+  Record *record = beginRecord(RECORD_SEMTIMEDOP);
+  if (!record) {
+    return libc_semtimedop(semid, sops, nsops, timeout);
+  }
+  recordOps(record, semid, sops, nsops);
+  record->value = milliseconds(timeout);
+  record->start = now();
+  int result = libc_semtimedop(semid, sops, nsops, timeout);
+  int saved = errno;
+  endRecord(record, result, saved);
+  errno = saved;
+  return result;
+}
+#endif
+
+extern "C" int semctl(int semid, int semnum, int cmd, ...) {
+  static semctl_t libc_semctl = real<semctl_t>("semctl");
+  va_list ap;
+  va_start(ap, cmd);
+  semun arg = va_arg(ap, semun);
+  va_end(ap);
+
+  Record *record = beginRecord(RECORD_SEMCTL);
+  if (!record) {
+    return libc_semctl(semid, semnum, cmd, arg);
+  }
+  record->semid = semid;
+  record->arg = semnum;
+  record->cmd = cmd;
+  if (cmd == SETVAL) {
+    record->value = arg.val;
+  }
+  record->start = now();
+  int result = libc_semctl(semid, semnum, cmd, arg);
+  int saved = errno;
+  endRecord(record, result, saved);
+  errno = saved;
+  return result;
+}
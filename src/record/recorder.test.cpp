@@ -0,0 +1,248 @@
+#include "recording.h"
+#include "semaphore-sysv.h"
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <csignal>
+#include <ctime>
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <string>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Linked with libsemrec, so the SemaphoreV calls made here are recorded into the file named by SEMREC_FILE.
+
+static char recording_path[] = "/tmp/semrec-test-XXXXXX";
+
+class RecorderTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semrec-key-XXXXXX";
+  Token *key = nullptr;
+  uint64_t started;
+
+  void SetUp() override {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    started = (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1);
+    ::close(fd);
+    key = new Token(path, 'r');
+  }
+
+  void TearDown() override {
+    int semid = semget(**key, 0, 0);
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  // the records for semid made by this test, keys and semids can be reused by the kernel between tests
+  std::vector<Record> recorded(int semid) {
+    semrec_flush();
+    std::vector<Record> records;
+    for (const Record &record : readRecording(recording_path)) {
+      if (record.semid == semid && record.start >= started) {
+        records.push_back(record);
+      }
+    }
+    return records;
+  }
+};
+
+TEST_F(RecorderTest, RecordsEachCall) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 2);
+  int semid = semget(**key, 0, 0);
+
+  sem->wait();
+  EXPECT_FALSE(sem->trywait(2));
+  sem->post();
+  EXPECT_EQ(sem->valueOf(), 2u);
+
+  std::vector<Record> records = recorded(semid);
+  // the SETVAL and the creator's reference from createExclusive, wait, trywait, post and the GETVAL of valueOf are
+  // on this semid
+  ASSERT_EQ(records.size(), 6u);
+
+  EXPECT_EQ(records[0].syscall, RECORD_SEMCTL);
+  EXPECT_EQ(records[0].cmd, SETVAL);
+  EXPECT_EQ(records[0].value, 2);
+
+  EXPECT_EQ(records[1].syscall, RECORD_SEMOP);
+  EXPECT_EQ(records[1].sops[0].sem_num, 1);
+  EXPECT_EQ(records[1].sops[0].sem_op, 1);
+  records.erase(records.begin() + 1);
+
+  EXPECT_EQ(records[1].syscall, RECORD_SEMOP);
+  EXPECT_EQ(records[1].nsops, 1);
+  EXPECT_EQ(records[1].sops[0].sem_num, 0);
+  EXPECT_EQ(records[1].sops[0].sem_op, -1);
+  EXPECT_EQ(records[1].sops[0].sem_flg, SEM_UNDO);
+  EXPECT_EQ(records[1].result, 0);
+
+  EXPECT_EQ(records[2].sops[0].sem_op, -2);
+  EXPECT_EQ(records[2].sops[0].sem_flg, SEM_UNDO | IPC_NOWAIT);
+  EXPECT_EQ(records[2].result, -1);
+  EXPECT_EQ(records[2].errno_value, EAGAIN);
+
+  EXPECT_EQ(records[3].sops[0].sem_op, 1);
+
+  EXPECT_EQ(records[4].syscall, RECORD_SEMCTL);
+  EXPECT_EQ(records[4].cmd, GETVAL);
+  EXPECT_EQ(records[4].result, 2);
+
+  for (size_t i = 1; i < records.size(); i++) {
+    EXPECT_GE(records[i].start, records[i - 1].start + records[i - 1].duration);
+    EXPECT_EQ(records[i].tid, records[0].tid);
+  }
+
+  delete sem;
+}
+
+TEST_F(RecorderTest, RecordsBlockedTimeAndThreads) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 0);
+  int semid = semget(**key, 0, 0);
+
+  std::thread waiter([sem] { sem->wait(); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  sem->post();
+  waiter.join();
+
+  std::vector<Record> records = recorded(semid);
+  ASSERT_EQ(records.size(), 4u);
+  const Record *wait = nullptr;
+  const Record *post = nullptr;
+  for (const Record &record : records) {
+    if (record.syscall == RECORD_SEMOP && record.sops[0].sem_num == 0) {
+      (record.sops[0].sem_op < 0 ? wait : post) = &record;
+    }
+  }
+  ASSERT_NE(wait, nullptr);
+  ASSERT_NE(post, nullptr);
+  EXPECT_GE(wait->duration, 40000000u);
+  EXPECT_NE(wait->tid, post->tid);
+
+  delete sem;
+}
+
+#ifdef __linux__
+TEST_F(RecorderTest, RecordsTheTimeoutOfTimedWaits) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 0);
+  int semid = semget(**key, 0, 0);
+
+  EXPECT_FALSE(sem->timedwait(1, 20));
+
+  std::vector<Record> records = recorded(semid);
+  ASSERT_EQ(records.size(), 3u);
+  EXPECT_EQ(records[2].syscall, RECORD_SEMTIMEDOP);
+  EXPECT_EQ(records[2].sops[0].sem_op, -1);
+  EXPECT_EQ(records[2].errno_value, EAGAIN);
+  EXPECT_EQ(records[2].value, 20);
+
+  delete sem;
+}
+#endif
+
+TEST_F(RecorderTest, RecordsFailedSemget) {
+  EXPECT_EQ(semget(**key, 0, 0), -1);
+
+  std::vector<Record> records = recorded(**key);
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0].syscall, RECORD_SEMGET);
+  EXPECT_EQ(records[0].errno_value, ENOENT);
+  EXPECT_EQ(semrec_dropped(), 0u);
+}
+
+static SemaphoreV *signalled = nullptr;
+
+static void postFromHandler(int) { signalled->post(); }
+
+TEST_F(RecorderTest, CallsFromASignalHandlerMidRecordAreDropped) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 0);
+  int semid = semget(**key, 0, 0);
+  signalled = sem;
+  struct sigaction action = {};
+  action.sa_handler = postFromHandler;
+  struct sigaction previous;
+  ASSERT_EQ(sigaction(SIGUSR1, &action, &previous), 0);
+  const uint64_t before = semrec_dropped();
+
+  // the post the handler makes interrupts the wait's semop, which then returns EINTR and takes the unit on its retry
+  pthread_t waiter = pthread_self();
+  std::thread signaller([waiter] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    pthread_kill(waiter, SIGUSR1);
+  });
+  sem->wait();
+  signaller.join();
+  sigaction(SIGUSR1, &previous, nullptr);
+
+  EXPECT_EQ(semrec_dropped(), before + 1);
+  std::vector<Record> records = recorded(semid);
+  ASSERT_EQ(records.size(), 4u);
+  EXPECT_EQ(records[2].sops[0].sem_op, -1);
+  EXPECT_EQ(records[2].errno_value, EINTR);
+  EXPECT_EQ(records[3].sops[0].sem_op, -1);
+  EXPECT_EQ(records[3].result, 0);
+
+  delete sem;
+}
+
+TEST_F(RecorderTest, ChildrenForkedWhileFlushingRecordAndExit) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 1);
+  std::atomic<bool> busy(true);
+  // keeps the rings full, so the flusher is flushing when the forks happen
+  std::thread recorder([&] {
+    while (busy) {
+      sem->wait();
+      sem->post();
+    }
+  });
+
+  char child_path[] = "/tmp/semrec-child-XXXXXX";
+  int fd = mkstemp(child_path);
+  ASSERT_NE(fd, -1);
+  ::close(fd);
+  int failed = -1;
+  int status = 0;
+  for (int i = 0; i < 200 && failed == -1; i++) {
+    pid_t child = fork();
+    if (child == 0) {
+      alarm(5); // a flusher deadlocked on a mutex inherited locked would otherwise hang the test
+      setenv("SEMREC_FILE", child_path, 1);
+      sem->post();
+      semrec_flush();
+      exit(0); // stops the child's flusher
+    }
+    if (child == -1 || waitpid(child, &status, 0) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      failed = i;
+    }
+  }
+  busy = false;
+  recorder.join();
+  ::unlink(child_path);
+  EXPECT_EQ(failed, -1) << "status " << status;
+
+  delete sem;
+}
+
+int main(int argc, char **argv) {
+  int fd = mkstemp(recording_path);
+  if (fd == -1) {
+    return 1;
+  }
+  close(fd);
+  // the recorder reads this when the first call is recorded
+  setenv("SEMREC_FILE", recording_path, 1);
+
+  ::testing::InitGoogleTest(&argc, argv);
+  int status = RUN_ALL_TESTS();
+  unlink(recording_path);
+  return status;
+}
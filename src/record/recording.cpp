@@ -0,0 +1,28 @@
+#include "recording.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <system_error>
+
+std::vector<Record> readRecording(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    throw std::system_error(errno, std::system_category(), "fopen");
+  }
+
+  RecordingHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, RECORDING_MAGIC, sizeof(header.magic)) ||
+      header.record_size != sizeof(Record)) {
+    fclose(file);
+    throw std::system_error(EINVAL, std::system_category(), "fread");
+  }
+
+  std::vector<Record> records;
+  Record record;
+  while (fread(&record, sizeof(record), 1, file) == 1) {
+    records.push_back(record);
+  }
+  fclose(file);
+  return records;
+}
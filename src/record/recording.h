@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+// The binary format written by the syscall recorder (libsemrec) and read back by the replay tool. A recording is a
+// RecordingHeader followed by fixed size Records in the order they were flushed, which is per thread call order but
+// not globally sorted; sort by start when the global order matters.
+
+#define RECORDING_MAGIC "SEMREC01"
+#define RECORDING_MAX_SOPS 4
+
+typedef enum { RECORD_SEMGET, RECORD_SEMOP, RECORD_SEMTIMEDOP, RECORD_SEMCTL } RecordSyscall;
+
+typedef struct {
+  char magic[8];
+  uint32_t record_size;
+  int32_t pid;
+} RecordingHeader;
+
+typedef struct {
+  uint16_t sem_num;
+  int16_t sem_op;
+  int16_t sem_flg;
+} RecordedOp;
+
+typedef struct {
+  uint64_t start;    // CLOCK_MONOTONIC nanoseconds when the call was made
+  uint64_t duration; // nanoseconds spent in the call, including time blocked
+  int32_t tid;
+  int32_t semid; // for semget this is the key
+  int32_t result;
+  int32_t errno_value; // 0 unless result is -1
+  uint8_t syscall;     // RecordSyscall
+  uint8_t nsops;       // number of ops in the call, only the first RECORDING_MAX_SOPS are kept in sops
+  int16_t cmd;         // semctl command
+  int32_t arg;         // semget nsems, semctl semnum
+  int32_t value;       // semget semflg, semctl SETVAL value, semtimedop timeout in milliseconds or -1 for none
+  RecordedOp sops[RECORDING_MAX_SOPS];
+} Record;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// flushes every thread's buffered records to the recording file, for use by hosts that want a consistent file
+// without exiting. Only defined when libsemrec is loaded.
+void semrec_flush(void);
+
+// records discarded because a thread's ring was full when the flusher fell behind, or because a signal handler made
+// the call while the thread was already in one being recorded
+uint64_t semrec_dropped(void);
+
+#ifdef __cplusplus
+}
+
+#include <vector>
+
+std::vector<Record> readRecording(const char *path);
+#endif
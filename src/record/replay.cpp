@@ -0,0 +1,255 @@
+#include "recording.h"
+#include "semaphore-sysv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sys/sem.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Replays the operation counter traffic of a recording against fresh SemaphoreV instances and reports throughput and
+// latency, so changes can be benchmarked against a realistic workload.
+//
+//   semreplay [--speed factor] [--initial value] [--trywait] recording
+//
+// Each recorded thread is replayed by its own thread, in its recorded order. With --speed the recorded gaps between a
+// thread's calls are kept, scaled by factor; without it the calls are made back to back. Each recorded semid gets its
+// own semaphore, initialised from the recorded SETVAL or with --initial. A semtimedop wait is replayed with its recorded
+// timeout. --trywait replaces blocking and timed waits with trywait, for recordings that would not balance when
+// replayed with a different interleaving.
+
+enum Operation { WAIT, TRYWAIT, TIMEDWAIT, POST, VALUE_OF, OPERATIONS };
+static const char *const operation_names[OPERATIONS] = {"wait", "trywait", "timedwait", "post", "valueOf"};
+
+struct Step {
+  Operation operation;
+  unsigned value;
+  unsigned timeout; // milliseconds, for TIMEDWAIT
+  int semid;        // the recorded semid
+  uint64_t start;   // the recorded start time
+  uint64_t duration;
+};
+
+struct Options {
+  double speed = 0;
+  int initial = 0;
+  bool trywait = false;
+  const char *path = nullptr;
+};
+
+static void usage() {
+  fprintf(stderr, "usage: semreplay [--speed factor] [--initial value] [--trywait] recording\n");
+  exit(2);
+}
+
+static Options parse(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--speed") && i + 1 < argc) {
+      options.speed = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--initial") && i + 1 < argc) {
+      options.initial = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--trywait")) {
+      options.trywait = true;
+    } else if (argv[i][0] != '-' && !options.path) {
+      options.path = argv[i];
+    } else {
+      usage();
+    }
+  }
+  if (!options.path) {
+    usage();
+  }
+  return options;
+}
+
+// only single op calls on the operation counter map onto the SemaphoreV API, reference counting and anything else is
+// part of creating and closing the semaphore which the replay does itself
+static bool toStep(const Record &record, Step *step) {
+  step->semid = record.semid;
+  step->start = record.start;
+  step->duration = record.duration;
+  if (record.result == -1 && record.errno_value != EAGAIN) {
+    return false;
+  }
+  if ((record.syscall == RECORD_SEMOP || record.syscall == RECORD_SEMTIMEDOP) && record.nsops == 1 &&
+      record.sops[0].sem_num == 0 && record.sops[0].sem_op) {
+    const RecordedOp &op = record.sops[0];
+    if (op.sem_op > 0) {
+      step->operation = POST;
+      step->value = op.sem_op;
+    } else if (op.sem_flg & IPC_NOWAIT) {
+      step->operation = TRYWAIT;
+      step->value = -op.sem_op;
+    } else if (record.syscall == RECORD_SEMTIMEDOP && record.value != -1) {
+      step->operation = TIMEDWAIT;
+      step->value = -op.sem_op;
+      step->timeout = record.value;
+    } else {
+      step->operation = WAIT;
+      step->value = -op.sem_op;
+    }
+    return true;
+  }
+  if (record.syscall == RECORD_SEMCTL && record.cmd == GETVAL && record.arg == 0) {
+    step->operation = VALUE_OF;
+    return true;
+  }
+  return false;
+}
+
+static uint64_t percentile(std::vector<uint64_t> &values, double p) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  return values[std::min(values.size() - 1, size_t(values.size() * p))];
+}
+
+int main(int argc, char **argv) {
+  Options options = parse(argc, argv);
+
+  std::vector<Record> records;
+  try {
+    records = readRecording(options.path);
+  } catch (std::system_error &e) {
+    fprintf(stderr, "semreplay: %s: %s\n", options.path, e.what());
+    return 1;
+  }
+
+  std::map<int32_t, std::vector<Step>> threads;
+  std::map<int32_t, int> initial;
+  uint64_t origin = UINT64_MAX;
+  for (const Record &record : records) {
+    Step step;
+    if (record.syscall == RECORD_SEMCTL && record.cmd == SETVAL && record.arg == 0 && record.result != -1) {
+      initial[record.semid] = record.value;
+    }
+    if (toStep(record, &step)) {
+      threads[record.tid].push_back(step);
+      initial.emplace(record.semid, options.initial);
+      origin = std::min(origin, record.start);
+    }
+  }
+  if (threads.empty()) {
+    fprintf(stderr, "semreplay: %s: nothing to replay\n", options.path);
+    return 1;
+  }
+  if (initial.size() > 255) {
+    fprintf(stderr, "semreplay: %s: too many semaphores to replay\n", options.path);
+    return 1;
+  }
+  for (auto &entry : threads) {
+    std::sort(entry.second.begin(), entry.second.end(), [](const Step &a, const Step &b) { return a.start < b.start; });
+  }
+
+  // one key file, with a different project id for each recorded semaphore
+  char path[] = "/tmp/semreplay-XXXXXX";
+  int fd = mkstemp(path);
+  if (fd == -1) {
+    perror("semreplay: mkstemp");
+    return 1;
+  }
+  close(fd);
+
+  std::map<int32_t, SemaphoreV *> semaphores;
+  std::vector<Token> keys;
+  keys.reserve(initial.size());
+  int status = 0;
+  try {
+    for (auto &entry : initial) {
+      keys.emplace_back(path, (char)(keys.size() + 1));
+      semaphores[entry.first] = SemaphoreV::createExclusive(keys.back(), 0600, entry.second);
+    }
+  } catch (std::system_error &e) {
+    fprintf(stderr, "semreplay: %s\n", e.what());
+    status = 1;
+    threads.clear();
+  }
+
+  std::vector<uint64_t> latencies[OPERATIONS];
+  std::vector<uint64_t> recorded[OPERATIONS];
+  std::mutex results_mutex;
+  size_t steps = 0;
+  auto begin = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> workers;
+  for (auto &entry : threads) {
+    steps += entry.second.size();
+    workers.emplace_back([&, entry] {
+      std::vector<uint64_t> mine[OPERATIONS];
+      try {
+        for (const Step &step : entry.second) {
+          if (options.speed > 0) {
+            uint64_t offset = (step.start - origin) / options.speed;
+            std::this_thread::sleep_until(begin + std::chrono::nanoseconds(offset));
+          }
+          SemaphoreV *semaphore = semaphores.at(step.semid);
+          auto start = std::chrono::steady_clock::now();
+          switch (step.operation) {
+          case WAIT:
+            options.trywait ? (void)semaphore->trywait(step.value) : semaphore->wait(step.value);
+            break;
+          case TRYWAIT:
+            semaphore->trywait(step.value);
+            break;
+          case TIMEDWAIT:
+            options.trywait ? semaphore->trywait(step.value) : semaphore->timedwait(step.value, step.timeout);
+            break;
+          case POST:
+            semaphore->post(step.value);
+            break;
+          default:
+            semaphore->valueOf();
+          }
+          mine[step.operation].push_back(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        }
+      } catch (std::system_error &e) {
+        fprintf(stderr, "semreplay: %s\n", e.what());
+      }
+      std::lock_guard<std::mutex> lock(results_mutex);
+      for (int op = 0; op < OPERATIONS; op++) {
+        latencies[op].insert(latencies[op].end(), mine[op].begin(), mine[op].end());
+      }
+      for (const Step &step : entry.second) {
+        recorded[step.operation].push_back(step.duration);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  if (!status) {
+    printf("%zu operations from %zu threads on %zu semaphores in %.3fs, %.0f ops/s\n", steps, threads.size(),
+           semaphores.size(), seconds, steps / seconds);
+    printf("%-8s %10s %12s %12s %12s %12s %12s\n", "", "count", "p50 ns", "p99 ns", "max ns", "rec p50 ns",
+           "rec p99 ns");
+    for (int op = 0; op < OPERATIONS; op++) {
+      if (latencies[op].empty()) {
+        continue;
+      }
+      size_t count = latencies[op].size();
+      uint64_t max = percentile(latencies[op], 1.0);
+      printf("%-8s %10zu %12llu %12llu %12llu %12llu %12llu\n", operation_names[op], count,
+             (unsigned long long)percentile(latencies[op], 0.5), (unsigned long long)percentile(latencies[op], 0.99),
+             (unsigned long long)max, (unsigned long long)percentile(recorded[op], 0.5),
+             (unsigned long long)percentile(recorded[op], 0.99));
+    }
+  }
+
+  for (auto &entry : semaphores) {
+    delete entry.second;
+  }
+  unlink(path);
+  return status;
+}
@@ -0,0 +1,84 @@
+#include "recursive-mutex.h"
+
+#include <cerrno>
+#include <pthread.h>
+#include <system_error>
+
+static std::atomic<unsigned> forks(0);
+
+static void forked() { forks++; }
+
+static unsigned forkGeneration() {
+  static const int registered = pthread_atfork(nullptr, nullptr, forked);
+  (void)registered;
+  return forks.load(std::memory_order_relaxed);
+}
+
+RecursiveMutex *RecursiveMutex::createExclusive(Token &key, int mode) {
+  return new RecursiveMutex(SemaphoreV::createExclusive(key, mode, 1));
+}
+
+RecursiveMutex *RecursiveMutex::create(Token &key, int mode) {
+  return new RecursiveMutex(SemaphoreV::create(key, mode, 1));
+}
+
+RecursiveMutex *RecursiveMutex::open(Token &key) { return new RecursiveMutex(SemaphoreV::open(key)); }
+
+void RecursiveMutex::unlink(Token &key) { SemaphoreV::unlink(key); }
+
+// only the owner stores its own id, so a thread reading its own id back is the owner whatever the other threads do
+bool RecursiveMutex::owned() {
+  return owner.load(std::memory_order_relaxed) == std::this_thread::get_id() && generation == forkGeneration();
+}
+
+void RecursiveMutex::acquired() {
+  generation = forkGeneration();
+  depth = 1;
+  owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+}
+
+void RecursiveMutex::lock() {
+  if (owned()) {
+    depth++;
+    return;
+  }
+  semaphore->wait();
+  acquired();
+}
+
+bool RecursiveMutex::trylock() {
+  if (owned()) {
+    depth++;
+    return true;
+  }
+  if (!semaphore->trywait()) {
+    return false;
+  }
+  acquired();
+  return true;
+}
+
+void RecursiveMutex::unlock() {
+  if (!owned()) {
+    throw std::system_error(EPERM, std::system_category(), "semop");
+  }
+  if (--depth > 0) {
+    return;
+  }
+  owner.store(std::thread::id(), std::memory_order_relaxed);
+  try {
+    semaphore->post();
+  } catch (...) {
+    // still held in the kernel, so still held here
+    acquired();
+    throw;
+  }
+}
+
+unsigned RecursiveMutex::lockCount() { return owned() ? depth : 0; }
+
+unsigned RecursiveMutex::refs() { return semaphore->refs(); }
+
+void RecursiveMutex::close() { semaphore->close(); }
+
+RecursiveMutex::~RecursiveMutex() { delete semaphore; }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "semaphore-sysv.h"
+#include "token.h"
+
+#include <atomic>
+#include <thread>
+
+// A mutex shared between processes by its key that the thread holding it can lock again. The kernel side is a
+// SemaphoreV with one unit; the owning thread and the recursion depth are kept in this object, so only the outermost
+// lock() and unlock() make a semop and nested ones make no system call at all.
+//
+// Ownership is per object, so the threads of one process must share a single RecursiveMutex for a key: a second
+// object for the same key would wait on the kernel semaphore the first one holds. A child forked while the mutex is
+// held does not hold it, as SEM_UNDO adjustments are not inherited.
+
+class RecursiveMutex {
+  SemaphoreV *semaphore;
+  std::atomic<std::thread::id> owner;
+  // the fork generation the owner locked in, so a forked child does not mistake its thread for the owner
+  unsigned generation;
+  unsigned depth;
+
+  RecursiveMutex(SemaphoreV *s) : semaphore(s), owner(std::thread::id()), generation(0), depth(0){};
+  bool owned();
+  void acquired();
+
+public:
+  static RecursiveMutex *createExclusive(Token &key, int mode);
+  static RecursiveMutex *create(Token &key, int mode);
+  static RecursiveMutex *open(Token &key);
+  static void unlink(Token &key);
+
+  void lock();
+  bool trylock();
+  void unlock();
+  // the number of times the calling thread has locked it without unlocking, 0 if another thread or process holds it
+  unsigned lockCount();
+  unsigned refs();
+  void close();
+
+  ~RecursiveMutex();
+};
@@ -0,0 +1,114 @@
+#include "recursive-mutex.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+class RecursiveMutexKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'm');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+};
+
+TEST_F(RecursiveMutexKernelTest, TheOwnerLocksAgainAndOnlyTheOutermostUnlockReleases) {
+  RecursiveMutex *mutex = RecursiveMutex::createExclusive(*key, 0600);
+  SemaphoreV *kernel = SemaphoreV::open(*key);
+
+  mutex->lock();
+  mutex->lock();
+  EXPECT_TRUE(mutex->trylock());
+  EXPECT_EQ(mutex->lockCount(), 3u);
+  EXPECT_EQ(kernel->valueOf(), 0u);
+  mutex->unlock();
+  mutex->unlock();
+  EXPECT_EQ(kernel->valueOf(), 0u);
+  mutex->unlock();
+  EXPECT_EQ(mutex->lockCount(), 0u);
+  EXPECT_EQ(kernel->valueOf(), 1u);
+
+  delete kernel;
+  delete mutex;
+}
+
+TEST_F(RecursiveMutexKernelTest, AnotherThreadWaitsForTheOutermostUnlock) {
+  RecursiveMutex *mutex = RecursiveMutex::createExclusive(*key, 0600);
+  std::atomic<bool> locked(false);
+
+  mutex->lock();
+  mutex->lock();
+  std::thread other([&] {
+    EXPECT_FALSE(mutex->trylock());
+    EXPECT_EQ(mutex->lockCount(), 0u);
+    mutex->lock();
+    locked = true;
+    mutex->unlock();
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  mutex->unlock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(locked);
+  mutex->unlock();
+  other.join();
+  EXPECT_TRUE(locked);
+
+  delete mutex;
+}
+
+TEST_F(RecursiveMutexKernelTest, UnlockingWithoutHoldingItFails) {
+  RecursiveMutex *mutex = RecursiveMutex::createExclusive(*key, 0600);
+
+  try {
+    mutex->unlock();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EPERM);
+  }
+
+  mutex->lock();
+  std::thread other([&] { EXPECT_THROW(mutex->unlock(), std::system_error); });
+  other.join();
+  mutex->unlock();
+
+  delete mutex;
+}
+
+TEST_F(RecursiveMutexKernelTest, AForkedChildDoesNotInheritOwnership) {
+  RecursiveMutex *mutex = RecursiveMutex::createExclusive(*key, 0600);
+
+  mutex->lock();
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    _exit(mutex->lockCount() == 0 && !mutex->trylock() ? 0 : 1);
+  }
+  int status;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_EQ(mutex->lockCount(), 1u);
+  mutex->unlock();
+
+  delete mutex;
+}
@@ -0,0 +1,109 @@
+#include "rwlock.h"
+
+#include <cerrno>
+#include <system_error>
+
+#define READERS 0
+#define WRITER 1
+#define WRITERS_WAITING 2
+#define SLOTS 3
+
+RwLock *RwLock::createExclusive(Token &key, int mode) {
+  int values[SLOTS] = {0, 0, 0};
+  return new RwLock(SemaphoreSet::createExclusive(key, mode, SLOTS, values));
+}
+
+RwLock *RwLock::create(Token &key, int mode) {
+  int values[SLOTS] = {0, 0, 0};
+  return new RwLock(SemaphoreSet::create(key, mode, SLOTS, values));
+}
+
+RwLock *RwLock::open(Token &key) { return new RwLock(SemaphoreSet::open(key, SLOTS)); }
+
+void RwLock::unlink(Token &key) { SemaphoreSet::unlink(key); }
+
+// no writer holding it or waiting for it
+#define READ_LOCK {{WRITERS_WAITING, 0, 0}, {WRITER, 0, 0}, {READERS, 1, SEM_UNDO}}
+
+void RwLock::readLock() {
+  struct sembuf ops[3] = READ_LOCK;
+  set->op(ops, 3);
+}
+
+bool RwLock::tryReadLock() {
+  struct sembuf ops[3] = READ_LOCK;
+  return set->tryop(ops, 3);
+}
+
+bool RwLock::timedReadLock(unsigned milliseconds) {
+  struct sembuf ops[3] = READ_LOCK;
+  return set->timedop(ops, 3, milliseconds);
+}
+
+// unlocking a lock that is not held would block, so it fails instead
+void RwLock::readUnlock() {
+  struct sembuf op = {READERS, -1, SEM_UNDO};
+  if (!set->tryop(&op, 1)) {
+    throw std::system_error(EPERM, std::system_category(), "semop");
+  }
+}
+
+// no readers and no writer, taking the writer slot and giving up the place in the waiting count together
+#define WRITE_LOCK {{READERS, 0, 0}, {WRITER, 0, 0}, {WRITER, 1, SEM_UNDO}, {WRITERS_WAITING, -1, SEM_UNDO}}
+
+void RwLock::writeLock() {
+  struct sembuf waiting = {WRITERS_WAITING, 1, SEM_UNDO};
+  set->op(&waiting, 1);
+  struct sembuf ops[4] = WRITE_LOCK;
+  try {
+    set->op(ops, 4);
+  } catch (...) {
+    waiting.sem_op = -1;
+    set->tryop(&waiting, 1);
+    throw;
+  }
+}
+
+bool RwLock::tryWriteLock() {
+  // a writer that does not wait does not hold readers back
+  struct sembuf ops[3] = {{READERS, 0, 0}, {WRITER, 0, 0}, {WRITER, 1, SEM_UNDO}};
+  return set->tryop(ops, 3);
+}
+
+bool RwLock::timedWriteLock(unsigned milliseconds) {
+  struct sembuf waiting = {WRITERS_WAITING, 1, SEM_UNDO};
+  set->op(&waiting, 1);
+  struct sembuf ops[4] = WRITE_LOCK;
+  bool locked = false;
+  try {
+    locked = set->timedop(ops, 4, milliseconds);
+  } catch (...) {
+    waiting.sem_op = -1;
+    set->tryop(&waiting, 1);
+    throw;
+  }
+  if (!locked) {
+    waiting.sem_op = -1;
+    set->op(&waiting, 1);
+  }
+  return locked;
+}
+
+void RwLock::writeUnlock() {
+  struct sembuf op = {WRITER, -1, SEM_UNDO};
+  if (!set->tryop(&op, 1)) {
+    throw std::system_error(EPERM, std::system_category(), "semop");
+  }
+}
+
+unsigned RwLock::readers() { return set->get(READERS); }
+
+unsigned RwLock::writersWaiting() { return set->get(WRITERS_WAITING); }
+
+bool RwLock::isWriteLocked() { return set->get(WRITER) != 0; }
+
+unsigned RwLock::refs() { return set->refs(); }
+
+void RwLock::close() { set->close(); }
+
+RwLock::~RwLock() { delete set; }
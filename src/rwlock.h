@@ -0,0 +1,41 @@
+#pragma once
+
+#include "semaphore-set.h"
+#include "token.h"
+
+// A read-write lock shared between processes by its key. Any number of readers can hold it together, or one writer
+// alone. Each lock and unlock is a single atomic semop over the reader count, the writer slot and the count of writers
+// waiting, so a reader never holds the set while it waits for another slot.
+//
+// Writers are preferred: once a writer is waiting, new readers wait behind it, so a steady stream of readers cannot
+// starve a writer. Every operation is SEM_UNDO, so a lock held by a process that exits is released.
+
+class RwLock {
+  SemaphoreSet *set;
+
+  RwLock(SemaphoreSet *s) : set(s){};
+
+public:
+  static RwLock *createExclusive(Token &key, int mode);
+  static RwLock *create(Token &key, int mode);
+  static RwLock *open(Token &key);
+  static void unlink(Token &key);
+
+  void readLock();
+  bool tryReadLock();
+  bool timedReadLock(unsigned milliseconds);
+  void readUnlock();
+
+  void writeLock();
+  bool tryWriteLock();
+  bool timedWriteLock(unsigned milliseconds);
+  void writeUnlock();
+
+  unsigned readers();
+  unsigned writersWaiting();
+  bool isWriteLocked();
+  unsigned refs();
+  void close();
+
+  ~RwLock();
+};
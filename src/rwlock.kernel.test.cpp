@@ -0,0 +1,132 @@
+#include "rwlock.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+class RwLockKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'r');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  bool waitFor(std::function<bool()> condition) {
+    for (int i = 0; i < 5000; i++) {
+      if (condition()) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+  }
+};
+
+TEST_F(RwLockKernelTest, ReadersShareItAndExcludeWriters) {
+  RwLock *lock = RwLock::createExclusive(*key, 0600);
+
+  lock->readLock();
+  EXPECT_TRUE(lock->tryReadLock());
+  EXPECT_EQ(lock->readers(), 2u);
+  EXPECT_FALSE(lock->tryWriteLock());
+  lock->readUnlock();
+  lock->readUnlock();
+
+  EXPECT_TRUE(lock->tryWriteLock());
+  EXPECT_TRUE(lock->isWriteLocked());
+  EXPECT_FALSE(lock->tryReadLock());
+  EXPECT_FALSE(lock->tryWriteLock());
+  lock->writeUnlock();
+  EXPECT_FALSE(lock->isWriteLocked());
+
+  delete lock;
+}
+
+TEST_F(RwLockKernelTest, AWaitingWriterHoldsBackNewReaders) {
+  RwLock *lock = RwLock::createExclusive(*key, 0600);
+  std::atomic<bool> written(false);
+
+  lock->readLock();
+  std::thread writer([&] {
+    lock->writeLock();
+    written = true;
+    lock->writeUnlock();
+  });
+  ASSERT_TRUE(waitFor([&] { return lock->writersWaiting() == 1; }));
+  EXPECT_FALSE(lock->tryReadLock());
+  EXPECT_FALSE(lock->timedReadLock(10));
+  EXPECT_FALSE(written);
+
+  lock->readUnlock();
+  writer.join();
+  EXPECT_TRUE(written);
+  EXPECT_EQ(lock->writersWaiting(), 0u);
+  EXPECT_TRUE(lock->tryReadLock());
+  lock->readUnlock();
+
+  delete lock;
+}
+
+TEST_F(RwLockKernelTest, ATimedOutWriterStopsHoldingBackReaders) {
+  RwLock *lock = RwLock::createExclusive(*key, 0600);
+
+  lock->readLock();
+  EXPECT_FALSE(lock->timedWriteLock(20));
+  EXPECT_EQ(lock->writersWaiting(), 0u);
+  EXPECT_TRUE(lock->tryReadLock());
+  lock->readUnlock();
+  lock->readUnlock();
+
+  delete lock;
+}
+
+TEST_F(RwLockKernelTest, ALockHeldByAProcessThatExitsIsReleased) {
+  RwLock *lock = RwLock::createExclusive(*key, 0600);
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    RwLock *mine = RwLock::open(*key);
+    mine->writeLock();
+    _exit(0);
+  }
+  waitpid(pid, nullptr, 0);
+  EXPECT_FALSE(lock->isWriteLocked());
+  EXPECT_TRUE(lock->timedWriteLock(1000));
+  lock->writeUnlock();
+
+  delete lock;
+}
+
+TEST_F(RwLockKernelTest, UnlockingALockThatIsNotHeldFails) {
+  RwLock *lock = RwLock::createExclusive(*key, 0600);
+
+  try {
+    lock->writeUnlock();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EPERM);
+  }
+
+  delete lock;
+}
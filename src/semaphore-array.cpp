@@ -0,0 +1,115 @@
+#include "semaphore-array.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+#include <vector>
+
+SemaphoreArray *SemaphoreArray::createExclusive(Token &key, int mode, unsigned size, int value) {
+  std::vector<int> values(size, value);
+  return new SemaphoreArray(SemaphoreSet::createExclusive(key, mode, size, values.data()));
+}
+
+SemaphoreArray *SemaphoreArray::create(Token &key, int mode, unsigned size, int value) {
+  std::vector<int> values(size, value);
+  return new SemaphoreArray(SemaphoreSet::create(key, mode, size, values.data()));
+}
+
+SemaphoreArray *SemaphoreArray::open(Token &key, unsigned size) {
+  return new SemaphoreArray(SemaphoreSet::open(key, size));
+}
+
+void SemaphoreArray::unlink(Token &key) { SemaphoreSet::unlink(key); }
+
+// the slot after the counters is the reference count, which the kernel would let an operation reach
+void SemaphoreArray::check(unsigned counter) {
+  if (counter >= (unsigned)set->size()) {
+    throw std::system_error(EINVAL, std::system_category(), "semop");
+  }
+}
+
+void SemaphoreArray::wait(unsigned counter, unsigned value) {
+  check(counter);
+  struct sembuf op = {(unsigned short)counter, (short)-value, SEM_UNDO};
+  set->op(&op, 1);
+}
+
+bool SemaphoreArray::trywait(unsigned counter, unsigned value) {
+  check(counter);
+  struct sembuf op = {(unsigned short)counter, (short)-value, SEM_UNDO};
+  return set->tryop(&op, 1);
+}
+
+bool SemaphoreArray::timedwait(unsigned counter, unsigned value, unsigned milliseconds) {
+  check(counter);
+  struct sembuf op = {(unsigned short)counter, (short)-value, SEM_UNDO};
+  return set->timedop(&op, 1, milliseconds);
+}
+
+void SemaphoreArray::post(unsigned counter, unsigned value) {
+  check(counter);
+  struct sembuf op = {(unsigned short)counter, (short)value, SEM_UNDO};
+  set->op(&op, 1);
+}
+
+#define TRANSFER(from, to, value)                                                                                      \
+  {{(unsigned short)(from), (short)-(value), SEM_UNDO}, {(unsigned short)(to), (short)(value), SEM_UNDO}}
+
+void SemaphoreArray::transfer(unsigned from, unsigned to, unsigned value) {
+  check(from);
+  check(to);
+  struct sembuf ops[2] = TRANSFER(from, to, value);
+  set->op(ops, 2);
+}
+
+bool SemaphoreArray::tryTransfer(unsigned from, unsigned to, unsigned value) {
+  check(from);
+  check(to);
+  struct sembuf ops[2] = TRANSFER(from, to, value);
+  return set->tryop(ops, 2);
+}
+
+bool SemaphoreArray::timedTransfer(unsigned from, unsigned to, unsigned value, unsigned milliseconds) {
+  check(from);
+  check(to);
+  struct sembuf ops[2] = TRANSFER(from, to, value);
+  return set->timedop(ops, 2, milliseconds);
+}
+
+// one GETALL finds the candidates, then each is tried with IPC_NOWAIT from the most available down, so a counter
+// emptied by another process since the snapshot only costs one more semop
+int SemaphoreArray::acquireAny(unsigned value) {
+  const unsigned count = set->size();
+  std::vector<unsigned short> values(count + 1);
+  set->getAll(values.data());
+  std::vector<unsigned> candidates;
+  for (unsigned i = 0; i < count; i++) {
+    const unsigned counter = (next + i) % count;
+    if (values[counter] >= value) {
+      candidates.push_back(counter);
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [&](unsigned a, unsigned b) { return values[a] > values[b]; });
+  for (unsigned counter : candidates) {
+    struct sembuf op = {(unsigned short)counter, (short)-value, SEM_UNDO};
+    if (set->tryop(&op, 1)) {
+      next = (counter + 1) % count;
+      return counter;
+    }
+  }
+  return -1;
+}
+
+unsigned SemaphoreArray::valueOf(unsigned counter) {
+  check(counter);
+  return set->get(counter);
+}
+
+unsigned SemaphoreArray::size() { return set->size(); }
+
+unsigned SemaphoreArray::refs() { return set->refs(); }
+
+void SemaphoreArray::close() { set->close(); }
+
+SemaphoreArray::~SemaphoreArray() { delete set; }
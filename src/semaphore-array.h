@@ -0,0 +1,47 @@
+#pragma once
+
+#include "semaphore-set.h"
+#include "token.h"
+
+// A fixed number of counting semaphores in one System V set, shared between processes by its key. Each counter works
+// like a SemaphoreV, and transfer() moves units from one counter to another in a single atomic semop, so there is no
+// moment at which the units are held by neither.
+//
+// Counters are numbered from 0 to size() - 1, and a counter out of that range fails with EINVAL. Every operation is
+// SEM_UNDO, so the counters go back to where they were when a process that changed them exits.
+
+class SemaphoreArray {
+  SemaphoreSet *set;
+  // where acquireAny() starts looking, so counters with equal values take turns
+  unsigned next;
+
+  SemaphoreArray(SemaphoreSet *s) : set(s), next(0){};
+  void check(unsigned counter);
+
+public:
+  // every counter starts at value
+  static SemaphoreArray *createExclusive(Token &key, int mode, unsigned size, int value);
+  static SemaphoreArray *create(Token &key, int mode, unsigned size, int value);
+  static SemaphoreArray *open(Token &key, unsigned size);
+  static void unlink(Token &key);
+
+  void wait(unsigned counter, unsigned value);
+  bool trywait(unsigned counter, unsigned value);
+  bool timedwait(unsigned counter, unsigned value, unsigned milliseconds);
+  void post(unsigned counter, unsigned value);
+
+  // takes value units from one counter and adds them to the other, blocking until from has them
+  void transfer(unsigned from, unsigned to, unsigned value);
+  bool tryTransfer(unsigned from, unsigned to, unsigned value);
+  bool timedTransfer(unsigned from, unsigned to, unsigned value, unsigned milliseconds);
+
+  // takes value units from the counter with the most available, returning the counter or -1 if none had them
+  int acquireAny(unsigned value);
+
+  unsigned valueOf(unsigned counter);
+  unsigned size();
+  unsigned refs();
+  void close();
+
+  ~SemaphoreArray();
+};
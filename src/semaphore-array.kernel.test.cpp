@@ -0,0 +1,157 @@
+#include "semaphore-array.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+class SemaphoreArrayKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'a');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+};
+
+TEST_F(SemaphoreArrayKernelTest, CountersAreIndependent) {
+  SemaphoreArray *array = SemaphoreArray::createExclusive(*key, 0600, 3, 2);
+
+  EXPECT_EQ(array->size(), 3u);
+  array->wait(0, 2);
+  EXPECT_FALSE(array->trywait(0, 1));
+  EXPECT_FALSE(array->timedwait(0, 1, 10));
+  EXPECT_TRUE(array->trywait(1, 1));
+  array->post(2, 3);
+  EXPECT_EQ(array->valueOf(0), 0u);
+  EXPECT_EQ(array->valueOf(1), 1u);
+  EXPECT_EQ(array->valueOf(2), 5u);
+
+  delete array;
+}
+
+TEST_F(SemaphoreArrayKernelTest, TransferMovesUnitsAtomically) {
+  SemaphoreArray *array = SemaphoreArray::createExclusive(*key, 0600, 2, 0);
+
+  array->post(0, 3);
+  array->transfer(0, 1, 2);
+  EXPECT_EQ(array->valueOf(0), 1u);
+  EXPECT_EQ(array->valueOf(1), 2u);
+  EXPECT_FALSE(array->tryTransfer(0, 1, 2));
+  EXPECT_FALSE(array->timedTransfer(0, 1, 2, 10));
+  // a failed transfer changes neither counter
+  EXPECT_EQ(array->valueOf(0), 1u);
+  EXPECT_EQ(array->valueOf(1), 2u);
+  EXPECT_TRUE(array->tryTransfer(1, 0, 2));
+  EXPECT_EQ(array->valueOf(0), 3u);
+  EXPECT_EQ(array->valueOf(1), 0u);
+
+  delete array;
+}
+
+TEST_F(SemaphoreArrayKernelTest, TransferWaitsForTheSourceCounter) {
+  SemaphoreArray *array = SemaphoreArray::createExclusive(*key, 0600, 2, 0);
+  std::atomic<bool> moved(false);
+
+  std::thread stage([&] {
+    array->transfer(0, 1, 1);
+    moved = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(moved);
+  array->post(0, 1);
+  stage.join();
+  EXPECT_TRUE(moved);
+  EXPECT_EQ(array->valueOf(0), 0u);
+  EXPECT_EQ(array->valueOf(1), 1u);
+
+  delete array;
+}
+
+TEST_F(SemaphoreArrayKernelTest, CountersOutOfRangeAreRefused) {
+  SemaphoreArray *array = SemaphoreArray::createExclusive(*key, 0600, 2, 1);
+
+  try {
+    array->transfer(0, 2, 1);
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EINVAL);
+  }
+  EXPECT_THROW(array->post(2, 1), std::system_error);
+  EXPECT_EQ(array->refs(), 1u);
+  EXPECT_EQ(array->valueOf(0), 1u);
+
+  delete array;
+}
+
+TEST_F(SemaphoreArrayKernelTest, OpeningWithAnotherSizeIsRefused) {
+  SemaphoreArray *array = SemaphoreArray::createExclusive(*key, 0600, 3, 1);
+
+  for (unsigned size : {2u, 4u}) {
+    try {
+      SemaphoreArray::open(*key, size);
+      FAIL() << "Expected std::system_error";
+    } catch (const std::system_error &e) {
+      EXPECT_EQ(e.code().value(), EINVAL);
+    }
+  }
+  EXPECT_EQ(array->refs(), 1u);
+  EXPECT_EQ(array->valueOf(2), 1u);
+
+  delete array;
+}
+
+TEST_F(SemaphoreArrayKernelTest, ATransferIsUndoneWhenTheProcessExits) {
+  SemaphoreArray *array = SemaphoreArray::createExclusive(*key, 0600, 2, 1);
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    SemaphoreArray *child = SemaphoreArray::open(*key, 2);
+    child->transfer(0, 1, 1);
+    _exit(child->valueOf(1) == 2 ? 0 : 1);
+  }
+  int status;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_EQ(array->valueOf(0), 1u);
+  EXPECT_EQ(array->valueOf(1), 1u);
+  EXPECT_EQ(array->refs(), 1u);
+
+  delete array;
+}
+
+TEST_F(SemaphoreArrayKernelTest, AcquireAnyTakesFromTheMostAvailableCounter) {
+  SemaphoreArray *array = SemaphoreArray::createExclusive(*key, 0600, 3, 0);
+
+  EXPECT_EQ(array->acquireAny(1), -1);
+  array->post(0, 1);
+  array->post(2, 3);
+  EXPECT_EQ(array->acquireAny(2), 2);
+  EXPECT_EQ(array->valueOf(2), 1u);
+  EXPECT_EQ(array->acquireAny(2), -1);
+  // equal counters take turns
+  EXPECT_EQ(array->acquireAny(1), 0);
+  array->post(0, 1);
+  EXPECT_EQ(array->acquireAny(1), 2);
+
+  delete array;
+}
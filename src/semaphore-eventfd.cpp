@@ -0,0 +1,194 @@
+#include "semaphore-eventfd.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+#define MAX_BACKOFF std::chrono::milliseconds(8) // the longest sleep of wait(value) while too few units are there
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+
+SemaphoreE *SemaphoreE::create(unsigned value) {
+  // not EFD_CLOEXEC, so the semaphore is inherited by exec()ed children as well as forked ones
+  int fd = eventfd(value, EFD_SEMAPHORE | EFD_NONBLOCK);
+  if (fd == -1) {
+    throw std::system_error(errno, std::system_category(), "eventfd");
+  }
+  return new SemaphoreE(fd);
+}
+#else
+SemaphoreE *SemaphoreE::create(unsigned value) {
+  throw std::system_error(ENOSYS, std::system_category(), "eventfd");
+}
+#endif
+
+SemaphoreE *SemaphoreE::fromFd(int fd) {
+  int copy = dup(fd);
+  if (copy == -1) {
+    throw std::system_error(errno, std::system_category(), "dup");
+  }
+  // the file status flags are shared with the original, which is expected to be non-blocking already
+  if (fcntl(copy, F_SETFL, fcntl(copy, F_GETFL) | O_NONBLOCK) == -1) {
+    const int error = errno;
+    ::close(copy);
+    throw std::system_error(error, std::system_category(), "fcntl");
+  }
+  return new SemaphoreE(copy);
+}
+
+SemaphoreE *SemaphoreE::receive(int socket) {
+  char data;
+  struct iovec iov = {&data, 1};
+  union {
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+  struct msghdr message = {};
+  message.msg_iov = &iov;
+  message.msg_iovlen = 1;
+  message.msg_control = control.buffer;
+  message.msg_controllen = sizeof(control.buffer);
+
+  ssize_t received;
+  while ((received = recvmsg(socket, &message, 0)) == -1) {
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "recvmsg");
+    }
+  }
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+  if (received == 0 || !cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+    throw std::system_error(EBADMSG, std::system_category(), "recvmsg");
+  }
+  int fd;
+  memcpy(&fd, CMSG_DATA(cmsg), sizeof(fd));
+  return new SemaphoreE(fd);
+}
+
+void SemaphoreE::send(int socket) {
+  char data = 0;
+  struct iovec iov = {&data, 1};
+  union {
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+  struct msghdr message = {};
+  message.msg_iov = &iov;
+  message.msg_iovlen = 1;
+  message.msg_control = control.buffer;
+  message.msg_controllen = sizeof(control.buffer);
+
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(cmsg), &efd, sizeof(efd));
+
+  while (sendmsg(socket, &message, 0) == -1) {
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "sendmsg");
+    }
+  }
+}
+
+void SemaphoreE::wait() { wait(1); }
+
+// every unit is taken by one trywait(value), which puts back a partial take, so no waiter blocks holding units another
+// waiter needs. The fd is readable with a single unit, so while there are some but too few the wait backs off and looks
+// again rather than spinning on poll
+void SemaphoreE::wait(unsigned value) {
+  std::chrono::microseconds backoff(100);
+  while (!trywait(value)) {
+    struct pollfd readable = {efd, POLLIN, 0};
+    const int ready = poll(&readable, 1, -1);
+    if (ready == -1 && errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "poll");
+    }
+    if (ready == 1 && value > 1) {
+      std::this_thread::sleep_for(backoff);
+      backoff = std::min<std::chrono::microseconds>(backoff * 2, MAX_BACKOFF);
+    }
+  }
+}
+
+bool SemaphoreE::trywait() { return trywait(1); }
+
+bool SemaphoreE::trywait(unsigned value) {
+  unsigned taken = 0;
+  while (taken < value) {
+    uint64_t unit;
+    if (read(efd, &unit, sizeof(unit)) == sizeof(unit)) {
+      taken++;
+    } else if (errno == EAGAIN) {
+      if (taken) {
+        post(taken);
+      }
+      return false;
+    } else if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "read");
+    }
+  }
+  return true;
+}
+
+void SemaphoreE::post() { post(1); }
+
+void SemaphoreE::post(unsigned value) {
+  uint64_t units = value;
+  while (write(efd, &units, sizeof(units)) == -1) {
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "write");
+    }
+  }
+}
+
+// the count can only be read without taking it from the fd's entry in /proc
+unsigned SemaphoreE::valueOf() {
+  char path[64];
+  snprintf(path, sizeof(path), "/proc/self/fdinfo/%d", efd);
+  FILE *info = fopen(path, "r");
+  if (!info) {
+    throw std::system_error(errno, std::system_category(), "fopen");
+  }
+  char line[128];
+  unsigned long long count = 0;
+  bool found = false;
+  while (!found && fgets(line, sizeof(line), info)) {
+    found = sscanf(line, "eventfd-count: %llx", &count) == 1;
+  }
+  fclose(info);
+  if (!found) {
+    throw std::system_error(ENOTSUP, std::system_category(), "fdinfo");
+  }
+  return count;
+}
+
+int SemaphoreE::fd() { return efd; }
+
+void SemaphoreE::close() {
+  if (::close(efd) == -1) {
+    throw std::system_error(errno, std::system_category(), "close");
+  }
+  efd = -1;
+}
+
+SemaphoreE::~SemaphoreE() {
+  if (efd == -1) {
+    return;
+  }
+  try {
+    close();
+  } catch (...) {
+    // Destructor should never throw - silently ignore cleanup errors
+  }
+}
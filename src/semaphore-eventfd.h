@@ -0,0 +1,36 @@
+#pragma once
+
+// A semaphore on an eventfd(EFD_SEMAPHORE), for use between a process and its threads and children. Unlike SemaphoreV
+// it has no kernel set, key or SEM_UNDO: the fd is inherited across fork() and can be passed over a Unix socket, and
+// the count lives as long as any process holds the fd open. The fd is non-blocking and readable whenever the count is
+// non zero, so callers can poll it with their event loop and call trywait() when it is readable.
+//
+// Operations on more than one unit read one unit at a time, and trywait(n) puts back what it took when it cannot take
+// them all, so wait(n) never blocks holding units. Other processes can briefly see the partial take, and while fewer
+// than n units are there wait(n) polls with a backoff of up to 8ms, as the fd cannot signal that n have arrived.
+//
+// The bindings add waitAsync(), which watches the fd from the event loop instead of blocking (see wait-async.h).
+
+class SemaphoreE {
+  int efd;
+
+  SemaphoreE(int f) : efd(f){};
+
+public:
+  static SemaphoreE *create(unsigned value);
+  static SemaphoreE *fromFd(int fd);
+  static SemaphoreE *receive(int socket);
+
+  void wait();
+  void wait(unsigned value);
+  bool trywait();
+  bool trywait(unsigned value);
+  void post();
+  void post(unsigned value);
+  unsigned valueOf();
+  int fd();
+  void send(int socket);
+  void close();
+
+  ~SemaphoreE();
+};
@@ -0,0 +1,150 @@
+#include "semaphore-eventfd.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+#ifdef __linux__
+
+TEST(SemaphoreEKernelTest, CountsUnits) {
+  SemaphoreE *sem = SemaphoreE::create(2);
+  EXPECT_EQ(sem->valueOf(), 2u);
+
+  EXPECT_TRUE(sem->trywait());
+  EXPECT_EQ(sem->valueOf(), 1u);
+  EXPECT_FALSE(sem->trywait(2));
+  EXPECT_EQ(sem->valueOf(), 1u); // the unit taken before failing is put back
+
+  sem->post(4);
+  EXPECT_TRUE(sem->trywait(5));
+  EXPECT_FALSE(sem->trywait());
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST(SemaphoreEKernelTest, FdIsReadableWhenTheCountIsNotZero) {
+  SemaphoreE *sem = SemaphoreE::create(0);
+  struct pollfd readable = {sem->fd(), POLLIN, 0};
+
+  EXPECT_EQ(poll(&readable, 1, 0), 0);
+  sem->post();
+  EXPECT_EQ(poll(&readable, 1, 0), 1);
+  EXPECT_TRUE(sem->trywait());
+  EXPECT_EQ(poll(&readable, 1, 0), 0);
+
+  delete sem;
+}
+
+TEST(SemaphoreEKernelTest, WaitBlocksUntilPost) {
+  SemaphoreE *sem = SemaphoreE::create(0);
+  std::atomic<bool> acquired(false);
+
+  std::thread waiter([&] {
+    sem->wait(2);
+    acquired = true;
+  });
+  sem->post();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(acquired);
+  sem->post();
+  waiter.join();
+  EXPECT_TRUE(acquired);
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST(SemaphoreEKernelTest, WaitersForSeveralUnitsDoNotDeadlock) {
+  SemaphoreE *sem = SemaphoreE::create(2);
+  std::atomic<int> done(0);
+
+  auto worker = [&] {
+    for (int i = 0; i < 500; i++) {
+      sem->wait(2);
+      sem->post(2);
+    }
+    done++;
+  };
+  std::thread first(worker);
+  std::thread second(worker);
+  for (int waited = 0; done < 2 && waited < 10000; waited++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(done, 2);
+  if (done < 2) {
+    sem->post(4); // lets a deadlocked pair finish, so the threads can be joined
+  }
+  first.join();
+  second.join();
+  EXPECT_EQ(sem->valueOf(), done == 2 ? 2u : 6u);
+
+  delete sem;
+}
+
+TEST(SemaphoreEKernelTest, IsSharedWithForkedChildren) {
+  SemaphoreE *sem = SemaphoreE::create(0);
+
+  pid_t child = fork();
+  if (child == 0) {
+    sem->post(3);
+    _exit(0);
+  }
+  int status;
+  waitpid(child, &status, 0);
+  EXPECT_EQ(sem->valueOf(), 3u);
+
+  delete sem;
+}
+
+TEST(SemaphoreEKernelTest, CanBePassedOverAUnixSocket) {
+  int sockets[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+  SemaphoreE *sem = SemaphoreE::create(1);
+
+  sem->send(sockets[0]);
+  SemaphoreE *received = SemaphoreE::receive(sockets[1]);
+  EXPECT_NE(received->fd(), sem->fd());
+  EXPECT_TRUE(received->trywait());
+  EXPECT_FALSE(sem->trywait());
+
+  delete received;
+  delete sem;
+  close(sockets[0]);
+  close(sockets[1]);
+}
+
+TEST(SemaphoreEKernelTest, FromFdSharesTheCount) {
+  SemaphoreE *sem = SemaphoreE::create(0);
+  SemaphoreE *copy = SemaphoreE::fromFd(sem->fd());
+
+  sem->post();
+  EXPECT_TRUE(copy->trywait());
+  copy->close();
+  EXPECT_EQ(sem->valueOf(), 0u); // closing a copy leaves the original open
+
+  delete copy;
+  delete sem;
+}
+
+TEST(SemaphoreEKernelTest, OperationsFailAfterClose) {
+  SemaphoreE *sem = SemaphoreE::create(1);
+  sem->close();
+
+  try {
+    sem->trywait();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EBADF);
+  }
+
+  delete sem;
+}
+
+#endif
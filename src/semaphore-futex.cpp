@@ -0,0 +1,532 @@
+#include "semaphore-futex.h"
+
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <system_error>
+#include <thread>
+
+#define OPEN_ATTEMPTS 1000 // how long open waits for a concurrent createExclusive to set the initial value
+
+struct FutexShared {
+  std::atomic<uint32_t> count;
+  std::atomic<uint32_t> waiters;     // threads and io_uring waits that may be asleep on count
+  std::atomic<uint32_t> bulkWaiters; // the waiters for more than one unit, which a single wake may not satisfy
+  std::atomic<uint32_t> ready;       // set by the creator once count holds the initial value
+};
+
+static bool take(FutexShared *shared, unsigned value) {
+  uint32_t count = shared->count.load();
+  while (count >= value) {
+    if (shared->count.compare_exchange_weak(count, count - value)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+#ifdef __linux__
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <linux/futex.h>
+#include <linux/io_uring.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <utility>
+
+#ifndef IORING_OP_FUTEX_WAIT
+#define IORING_OP_FUTEX_WAIT 51 // Linux 6.7, newer than the installed headers
+#endif
+#ifndef FUTEX2_SIZE_U32
+#define FUTEX2_SIZE_U32 0x02
+#endif
+
+#define RING_ENTRIES 256
+
+static long futex(std::atomic<uint32_t> *word, int op, uint32_t value) {
+  return syscall(SYS_futex, word, op, value, nullptr, nullptr, 0);
+}
+
+static void wake(FutexShared *shared, unsigned value) {
+  if (shared->waiters.load() == 0) {
+    return;
+  }
+  // a waiter for several units can take a wake without taking a unit, so then wake everyone rather than lose one
+  futex(&shared->count, FUTEX_WAKE, shared->bulkWaiters.load() ? INT_MAX : value);
+}
+
+// The io_uring shared by every SemaphoreF in the process. Waits are futex wait submissions tagged with their ticket;
+// when one completes the unit is taken, or the wait is submitted again if another waiter took it first.
+class Ring {
+  struct Wait {
+    FutexShared *shared;
+    bool cancelled;
+  };
+
+  int fd = -1;
+  int efd = -1;
+  pid_t pid;
+  unsigned *sqHead, *sqTail, *sqMask, *sqArray;
+  unsigned *cqHead, *cqTail, *cqMask;
+  struct io_uring_sqe *sqes;
+  struct io_uring_cqe *cqes;
+  unsigned entries;
+  unsigned unsubmitted = 0;
+  unsigned nextTicket = 1;
+  std::map<unsigned, Wait> waits;
+  std::deque<unsigned> acquired;
+  std::deque<std::pair<unsigned, int>> failed;
+  std::mutex mutex;
+
+  bool setup();
+  struct io_uring_sqe *next();
+  void submitWait(unsigned ticket, FutexShared *shared);
+  void enter();
+
+public:
+  static Ring *get();
+  int completionFd() { return efd; }
+  unsigned wait(FutexShared *shared);
+  void cancel(FutexShared *shared);
+  unsigned completed();
+};
+
+static std::mutex ring_mutex;
+static Ring *ring = nullptr;
+static bool ring_unavailable = false;
+
+// nullptr when io_uring futex waits are not supported; a forked child gets a ring of its own
+Ring *Ring::get() {
+  std::lock_guard<std::mutex> lock(ring_mutex);
+  if (ring && ring->pid == getpid()) {
+    return ring;
+  }
+  if (ring_unavailable) {
+    return nullptr;
+  }
+  Ring *created = new Ring();
+  if (!created->setup()) {
+    delete created;
+    ring_unavailable = true;
+    return nullptr;
+  }
+  return ring = created; // a ring inherited from the parent is left mapped, as the parent's waits still refer to it
+}
+
+bool Ring::setup() {
+  struct io_uring_params params = {};
+  fd = syscall(__NR_io_uring_setup, RING_ENTRIES, &params);
+  if (fd == -1) {
+    return false;
+  }
+  pid = getpid();
+  entries = params.sq_entries;
+
+  size_t sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single) {
+    sqSize = cqSize = std::max(sqSize, cqSize);
+  }
+  char *sq = (char *)mmap(nullptr, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  char *cq = single ? sq
+                    : (char *)mmap(nullptr, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                                   IORING_OFF_CQ_RING);
+  sqes = (struct io_uring_sqe *)mmap(nullptr, params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (sq == MAP_FAILED || cq == MAP_FAILED || sqes == MAP_FAILED) {
+    ::close(fd);
+    return false;
+  }
+  sqHead = (unsigned *)(sq + params.sq_off.head);
+  sqTail = (unsigned *)(sq + params.sq_off.tail);
+  sqMask = (unsigned *)(sq + params.sq_off.ring_mask);
+  sqArray = (unsigned *)(sq + params.sq_off.array);
+  cqHead = (unsigned *)(cq + params.cq_off.head);
+  cqTail = (unsigned *)(cq + params.cq_off.tail);
+  cqMask = (unsigned *)(cq + params.cq_off.ring_mask);
+  cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+  // kernels before 6.7 set up the ring but do not know the futex opcodes
+  const unsigned ops = 256;
+  struct io_uring_probe *probe =
+      (struct io_uring_probe *)calloc(1, sizeof(struct io_uring_probe) + ops * sizeof(struct io_uring_probe_op));
+  bool supported = syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, ops) == 0 &&
+                   probe->last_op >= IORING_OP_FUTEX_WAIT &&
+                   (probe->ops[IORING_OP_FUTEX_WAIT].flags & IO_URING_OP_SUPPORTED);
+  free(probe);
+
+  efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (!supported || efd == -1 || syscall(__NR_io_uring_register, fd, IORING_REGISTER_EVENTFD, &efd, 1) != 0) {
+    ::close(fd);
+    if (efd != -1) {
+      ::close(efd);
+    }
+    return false;
+  }
+  return true;
+}
+
+struct io_uring_sqe *Ring::next() {
+  unsigned tail = *sqTail;
+  if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) == entries) {
+    enter();
+  }
+  unsigned index = tail & *sqMask;
+  struct io_uring_sqe *sqe = &sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqArray[index] = index;
+  return sqe;
+}
+
+void Ring::submitWait(unsigned ticket, FutexShared *shared) {
+  struct io_uring_sqe *sqe = next();
+  sqe->opcode = IORING_OP_FUTEX_WAIT;
+  sqe->fd = FUTEX2_SIZE_U32; // not FUTEX2_PRIVATE, as the word is shared between processes
+  sqe->addr = (uint64_t)(uintptr_t)&shared->count;
+  sqe->addr2 = 0; // only sleeps while there are no units, a post before the wait starts completes it at once
+  sqe->addr3 = FUTEX_BITSET_MATCH_ANY;
+  sqe->user_data = ticket;
+  __atomic_store_n(sqTail, *sqTail + 1, __ATOMIC_RELEASE);
+  unsubmitted++;
+}
+
+// submits everything queued since the last call in one syscall
+void Ring::enter() {
+  while (unsubmitted) {
+    long submitted = syscall(__NR_io_uring_enter, fd, unsubmitted, 0, 0, nullptr, 0);
+    if (submitted >= 0) {
+      unsubmitted -= submitted;
+    } else if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+      throw std::system_error(errno, std::system_category(), "io_uring_enter");
+    }
+  }
+}
+
+unsigned Ring::wait(FutexShared *shared) {
+  std::lock_guard<std::mutex> lock(mutex);
+  unsigned ticket = nextTicket++;
+  if (ticket == 0) {
+    ticket = nextTicket++; // 0 is what completed() returns when there are none
+  }
+  // registered before looking at the count, so a post in between wakes the submitted wait
+  shared->waiters++;
+  if (take(shared, 1)) {
+    shared->waiters--;
+    acquired.push_back(ticket);
+    uint64_t one = 1;
+    if (write(efd, &one, sizeof(one)) == -1) {
+      // the eventfd cannot overflow from here, and completed() returns the ticket regardless
+    }
+    return ticket;
+  }
+  waits[ticket] = {shared, false};
+  submitWait(ticket, shared);
+  enter();
+  return ticket;
+}
+
+void Ring::cancel(FutexShared *shared) {
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto &entry : waits) {
+    if (entry.second.shared == shared && !entry.second.cancelled) {
+      entry.second.cancelled = true;
+      shared->waiters--;
+      struct io_uring_sqe *sqe = next();
+      sqe->opcode = IORING_OP_ASYNC_CANCEL;
+      sqe->addr = entry.first;
+      sqe->user_data = 0;
+      __atomic_store_n(sqTail, *sqTail + 1, __ATOMIC_RELEASE);
+      unsubmitted++;
+    }
+  }
+  enter();
+}
+
+unsigned Ring::completed() {
+  std::lock_guard<std::mutex> lock(mutex);
+  uint64_t signalled;
+  while (read(efd, &signalled, sizeof(signalled)) == -1 && errno == EINTR) {
+  }
+
+  unsigned head = *cqHead;
+  unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+  for (; head != tail; head++) {
+    struct io_uring_cqe *cqe = &cqes[head & *cqMask];
+    auto found = waits.find((unsigned)cqe->user_data);
+    if (found == waits.end()) {
+      continue; // a cancellation
+    }
+    Wait pending = found->second;
+    if (pending.cancelled) {
+      waits.erase(found);
+    } else if (cqe->res == 0 || cqe->res == -EAGAIN || cqe->res == -EINTR) {
+      // woken, or the count changed before the wait started
+      if (take(pending.shared, 1)) {
+        pending.shared->waiters--;
+        acquired.push_back(found->first);
+        waits.erase(found);
+      } else {
+        submitWait(found->first, pending.shared);
+      }
+    } else {
+      pending.shared->waiters--;
+      failed.push_back({found->first, -cqe->res});
+      waits.erase(found);
+    }
+  }
+  __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+  enter();
+
+  if (!failed.empty()) {
+    std::pair<unsigned, int> failure = failed.front();
+    failed.pop_front();
+    throw FutexWaitError(failure.first, failure.second);
+  }
+  if (acquired.empty()) {
+    return 0;
+  }
+  unsigned ticket = acquired.front();
+  acquired.pop_front();
+  return ticket;
+}
+
+bool SemaphoreF::uringAvailable() { return Ring::get() != nullptr; }
+
+int SemaphoreF::completionFd() {
+  Ring *ring = Ring::get();
+  if (!ring) {
+    throw std::system_error(ENOSYS, std::system_category(), "io_uring");
+  }
+  return ring->completionFd();
+}
+
+unsigned SemaphoreF::completed() {
+  Ring *ring = Ring::get();
+  return ring ? ring->completed() : 0;
+}
+
+SemaphoreF *SemaphoreF::createExclusive(Token &key, int mode, int value) {
+  if (!uringAvailable()) {
+    return new SemaphoreF(SemaphoreV::createExclusive(key, mode, value));
+  }
+  mode &= 0777;
+  int shmid = shmget(*key, sizeof(FutexShared), mode | IPC_CREAT | IPC_EXCL);
+  if (shmid == -1) {
+    throw std::system_error(errno, std::system_category(), "shmget");
+  }
+  FutexShared *shared = (FutexShared *)shmat(shmid, nullptr, 0);
+  if (shared == (FutexShared *)-1) {
+    const int error = errno;
+    shmctl(shmid, IPC_RMID, nullptr);
+    throw std::system_error(error, std::system_category(), "shmat");
+  }
+  // a new segment is zeroed, so only the count needs setting
+  shared->count = value;
+  shared->ready = 1;
+  return new SemaphoreF(shared, shmid);
+}
+
+SemaphoreF *SemaphoreF::open(Token &key) {
+  int shmid = shmget(*key, 0, 0);
+  if (shmid == -1) {
+    if (errno == ENOENT) {
+      return new SemaphoreF(SemaphoreV::open(key));
+    }
+    throw std::system_error(errno, std::system_category(), "shmget");
+  }
+  FutexShared *shared = (FutexShared *)shmat(shmid, nullptr, 0);
+  if (shared == (FutexShared *)-1) {
+    // removed by the last close between the shmget and the shmat
+    throw std::system_error(errno == EIDRM || errno == EINVAL ? ENOENT : errno, std::system_category(), "shmat");
+  }
+  for (int attempt = 0; attempt < OPEN_ATTEMPTS && !shared->ready.load(); attempt++) {
+    std::this_thread::yield();
+  }
+  if (!shared->ready.load()) {
+    shmdt(shared);
+    throw std::system_error(ETIMEDOUT, std::system_category(), "shmat");
+  }
+  return new SemaphoreF(shared, shmid);
+}
+
+void SemaphoreF::unlink(Token &key) {
+  int shmid = shmget(*key, 0, 0);
+  if (shmid == -1) {
+    if (errno == ENOENT) {
+      SemaphoreV::unlink(key);
+      return;
+    }
+    throw std::system_error(errno, std::system_category(), "shmget");
+  }
+  if (shmctl(shmid, IPC_RMID, nullptr) == -1) {
+    throw std::system_error(errno, std::system_category(), "shmctl");
+  }
+}
+
+void SemaphoreF::wait(unsigned value) {
+  if (fallback) {
+    fallback->wait(value);
+    return;
+  }
+  if (take(shared, value)) {
+    return;
+  }
+  shared->waiters++;
+  if (value > 1) {
+    shared->bulkWaiters++;
+  }
+  while (!take(shared, value)) {
+    uint32_t count = shared->count.load();
+    if (count < value && futex(&shared->count, FUTEX_WAIT, count) == -1 && errno != EAGAIN && errno != EINTR) {
+      const int error = errno;
+      shared->waiters--;
+      if (value > 1) {
+        shared->bulkWaiters--;
+      }
+      throw std::system_error(error, std::system_category(), "futex");
+    }
+  }
+  shared->waiters--;
+  if (value > 1) {
+    shared->bulkWaiters--;
+  }
+}
+
+void SemaphoreF::post(unsigned value) {
+  if (fallback) {
+    fallback->post(value);
+    return;
+  }
+  shared->count += value;
+  wake(shared, value);
+}
+
+unsigned SemaphoreF::waitAsync() {
+  Ring *ring = shared ? Ring::get() : nullptr;
+  if (!ring) {
+    throw std::system_error(ENOSYS, std::system_category(), "io_uring");
+  }
+  return ring->wait(shared);
+}
+
+void SemaphoreF::close() {
+  if (fallback) {
+    fallback->close();
+    delete fallback;
+    fallback = nullptr;
+    return;
+  }
+  if (!shared) {
+    throw std::system_error(EINVAL, std::system_category(), "shmdt");
+  }
+  Ring *ring = Ring::get();
+  if (ring) {
+    ring->cancel(shared);
+  }
+  if (shmdt(shared) == -1) {
+    throw std::system_error(errno, std::system_category(), "shmdt");
+  }
+  shared = nullptr;
+  // a process is detached when it exits, so the attachments are the processes still holding the semaphore and the last
+  // close removes it. One that attaches between the stat and the removal keeps the memory it has, but is no longer
+  // found by its key
+  struct shmid_ds info;
+  if (shmctl(shmid, IPC_STAT, &info) == 0 && info.shm_nattch == 0) {
+    shmctl(shmid, IPC_RMID, nullptr);
+  }
+  shmid = -1;
+}
+#else
+bool SemaphoreF::uringAvailable() { return false; }
+
+int SemaphoreF::completionFd() { throw std::system_error(ENOSYS, std::system_category(), "io_uring"); }
+
+unsigned SemaphoreF::completed() { return 0; }
+
+SemaphoreF *SemaphoreF::createExclusive(Token &key, int mode, int value) {
+  return new SemaphoreF(SemaphoreV::createExclusive(key, mode, value));
+}
+
+SemaphoreF *SemaphoreF::open(Token &key) { return new SemaphoreF(SemaphoreV::open(key)); }
+
+void SemaphoreF::unlink(Token &key) { SemaphoreV::unlink(key); }
+
+void SemaphoreF::wait(unsigned value) { fallback->wait(value); }
+
+void SemaphoreF::post(unsigned value) { fallback->post(value); }
+
+unsigned SemaphoreF::waitAsync() { throw std::system_error(ENOSYS, std::system_category(), "io_uring"); }
+
+void SemaphoreF::close() {
+  fallback->close();
+  delete fallback;
+  fallback = nullptr;
+}
+#endif
+
+SemaphoreF *SemaphoreF::create(Token &key, int mode, int value) {
+  do {
+    try {
+      return createExclusive(key, mode, value);
+    } catch (std::system_error &e) {
+      if (e.code().value() != EEXIST) {
+        throw;
+      }
+    }
+    // the next open can fail if there is a race and another process/thread removed the semaphore
+    // if that happens, go around again and attempt to create it
+    try {
+      return open(key);
+    } catch (std::system_error &e) {
+      if (e.code().value() != ENOENT) {
+        throw;
+      }
+    }
+  } while (true);
+}
+
+void SemaphoreF::wait() { wait(1); }
+
+bool SemaphoreF::trywait() { return trywait(1); }
+
+bool SemaphoreF::trywait(unsigned value) { return fallback ? fallback->trywait(value) : take(shared, value); }
+
+void SemaphoreF::post() { post(1); }
+
+unsigned SemaphoreF::valueOf() { return fallback ? fallback->valueOf() : shared->count.load(); }
+
+unsigned SemaphoreF::refs() {
+  if (fallback) {
+    return fallback->refs();
+  }
+  struct shmid_ds info;
+  if (shmctl(shmid, IPC_STAT, &info) == -1) {
+    throw std::system_error(errno, std::system_category(), "shmctl");
+  }
+  // every open handle is attached, the creator's included, as SemaphoreV counts it
+  return info.shm_nattch;
+}
+
+bool SemaphoreF::isFutex() { return shared != nullptr; }
+
+SemaphoreF::~SemaphoreF() {
+  if (!shared && !fallback) {
+    return;
+  }
+  try {
+    close();
+  } catch (...) {
+    // Destructor should never throw - silently ignore cleanup errors
+  }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "semaphore-sysv.h"
+#include "token.h"
+
+#include <string>
+#include <system_error>
+
+// A semaphore whose count is a futex word in a System V shared memory segment keyed by the token. Uncontended
+// operations are a compare and swap with no syscall, and multi-unit operations are atomic.
+//
+// waitAsync() acquires a unit without blocking the caller or parking a thread: the wait is submitted as an io_uring
+// futex wait (Linux 6.7+) on a ring shared by every semaphore in the process. The ring signals completionFd(), an
+// eventfd meant to be watched by the caller's event loop, and completed() then returns the tickets that acquired. The
+// bindings watch it themselves, and resolve a promise for each wait (see wait-async.h).
+//
+// When io_uring futex waits are not available, create() and createExclusive() make a SemaphoreV instead and every
+// operation is passed through to it; waitAsync() then fails with ENOSYS. open() follows whichever kind the creator
+// made, so processes with and without io_uring can share a semaphore. Units held by a process that exits are not
+// given back, as there is no SEM_UNDO for a futex.
+
+struct FutexShared;
+
+// what completed() throws for a ticket whose wait failed
+class FutexWaitError : public std::system_error {
+public:
+  const unsigned ticket;
+
+  FutexWaitError(unsigned t, int error)
+      : std::system_error(error, std::system_category(), "io_uring futex wait " + std::to_string(t)), ticket(t){};
+};
+
+class SemaphoreF {
+  FutexShared *shared;
+  int shmid;
+  SemaphoreV *fallback;
+
+  SemaphoreF(FutexShared *s, int id) : shared(s), shmid(id), fallback(nullptr){};
+  SemaphoreF(SemaphoreV *f) : shared(nullptr), shmid(-1), fallback(f){};
+
+public:
+  static SemaphoreF *createExclusive(Token &key, int mode, int value);
+  static SemaphoreF *create(Token &key, int mode, int value);
+  static SemaphoreF *open(Token &key);
+  static void unlink(Token &key);
+
+  // whether waits can be made through io_uring in this process
+  static bool uringAvailable();
+  // an eventfd that is readable when completed() has tickets to return
+  static int completionFd();
+  // the next ticket from waitAsync() that has acquired its unit, or 0 when there are none
+  static unsigned completed();
+
+  void wait();
+  void wait(unsigned value);
+  bool trywait();
+  bool trywait(unsigned value);
+  void post();
+  void post(unsigned value);
+  // submits a wait for one unit and returns its ticket, which completed() returns once the unit is held
+  unsigned waitAsync();
+  unsigned valueOf();
+  // the handles open on the semaphore, the creator's included
+  unsigned refs();
+  bool isFutex();
+  void close();
+
+  ~SemaphoreF();
+};
@@ -0,0 +1,188 @@
+#include "semaphore-futex.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <poll.h>
+#include <sys/shm.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class SemaphoreFKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'f');
+  }
+
+  // remove the segment or set, even if the test failed part way through
+  void TearDown() override {
+    try {
+      SemaphoreF::unlink(*key);
+    } catch (std::system_error &) {
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  // waits for the next ticket, watching the completion fd the way an event loop would
+  unsigned nextCompleted(int timeout_ms) {
+    struct pollfd readable = {SemaphoreF::completionFd(), POLLIN, 0};
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (std::chrono::steady_clock::now() < deadline) {
+      unsigned ticket = SemaphoreF::completed();
+      if (ticket) {
+        return ticket;
+      }
+      poll(&readable, 1, 10);
+    }
+    return 0;
+  }
+};
+
+TEST_F(SemaphoreFKernelTest, CountsUnitsAtomically) {
+  SemaphoreF *sem = SemaphoreF::createExclusive(*key, 0600, 2);
+
+  EXPECT_TRUE(sem->trywait());
+  EXPECT_FALSE(sem->trywait(2));
+  EXPECT_EQ(sem->valueOf(), 1u);
+  sem->post(4);
+  EXPECT_TRUE(sem->trywait(5));
+  EXPECT_FALSE(sem->trywait());
+
+  delete sem;
+}
+
+TEST_F(SemaphoreFKernelTest, LastCloseRemovesIt) {
+  SemaphoreF *creator = SemaphoreF::create(*key, 0600, 1);
+  SemaphoreF *opener = SemaphoreF::create(*key, 0600, 1);
+  EXPECT_EQ(creator->refs(), 2u);
+
+  opener->close();
+  EXPECT_EQ(creator->refs(), 1u);
+  creator->close();
+  try {
+    SemaphoreF::open(*key);
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), ENOENT);
+  }
+
+  delete opener;
+  delete creator;
+}
+
+TEST_F(SemaphoreFKernelTest, WaitForSeveralUnitsIsNotStarvedBySingleUnitWaiters) {
+  SemaphoreF *sem = SemaphoreF::createExclusive(*key, 0600, 0);
+  std::atomic<int> acquired(0);
+
+  std::thread bulk([&] {
+    sem->wait(2);
+    acquired++;
+  });
+  std::thread single([&] {
+    sem->wait();
+    acquired++;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  sem->post(3);
+  bulk.join();
+  single.join();
+  EXPECT_EQ(acquired, 2);
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreFKernelTest, IsSharedBetweenProcesses) {
+  SemaphoreF *sem = SemaphoreF::createExclusive(*key, 0600, 0);
+
+  pid_t child = fork();
+  if (child == 0) {
+    int status = 1;
+    try {
+      SemaphoreF *other = SemaphoreF::open(*key);
+      other->post(3);
+      delete other;
+      status = 0;
+    } catch (...) {
+    }
+    _exit(status);
+  }
+  int status;
+  waitpid(child, &status, 0);
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+  EXPECT_EQ(sem->valueOf(), 3u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreFKernelTest, WaitAsyncCompletesWhenAnotherProcessPosts) {
+  if (!SemaphoreF::uringAvailable()) {
+    GTEST_SKIP() << "io_uring futex waits are not available";
+  }
+  SemaphoreF *sem = SemaphoreF::createExclusive(*key, 0600, 0);
+  ASSERT_TRUE(sem->isFutex());
+
+  unsigned first = sem->waitAsync();
+  unsigned second = sem->waitAsync();
+  EXPECT_EQ(SemaphoreF::completed(), 0u);
+
+  pid_t child = fork();
+  if (child == 0) {
+    SemaphoreF *other = SemaphoreF::open(*key);
+    other->post();
+    delete other;
+    _exit(0);
+  }
+  waitpid(child, nullptr, 0);
+  unsigned ticket = nextCompleted(1000);
+  EXPECT_TRUE(ticket == first || ticket == second);
+  EXPECT_EQ(SemaphoreF::completed(), 0u);
+
+  sem->post();
+  EXPECT_EQ(nextCompleted(1000), ticket == first ? second : first);
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreFKernelTest, WaitAsyncCompletesAtOnceWhenAUnitIsFree) {
+  if (!SemaphoreF::uringAvailable()) {
+    GTEST_SKIP() << "io_uring futex waits are not available";
+  }
+  SemaphoreF *sem = SemaphoreF::createExclusive(*key, 0600, 1);
+
+  unsigned ticket = sem->waitAsync();
+  EXPECT_EQ(nextCompleted(100), ticket);
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreFKernelTest, CloseCancelsPendingWaits) {
+  if (!SemaphoreF::uringAvailable()) {
+    GTEST_SKIP() << "io_uring futex waits are not available";
+  }
+  SemaphoreF *sem = SemaphoreF::createExclusive(*key, 0600, 0);
+  SemaphoreF *other = SemaphoreF::open(*key);
+
+  sem->waitAsync();
+  sem->close();
+  other->post();
+  EXPECT_EQ(nextCompleted(50), 0u);
+  EXPECT_EQ(other->valueOf(), 1u); // the unit is left for someone else
+
+  delete other;
+  delete sem;
+}
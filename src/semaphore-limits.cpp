@@ -0,0 +1,84 @@
+#include "semaphore-limits.h"
+
+#include <fstream>
+#include <string>
+#include <sys/sem.h>
+
+#ifdef _SEM_SEMUN_UNDEFINED
+union semun {
+  int val;               /* Value for SETVAL */
+  struct semid_ds *buf;  /* Buffer for IPC_STAT, IPC_SET */
+  unsigned short *array; /* Array for GETALL, SETALL */
+  struct seminfo *__buf; /* Buffer for IPC_INFO (Linux-specific) */
+};
+#endif
+
+#define SEMVMX 32767 // the same on every system with System V semaphores
+
+static void readMaxima(SemaphoreLimits &limits) {
+#ifdef __linux__
+  struct seminfo info;
+  semun arg;
+  arg.__buf = &info;
+  if (semctl(0, 0, IPC_INFO, arg) != -1) {
+    limits.maxSetSize = info.semmsl;
+    limits.maxSemaphores = info.semmns;
+    limits.maxOpsPerCall = info.semopm;
+    limits.maxSets = info.semmni;
+    limits.maxValue = info.semvmx;
+    return;
+  }
+  // SEMMSL SEMMNS SEMOPM SEMMNI
+  std::ifstream sem("/proc/sys/kernel/sem");
+  sem >> limits.maxSetSize >> limits.maxSemaphores >> limits.maxOpsPerCall >> limits.maxSets;
+  if (!sem) {
+    limits.maxSetSize = limits.maxSemaphores = limits.maxOpsPerCall = limits.maxSets = 0;
+  }
+#endif
+  limits.maxValue = SEMVMX;
+}
+
+static void readUsage(SemaphoreLimits &limits) {
+#ifdef __linux__
+  struct seminfo info;
+  semun arg;
+  arg.__buf = &info;
+  // for SEM_INFO, semusz is the number of sets and semaem the number of semaphores
+  if (semctl(0, 0, SEM_INFO, arg) != -1) {
+    limits.setsInUse = info.semusz;
+    limits.semaphoresInUse = info.semaem;
+    return;
+  }
+  // a heading, then a set on each line with its nsems in the fourth column
+  std::ifstream sets("/proc/sysvipc/sem");
+  std::string line;
+  std::getline(sets, line);
+  std::string key, semid, perms;
+  unsigned nsems;
+  while (sets >> key >> semid >> perms >> nsems) {
+    limits.setsInUse++;
+    limits.semaphoresInUse += nsems;
+    std::getline(sets, line);
+  }
+#endif
+}
+
+SemaphoreLimits semaphoreLimits() {
+  SemaphoreLimits limits = {};
+  readMaxima(limits);
+  readUsage(limits);
+  return limits;
+}
+
+static const SemaphoreLimits &maxima() {
+  static const SemaphoreLimits limits = [] {
+    SemaphoreLimits limits = {};
+    readMaxima(limits);
+    return limits;
+  }();
+  return limits;
+}
+
+unsigned semaphoreMaxOpsPerCall() { return maxima().maxOpsPerCall; }
+
+unsigned semaphoreMaxSetSize() { return maxima().maxSetSize; }
@@ -0,0 +1,20 @@
+#pragma once
+
+// The kernel's limits on System V semaphores, and how much of them is in use across the system. A limit the platform
+// does not report is 0.
+struct SemaphoreLimits {
+  unsigned maxSetSize;    // SEMMSL, semaphores in one set
+  unsigned maxSemaphores; // SEMMNS, semaphores in every set together
+  unsigned maxOpsPerCall; // SEMOPM, operations in one semop
+  unsigned maxSets;       // SEMMNI, sets
+  unsigned maxValue;      // SEMVMX, the value of one semaphore
+  unsigned setsInUse;
+  unsigned semaphoresInUse;
+};
+
+// read from IPC_INFO and SEM_INFO, or from /proc/sys/kernel/sem and /proc/sysvipc/sem where semctl does not report them
+SemaphoreLimits semaphoreLimits();
+
+// SEMOPM and SEMMSL, read once by a process for the primitives that size their operations and sets to them
+unsigned semaphoreMaxOpsPerCall();
+unsigned semaphoreMaxSetSize();
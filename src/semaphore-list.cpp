@@ -0,0 +1,105 @@
+#include "semaphore-list.h"
+
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/sem.h>
+
+#ifdef _SEM_SEMUN_UNDEFINED
+union semun {
+  int val;               /* Value for SETVAL */
+  struct semid_ds *buf;  /* Buffer for IPC_STAT, IPC_SET */
+  unsigned short *array; /* Array for GETALL, SETALL */
+  struct seminfo *__buf; /* Buffer for IPC_INFO (Linux-specific) */
+};
+#endif
+
+// reads the values and the waiters, which /proc and SEM_STAT_ANY leave out. False if the set has gone
+static bool readContents(SemaphoreSetInfo &info) {
+  info.values.resize(info.nsems);
+  semun arg;
+  arg.array = info.values.data();
+  if (semctl(info.id, 0, GETALL, arg) == -1) {
+    info.values.clear();
+    return errno != EINVAL && errno != EIDRM;
+  }
+  info.refs = info.values.empty() ? 0 : info.values.back();
+  for (unsigned slot = 0; slot < info.nsems; slot++) {
+    const int decrement = semctl(info.id, slot, GETNCNT);
+    const int zero = semctl(info.id, slot, GETZCNT);
+    if (decrement == -1 || zero == -1) {
+      return errno != EINVAL && errno != EIDRM;
+    }
+    info.waitingToDecrement += decrement;
+    info.waitingForZero += zero;
+  }
+  return true;
+}
+
+// a heading, then a set on each line: key semid perms nsems uid gid cuid cgid otime ctime
+static bool listFromProc(std::vector<SemaphoreSetInfo> &sets) {
+  std::ifstream file("/proc/sysvipc/sem");
+  if (!file) {
+    return false;
+  }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  std::string line;
+  std::getline(contents, line);
+  while (std::getline(contents, line)) {
+    std::istringstream fields(line);
+    SemaphoreSetInfo info = {};
+    unsigned gid, cuid, cgid;
+    if (fields >> info.key >> info.id >> std::oct >> info.mode >> std::dec >> info.nsems >> info.owner >> gid >>
+        cuid >> cgid >> info.otime >> info.ctime) {
+      info.mode &= 0777;
+      sets.push_back(info);
+    }
+  }
+  return true;
+}
+
+static void listFromStat(std::vector<SemaphoreSetInfo> &sets) {
+#if defined(__linux__) && defined(SEM_STAT_ANY)
+  struct seminfo limits;
+  semun arg;
+  arg.__buf = &limits;
+  // SEM_INFO returns the highest index in use
+  const int highest = semctl(0, 0, SEM_INFO, arg);
+  for (int index = 0; index <= highest; index++) {
+    struct semid_ds ds;
+    arg.buf = &ds;
+    const int id = semctl(index, 0, SEM_STAT_ANY, arg);
+    if (id == -1) {
+      continue;
+    }
+    SemaphoreSetInfo info = {};
+    info.key = ds.sem_perm.__key;
+    info.id = id;
+    info.owner = ds.sem_perm.uid;
+    info.mode = ds.sem_perm.mode & 0777;
+    info.nsems = ds.sem_nsems;
+    info.otime = ds.sem_otime;
+    info.ctime = ds.sem_ctime;
+    sets.push_back(info);
+  }
+#else
+  (void)sets;
+#endif
+}
+
+std::vector<SemaphoreSetInfo> semaphoreList() {
+  std::vector<SemaphoreSetInfo> sets;
+  if (!listFromProc(sets)) {
+    listFromStat(sets);
+  }
+  std::vector<SemaphoreSetInfo> present;
+  present.reserve(sets.size());
+  for (SemaphoreSetInfo &info : sets) {
+    if (readContents(info)) {
+      present.push_back(std::move(info));
+    }
+  }
+  return present;
+}
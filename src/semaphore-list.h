@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+
+// One System V semaphore set on the host, as ipcs -s shows it along with what is inside it.
+struct SemaphoreSetInfo {
+  int key;
+  int id;
+  unsigned owner; // uid
+  unsigned mode;  // permission bits
+  unsigned nsems;
+  long long otime; // the last semop, in seconds since the epoch, or 0 if there has been none
+  long long ctime; // the last change of the set
+  // the value of each semaphore, empty when the caller may not read the set
+  std::vector<unsigned short> values;
+  // the last semaphore, which counts the handles in sets made by this library
+  unsigned refs;
+  // processes and threads blocked on any semaphore of the set
+  unsigned waitingToDecrement;
+  unsigned waitingForZero;
+};
+
+// every set on the host, listed from /proc/sysvipc/sem in one read, or with SEM_STAT_ANY where that is not mounted.
+// Sets removed while they are read are left out
+std::vector<SemaphoreSetInfo> semaphoreList();
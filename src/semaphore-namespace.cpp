@@ -0,0 +1,461 @@
+#include "semaphore-namespace.h"
+#include "semaphore-limits.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <sys/ipc.h>
+#include <sys/sem.h>
+#include <sys/shm.h>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef _SEM_SEMUN_UNDEFINED
+union semun {
+  int val;               /* Value for SETVAL */
+  struct semid_ds *buf;  /* Buffer for IPC_STAT, IPC_SET */
+  unsigned short *array; /* Array for GETALL, SETALL */
+  struct seminfo *__buf; /* Buffer for IPC_INFO (Linux-specific) */
+};
+#endif
+
+#define NAME_LENGTH 63
+#define ENTRIES_PER_SET 8192 // two semaphores each, at most, and fewer where SEMMSL is lower
+#define MAX_SETS 64
+#define OPEN_ATTEMPTS 5000   // how many milliseconds open waits for a concurrent createExclusive
+
+struct NamespaceEntry {
+  uint32_t nextFree;     // the next entry on the free list plus one, or 0 at the end
+  uint32_t nextInBucket; // the next entry with the same hash plus one, or 0 at the end
+  uint32_t generation;   // counts the names the entry has held, so a late close cannot free a later one
+  uint32_t inUse;
+  char name[NAME_LENGTH + 1];
+};
+
+struct NamespaceShared {
+  std::atomic<uint32_t> ready; // set by the creator once the sets exist
+  uint32_t capacity;
+  uint32_t perSet; // entries in each set, chosen by the creator
+  uint32_t sets;
+  std::atomic<uint32_t> used;
+  uint32_t freeList; // the first free entry plus one, or 0 when every entry holds a name
+  int semids[MAX_SETS];
+  // followed by capacity bucket heads, each an entry plus one, and then capacity entries
+};
+
+struct NamespaceDirectory {
+  NamespaceShared *shared;
+  int shmid;
+
+  NamespaceDirectory(NamespaceShared *s, int id) : shared(s), shmid(id){};
+
+  uint32_t *buckets() { return (uint32_t *)(shared + 1); }
+  NamespaceEntry *entries() { return (NamespaceEntry *)(buckets() + shared->capacity); }
+  int semid(unsigned entry) { return shared->semids[entry / shared->perSet]; }
+  // the semaphore holding the entry's value, followed by the one counting its handles
+  unsigned short slot(unsigned entry) { return 2 * (entry % shared->perSet); }
+  // the directory lock, one more semaphore after the entries of the first set
+  unsigned short lock() { return 2 * std::min<unsigned>(shared->perSet, shared->capacity); }
+
+  ~NamespaceDirectory();
+};
+
+static size_t sharedSize(unsigned capacity) {
+  return sizeof(NamespaceShared) + capacity * sizeof(uint32_t) + capacity * sizeof(NamespaceEntry);
+}
+
+// as many entries as fit in one set beside the lock
+static unsigned entriesPerSet() {
+  const unsigned limit = semaphoreMaxSetSize();
+  return limit ? std::min<unsigned>(ENTRIES_PER_SET, (limit - 1) / 2) : ENTRIES_PER_SET;
+}
+
+static unsigned setSize(const NamespaceShared *shared, unsigned set) {
+  const unsigned entries = std::min<unsigned>(shared->perSet, shared->capacity - set * shared->perSet);
+  return 2 * entries + (set == 0 ? 1 : 0);
+}
+
+// a process is detached when it exits, so the attachments are the processes still holding the namespace and the last
+// close removes it all. It does so holding the directory lock: a process opening the namespace meanwhile has either
+// attached and taken the lock first, and so keeps it, or takes the lock only to find the sets removed, and open tells
+// it there is no namespace. Until the creator has set the lock up, nobody else can have opened the namespace
+NamespaceDirectory::~NamespaceDirectory() {
+  std::vector<int> semids(shared->semids, shared->semids + shared->sets);
+  struct sembuf op = {lock(), -1, SEM_UNDO};
+  bool locked = false;
+  if (shared->ready.load()) {
+    int result;
+    while ((result = semop(semids[0], &op, 1)) == -1 && errno == EINTR) {
+    }
+    locked = result == 0;
+  }
+  shmdt(shared);
+  struct shmid_ds info;
+  if (shmctl(shmid, IPC_STAT, &info) == 0 && info.shm_nattch == 0) {
+    shmctl(shmid, IPC_RMID, nullptr);
+    for (int semid : semids) {
+      semctl(semid, 0, IPC_RMID);
+    }
+  } else if (locked) {
+    op.sem_op = 1;
+    while (semop(semids[0], &op, 1) == -1 && errno == EINTR) {
+    }
+  }
+}
+
+static void operate(int semid, struct sembuf *ops, size_t count) {
+  while (semop(semid, ops, count) == -1) {
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+}
+
+static bool tryOperate(int semid, struct sembuf *ops, size_t count) {
+  while (semop(semid, ops, count) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+  return true;
+}
+
+static unsigned getValue(int semid, unsigned short slot) {
+  const int result = semctl(semid, slot, GETVAL);
+  if (result == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+  return result;
+}
+
+// held while the buckets and the entries are changed
+class DirectoryLock {
+  int semid;
+  unsigned short slot;
+
+public:
+  DirectoryLock(NamespaceDirectory &directory) : semid(directory.shared->semids[0]), slot(directory.lock()) {
+    struct sembuf op = {slot, -1, SEM_UNDO};
+    operate(semid, &op, 1);
+  }
+
+  ~DirectoryLock() {
+    struct sembuf op = {slot, 1, SEM_UNDO};
+    while (semop(semid, &op, 1) == -1 && errno == EINTR) {
+    }
+  }
+};
+
+// the free list is only changed holding the directory lock, or by the creator before the namespace is ready
+static void pushFree(NamespaceShared *shared, NamespaceEntry *entries, uint32_t entry) {
+  entries[entry].nextFree = shared->freeList;
+  shared->freeList = entry + 1;
+}
+
+static int popFree(NamespaceShared *shared, NamespaceEntry *entries) {
+  if (shared->freeList == 0) {
+    return -1;
+  }
+  const uint32_t entry = shared->freeList - 1;
+  shared->freeList = entries[entry].nextFree;
+  return entry;
+}
+
+// FNV-1a
+static uint32_t hash(const char *name) {
+  uint32_t result = 2166136261u;
+  for (; *name; name++) {
+    result = (result ^ (unsigned char)*name) * 16777619u;
+  }
+  return result;
+}
+
+// called holding the directory lock
+static void reclaim(NamespaceDirectory &directory, unsigned entry) {
+  NamespaceEntry &e = directory.entries()[entry];
+  uint32_t *link = &directory.buckets()[hash(e.name) % directory.shared->capacity];
+  while (*link != 0 && *link != entry + 1) {
+    link = &directory.entries()[*link - 1].nextInBucket;
+  }
+  if (*link != 0) {
+    *link = e.nextInBucket;
+  }
+  e.nextInBucket = 0;
+  e.inUse = 0;
+  e.name[0] = '\0';
+  directory.shared->used--;
+  pushFree(directory.shared, directory.entries(), entry);
+}
+
+// reclaims the names whose handles were all given back by processes that exited, called holding the directory lock
+static unsigned sweep(NamespaceDirectory &directory) {
+  unsigned reclaimed = 0;
+  for (unsigned set = 0; set < directory.shared->sets; set++) {
+    std::vector<unsigned short> values(setSize(directory.shared, set));
+    semun arg;
+    arg.array = values.data();
+    if (semctl(directory.shared->semids[set], 0, GETALL, arg) == -1) {
+      throw std::system_error(errno, std::system_category(), "semctl");
+    }
+    for (unsigned i = 0; 2 * i + 1 < values.size(); i++) {
+      const unsigned entry = set * directory.shared->perSet + i;
+      if (directory.entries()[entry].inUse && values[2 * i + 1] == 0) {
+        reclaim(directory, entry);
+        reclaimed++;
+      }
+    }
+  }
+  return reclaimed;
+}
+
+SemaphoreNamespace *SemaphoreNamespace::createExclusive(Token &key, int mode, unsigned capacity) {
+  const unsigned perSet = entriesPerSet();
+  if (capacity == 0 || perSet == 0 || capacity > MAX_SETS * perSet) {
+    throw std::system_error(EINVAL, std::system_category(), "shmget");
+  }
+  mode &= 0777;
+  int shmid = shmget(*key, sharedSize(capacity), mode | IPC_CREAT | IPC_EXCL);
+  if (shmid == -1) {
+    throw std::system_error(errno, std::system_category(), "shmget");
+  }
+  NamespaceShared *shared = (NamespaceShared *)shmat(shmid, nullptr, 0);
+  if (shared == (NamespaceShared *)-1) {
+    const int error = errno;
+    shmctl(shmid, IPC_RMID, nullptr);
+    throw std::system_error(error, std::system_category(), "shmat");
+  }
+  // a new segment is zeroed, and if making the sets fails the directory removes those made so far with the segment
+  auto directory = std::make_shared<NamespaceDirectory>(shared, shmid);
+  shared->capacity = capacity;
+  shared->perSet = perSet;
+  for (unsigned set = 0; set * perSet < capacity; set++) {
+    int semid = semget(IPC_PRIVATE, setSize(shared, set), mode | IPC_CREAT);
+    if (semid == -1) {
+      throw std::system_error(errno, std::system_category(), "semget");
+    }
+    shared->semids[set] = semid;
+    shared->sets = set + 1;
+  }
+  semun arg;
+  arg.val = 1;
+  if (semctl(shared->semids[0], directory->lock(), SETVAL, arg) == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+  for (unsigned entry = capacity; entry-- > 0;) {
+    pushFree(shared, directory->entries(), entry);
+  }
+  shared->ready = 1;
+  return new SemaphoreNamespace(directory);
+}
+
+SemaphoreNamespace *SemaphoreNamespace::create(Token &key, int mode, unsigned capacity) {
+  do {
+    try {
+      return createExclusive(key, mode, capacity);
+    } catch (std::system_error &e) {
+      if (e.code().value() != EEXIST) {
+        throw;
+      }
+    }
+    // the namespace can be removed by its last close between the two, so go around again
+    try {
+      return open(key);
+    } catch (std::system_error &e) {
+      if (e.code().value() != ENOENT) {
+        throw;
+      }
+    }
+  } while (true);
+}
+
+SemaphoreNamespace *SemaphoreNamespace::open(Token &key) {
+  int shmid = shmget(*key, 0, 0);
+  if (shmid == -1) {
+    throw std::system_error(errno, std::system_category(), "shmget");
+  }
+  NamespaceShared *shared = (NamespaceShared *)shmat(shmid, nullptr, 0);
+  if (shared == (NamespaceShared *)-1) {
+    // removed by the last close between the shmget and the shmat
+    throw std::system_error(errno == EIDRM || errno == EINVAL ? ENOENT : errno, std::system_category(), "shmat");
+  }
+  auto directory = std::make_shared<NamespaceDirectory>(shared, shmid);
+  for (int attempt = 0; attempt < OPEN_ATTEMPTS && !shared->ready.load(); attempt++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  if (!shared->ready.load()) {
+    throw std::system_error(ETIMEDOUT, std::system_category(), "shmat");
+  }
+  // the last close removes the sets holding the directory lock, so once the lock has been taken and given back the
+  // sets are either still there, and this attachment keeps them, or gone and the namespace with them
+  try {
+    DirectoryLock lock(*directory);
+  } catch (std::system_error &e) {
+    if (e.code().value() != EIDRM && e.code().value() != EINVAL) {
+      throw;
+    }
+    throw std::system_error(ENOENT, std::system_category(), "semop");
+  }
+  return new SemaphoreNamespace(directory);
+}
+
+void SemaphoreNamespace::unlink(Token &key) {
+  int shmid = shmget(*key, 0, 0);
+  if (shmid == -1) {
+    throw std::system_error(errno, std::system_category(), "shmget");
+  }
+  NamespaceShared *shared = (NamespaceShared *)shmat(shmid, nullptr, 0);
+  if (shared != (NamespaceShared *)-1) {
+    for (unsigned set = 0; set < shared->sets; set++) {
+      semctl(shared->semids[set], 0, IPC_RMID);
+    }
+    shmdt(shared);
+  }
+  if (shmctl(shmid, IPC_RMID, nullptr) == -1) {
+    throw std::system_error(errno, std::system_category(), "shmctl");
+  }
+}
+
+NamedSemaphore *SemaphoreNamespace::lookup(const std::string &name, int value, int flags) {
+  if (!directory) {
+    throw std::system_error(EINVAL, std::system_category(), "semget");
+  }
+  if (name.empty() || name.size() > NAME_LENGTH || name.find('\0') != std::string::npos) {
+    throw std::system_error(name.size() > NAME_LENGTH ? ENAMETOOLONG : EINVAL, std::system_category(), "semget");
+  }
+  NamespaceDirectory &d = *directory;
+  DirectoryLock lock(d);
+  uint32_t &bucket = d.buckets()[hash(name.c_str()) % d.shared->capacity];
+  int found = -1;
+  for (uint32_t next = bucket; next != 0; next = d.entries()[next - 1].nextInBucket) {
+    if (name == d.entries()[next - 1].name) {
+      found = next - 1;
+      break;
+    }
+  }
+  if (found != -1 && (flags & IPC_CREAT) && (flags & IPC_EXCL)) {
+    throw std::system_error(EEXIST, std::system_category(), "semget");
+  }
+  if (found == -1) {
+    if (!(flags & IPC_CREAT)) {
+      throw std::system_error(ENOENT, std::system_category(), "semget");
+    }
+    found = popFree(d.shared, d.entries());
+    if (found == -1 && sweep(d) > 0) {
+      found = popFree(d.shared, d.entries());
+    }
+    if (found == -1) {
+      throw std::system_error(ENOSPC, std::system_category(), "semget");
+    }
+    NamespaceEntry &e = d.entries()[found];
+    strcpy(e.name, name.c_str());
+    e.generation++;
+    e.inUse = 1;
+    e.nextInBucket = bucket;
+    bucket = found + 1;
+    d.shared->used++;
+    semun arg;
+    arg.val = value;
+    if (semctl(d.semid(found), d.slot(found), SETVAL, arg) == -1) {
+      const int error = errno;
+      reclaim(d, found);
+      throw std::system_error(error, std::system_category(), "semctl");
+    }
+  }
+  struct sembuf op = {(unsigned short)(d.slot(found) + 1), 1, SEM_UNDO};
+  operate(d.semid(found), &op, 1);
+  return new NamedSemaphore(directory, found, d.entries()[found].generation, d.semid(found), d.slot(found));
+}
+
+NamedSemaphore *SemaphoreNamespace::createSemaphore(const std::string &name, int value) {
+  return lookup(name, value, IPC_CREAT);
+}
+
+NamedSemaphore *SemaphoreNamespace::createSemaphoreExclusive(const std::string &name, int value) {
+  return lookup(name, value, IPC_CREAT | IPC_EXCL);
+}
+
+NamedSemaphore *SemaphoreNamespace::openSemaphore(const std::string &name) { return lookup(name, 0, 0); }
+
+unsigned SemaphoreNamespace::capacity() {
+  if (!directory) {
+    throw std::system_error(EINVAL, std::system_category(), "shmat");
+  }
+  return directory->shared->capacity;
+}
+
+unsigned SemaphoreNamespace::used() {
+  if (!directory) {
+    throw std::system_error(EINVAL, std::system_category(), "shmat");
+  }
+  return directory->shared->used.load();
+}
+
+void SemaphoreNamespace::close() {
+  if (!directory) {
+    throw std::system_error(EINVAL, std::system_category(), "shmdt");
+  }
+  directory.reset();
+}
+
+SemaphoreNamespace::~SemaphoreNamespace() {}
+
+void NamedSemaphore::wait() { wait(1); }
+
+void NamedSemaphore::wait(unsigned value) {
+  struct sembuf op = {slot, (short)-value, SEM_UNDO};
+  operate(semid, &op, 1);
+}
+
+bool NamedSemaphore::trywait() { return trywait(1); }
+
+bool NamedSemaphore::trywait(unsigned value) {
+  struct sembuf op = {slot, (short)-value, SEM_UNDO | IPC_NOWAIT};
+  return tryOperate(semid, &op, 1);
+}
+
+void NamedSemaphore::post() { post(1); }
+
+void NamedSemaphore::post(unsigned value) {
+  struct sembuf op = {slot, (short)value, SEM_UNDO};
+  operate(semid, &op, 1);
+}
+
+unsigned NamedSemaphore::valueOf() { return getValue(semid, slot); }
+
+unsigned NamedSemaphore::refs() { return getValue(semid, slot + 1); }
+
+// the last close gives the entry back, unless the name was reclaimed and reused since
+void NamedSemaphore::close() {
+  if (!directory) {
+    throw std::system_error(EINVAL, std::system_category(), "semop");
+  }
+  struct sembuf op = {(unsigned short)(slot + 1), -1, SEM_UNDO | IPC_NOWAIT};
+  tryOperate(semid, &op, 1);
+  if (getValue(semid, slot + 1) == 0) {
+    DirectoryLock lock(*directory);
+    NamespaceEntry &e = directory->entries()[entry];
+    if (e.inUse && e.generation == generation && getValue(semid, slot + 1) == 0) {
+      reclaim(*directory, entry);
+    }
+  }
+  directory.reset();
+  semid = -1;
+}
+
+NamedSemaphore::~NamedSemaphore() {
+  if (!directory) {
+    return;
+  }
+  try {
+    close();
+  } catch (...) {
+    // Destructor should never throw - silently ignore cleanup errors
+  }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "token.h"
+
+#include <memory>
+#include <string>
+
+// Named semaphores packed into a few large System V sets, so thousands of them take neither a set nor a token file
+// each. The namespace is one shared memory directory keyed by a token, mapping names to semaphores in sets it creates
+// with IPC_PRIVATE; creating or opening a named semaphore is a lookup in the directory rather than a semget.
+//
+// Each name has a semaphore for its value and one counting its handles, SEM_UNDO so a process that exits without
+// closing gives its handles back. The last close of a name returns its semaphores to a free list for reuse, and names
+// whose handles were all given back by exiting processes are reclaimed when the namespace runs out of room. Changes to
+// the directory are made holding a lock that is itself a SEM_UNDO semaphore, so a process that exits holding it
+// releases it. The shared memory and the sets are removed by the last process to close the namespace.
+
+struct NamespaceDirectory;
+class NamedSemaphore;
+
+class SemaphoreNamespace {
+  std::shared_ptr<NamespaceDirectory> directory;
+
+  SemaphoreNamespace(std::shared_ptr<NamespaceDirectory> d) : directory(d){};
+  NamedSemaphore *lookup(const std::string &name, int value, int flags);
+
+public:
+  // capacity is the most names the namespace can hold
+  static SemaphoreNamespace *createExclusive(Token &key, int mode, unsigned capacity);
+  static SemaphoreNamespace *create(Token &key, int mode, unsigned capacity);
+  static SemaphoreNamespace *open(Token &key);
+  static void unlink(Token &key);
+
+  // opens the named semaphore, first creating it with value if there is none
+  NamedSemaphore *createSemaphore(const std::string &name, int value);
+  NamedSemaphore *createSemaphoreExclusive(const std::string &name, int value);
+  NamedSemaphore *openSemaphore(const std::string &name);
+
+  unsigned capacity();
+  // the names in use, including any not yet reclaimed from processes that exited
+  unsigned used();
+  // the handles of the namespace's semaphores stay usable after it is closed
+  void close();
+
+  ~SemaphoreNamespace();
+};
+
+// A semaphore in a SemaphoreNamespace, with the operations of SemaphoreV.
+class NamedSemaphore {
+  std::shared_ptr<NamespaceDirectory> directory;
+  unsigned entry;
+  unsigned generation;
+  int semid;
+  unsigned short slot;
+
+  NamedSemaphore(std::shared_ptr<NamespaceDirectory> d, unsigned e, unsigned g, int s, unsigned short n)
+      : directory(d), entry(e), generation(g), semid(s), slot(n){};
+  friend class SemaphoreNamespace;
+
+public:
+  void wait();
+  void wait(unsigned value);
+  bool trywait();
+  bool trywait(unsigned value);
+  void post();
+  void post(unsigned value);
+  unsigned valueOf();
+  unsigned refs();
+  void close();
+
+  ~NamedSemaphore();
+};
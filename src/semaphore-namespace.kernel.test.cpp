@@ -0,0 +1,183 @@
+#include "semaphore-namespace.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <functional>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/shm.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <unistd.h>
+
+class SemaphoreNamespaceKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'n');
+  }
+
+  void TearDown() override {
+    if (key && shmget(**key, 0, 0) != -1) {
+      SemaphoreNamespace::unlink(*key);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  int expectError(std::function<void()> call) {
+    try {
+      call();
+    } catch (const std::system_error &e) {
+      return e.code().value();
+    }
+    ADD_FAILURE() << "Expected std::system_error";
+    return 0;
+  }
+};
+
+TEST_F(SemaphoreNamespaceKernelTest, NamesShareTheirSemaphoreBetweenHandles) {
+  SemaphoreNamespace *names = SemaphoreNamespace::createExclusive(*key, 0600, 100);
+
+  NamedSemaphore *jobs = names->createSemaphore("jobs", 2);
+  NamedSemaphore *same = names->openSemaphore("jobs");
+  NamedSemaphore *other = names->createSemaphore("other", 0);
+  EXPECT_EQ(jobs->refs(), 2u);
+  same->wait(2);
+  EXPECT_FALSE(jobs->trywait());
+  jobs->post();
+  EXPECT_EQ(same->valueOf(), 1u);
+  EXPECT_EQ(other->valueOf(), 0u);
+  EXPECT_EQ(names->used(), 2u);
+
+  delete other;
+  delete same;
+  delete jobs;
+  delete names;
+}
+
+TEST_F(SemaphoreNamespaceKernelTest, LookupsFailLikeSemget) {
+  SemaphoreNamespace *names = SemaphoreNamespace::createExclusive(*key, 0600, 10);
+  NamedSemaphore *jobs = names->createSemaphoreExclusive("jobs", 0);
+
+  EXPECT_EQ(expectError([&] { names->createSemaphoreExclusive("jobs", 0); }), EEXIST);
+  EXPECT_EQ(expectError([&] { names->openSemaphore("missing"); }), ENOENT);
+  EXPECT_EQ(expectError([&] { names->createSemaphore(std::string(64, 'x'), 0); }), ENAMETOOLONG);
+  EXPECT_EQ(expectError([&] { names->createSemaphore("", 0); }), EINVAL);
+
+  delete jobs;
+  delete names;
+}
+
+TEST_F(SemaphoreNamespaceKernelTest, TheLastCloseOfANameFreesItsSemaphores) {
+  SemaphoreNamespace *names = SemaphoreNamespace::createExclusive(*key, 0600, 2);
+  NamedSemaphore *a = names->createSemaphore("a", 5);
+  NamedSemaphore *b = names->createSemaphore("b", 0);
+
+  EXPECT_EQ(expectError([&] { names->createSemaphore("c", 0); }), ENOSPC);
+  delete a;
+  EXPECT_EQ(names->used(), 1u);
+  NamedSemaphore *c = names->createSemaphore("c", 0);
+  EXPECT_EQ(c->valueOf(), 0u);
+  EXPECT_EQ(expectError([&] { names->openSemaphore("a"); }), ENOENT);
+
+  delete c;
+  delete b;
+  EXPECT_EQ(names->used(), 0u);
+  delete names;
+}
+
+TEST_F(SemaphoreNamespaceKernelTest, NamesLeftByExitedProcessesAreReclaimedWhenFull) {
+  SemaphoreNamespace *names = SemaphoreNamespace::createExclusive(*key, 0600, 1);
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    SemaphoreNamespace *mine = SemaphoreNamespace::open(*key);
+    mine->createSemaphore("abandoned", 3);
+    _exit(0); // exiting without closing gives the handle back
+  }
+  int status;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  EXPECT_EQ(names->used(), 1u);
+  NamedSemaphore *fresh = names->createSemaphore("fresh", 1);
+  EXPECT_EQ(fresh->valueOf(), 1u);
+  EXPECT_EQ(names->used(), 1u);
+
+  delete fresh;
+  delete names;
+}
+
+TEST_F(SemaphoreNamespaceKernelTest, ProcessesFindTheSameName) {
+  SemaphoreNamespace *names = SemaphoreNamespace::create(*key, 0600, 1000);
+  NamedSemaphore *done = names->createSemaphore("done", 0);
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    SemaphoreNamespace *mine = SemaphoreNamespace::create(*key, 0600, 1000);
+    NamedSemaphore *theirs = mine->openSemaphore("done");
+    theirs->post(2);
+    // the post and the handle are undone when the process exits, so wait to be killed holding them
+    pause();
+    _exit(0);
+  }
+  done->wait(2);
+  EXPECT_EQ(done->refs(), 2u);
+  kill(pid, SIGKILL);
+  waitpid(pid, nullptr, 0);
+  EXPECT_EQ(done->refs(), 1u);
+
+  delete done;
+  delete names;
+}
+
+TEST_F(SemaphoreNamespaceKernelTest, TheLastCloseOfTheNamespaceRemovesIt) {
+  SemaphoreNamespace *names = SemaphoreNamespace::createExclusive(*key, 0600, 10);
+  NamedSemaphore *jobs = names->createSemaphore("jobs", 0);
+
+  names->close();
+  jobs->post();
+  EXPECT_EQ(jobs->valueOf(), 1u);
+  EXPECT_NE(shmget(**key, 0, 0), -1);
+  delete jobs;
+  EXPECT_EQ(shmget(**key, 0, 0), -1);
+
+  delete names;
+}
+
+TEST_F(SemaphoreNamespaceKernelTest, OpeningWhileTheLastHandleClosesNeverFindsTheSetsGone) {
+  auto cycle = [this] {
+    for (int i = 0; i < 500; i++) {
+      SemaphoreNamespace *names = SemaphoreNamespace::create(*key, 0600, 10);
+      NamedSemaphore *jobs = names->createSemaphore("jobs", 1);
+      jobs->wait();
+      jobs->post();
+      delete jobs;
+      delete names;
+    }
+  };
+
+  pid_t pid = fork();
+  ASSERT_NE(pid, -1);
+  if (pid == 0) {
+    try {
+      cycle();
+    } catch (...) {
+      _exit(1);
+    }
+    _exit(0);
+  }
+  EXPECT_NO_THROW(cycle());
+  int status;
+  waitpid(pid, &status, 0);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_EQ(shmget(**key, 0, 0), -1);
+}
@@ -0,0 +1,202 @@
+#include "semaphore-posix.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fcntl.h>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#define OPEN_ATTEMPTS 1000 // how long open waits for a concurrent createExclusive to make the reference count
+#define MAX_BACKOFF std::chrono::milliseconds(8) // the longest sleep of wait(value) while too few units are there
+
+static std::string name(key_t key) {
+  char name[32];
+  snprintf(name, sizeof(name), "/sysv-semaphore.%08x", (unsigned)key);
+  return name;
+}
+
+static std::string refsName(key_t key) { return name(key) + ".refs"; }
+
+SemaphoreP *SemaphoreP::createExclusive(Token &key, int mode, int value) {
+  mode &= 0777;
+  sem_t *sem = sem_open(name(*key).c_str(), O_CREAT | O_EXCL, mode, value);
+  if (sem == SEM_FAILED) {
+    throw std::system_error(errno, std::system_category(), "sem_open");
+  }
+  // a reference count left behind by a process that crashed is stale now that the semaphore is new
+  sem_unlink(refsName(*key).c_str());
+  sem_t *references = sem_open(refsName(*key).c_str(), O_CREAT | O_EXCL, mode, 0);
+  if (references == SEM_FAILED) {
+    const int error = errno;
+    sem_close(sem);
+    sem_unlink(name(*key).c_str());
+    throw std::system_error(error, std::system_category(), "sem_open");
+  }
+  return new SemaphoreP(sem, references, *key);
+}
+
+SemaphoreP *SemaphoreP::create(Token &key, int mode, int value) {
+  do {
+    try {
+      return createExclusive(key, mode, value);
+    } catch (std::system_error &e) {
+      if (e.code().value() != EEXIST) {
+        throw;
+      }
+    }
+    // the next open can fail if there is a race and another process/thread removed the semaphore
+    // if that happens, go around again and attempt to create it
+    try {
+      return open(key);
+    } catch (std::system_error &e) {
+      if (e.code().value() != ENOENT) {
+        throw;
+      }
+    }
+  } while (true);
+}
+
+SemaphoreP *SemaphoreP::open(Token &key) {
+  sem_t *sem = sem_open(name(*key).c_str(), 0);
+  if (sem == SEM_FAILED) {
+    throw std::system_error(errno, std::system_category(), "sem_open");
+  }
+  // createExclusive makes the reference count just after the semaphore, so it may not be there yet
+  sem_t *references = SEM_FAILED;
+  for (int attempt = 0; attempt < OPEN_ATTEMPTS && references == SEM_FAILED; attempt++) {
+    references = sem_open(refsName(*key).c_str(), 0);
+    if (references == SEM_FAILED && errno != ENOENT) {
+      break;
+    }
+    std::this_thread::yield();
+  }
+  if (references == SEM_FAILED) {
+    const int error = errno;
+    sem_close(sem);
+    throw std::system_error(error, std::system_category(), "sem_open");
+  }
+  if (sem_post(references) == -1) {
+    const int error = errno;
+    sem_close(sem);
+    sem_close(references);
+    throw std::system_error(error, std::system_category(), "sem_post");
+  }
+  return new SemaphoreP(sem, references, *key);
+}
+
+void SemaphoreP::unlink(Token &key) {
+  if (sem_unlink(name(*key).c_str()) == -1) {
+    throw std::system_error(errno, std::system_category(), "sem_unlink");
+  }
+  sem_unlink(refsName(*key).c_str());
+}
+
+// macOS declares sem_getvalue but does not implement it, so the count and the references cannot be read there
+#ifdef __APPLE__
+unsigned SemaphoreP::valueOf() { throw std::system_error(ENOTSUP, std::system_category(), "sem_getvalue"); }
+
+unsigned SemaphoreP::refs() { throw std::system_error(ENOTSUP, std::system_category(), "sem_getvalue"); }
+#else
+unsigned SemaphoreP::valueOf() {
+  int value;
+  if (sem_getvalue(sem, &value) == -1) {
+    throw std::system_error(errno, std::system_category(), "sem_getvalue");
+  }
+  // glibc reports waiters as a negative value on some platforms
+  return value < 0 ? 0 : value;
+}
+
+// the count holds one less than the open handles, so the last close is the one that finds it at zero; the handle
+// asking is open, so it is added back to count the creator's as SemaphoreV does
+unsigned SemaphoreP::refs() {
+  int value;
+  if (sem_getvalue(references, &value) == -1) {
+    throw std::system_error(errno, std::system_category(), "sem_getvalue");
+  }
+  return (value < 0 ? 0 : value) + 1;
+}
+#endif
+
+void SemaphoreP::wait() { wait(1); }
+
+// blocks for one unit, so an empty semaphore is slept on rather than polled, then takes the rest with trywait, which
+// puts back a partial take. When the rest is not there the unit is given back too, so no waiter blocks holding units
+// another waiter needs, and the wait backs off before trying again
+void SemaphoreP::wait(unsigned value) {
+  std::chrono::microseconds backoff(100);
+  while (!trywait(value)) {
+    while (sem_wait(sem) == -1) {
+      if (errno != EINTR) {
+        throw std::system_error(errno, std::system_category(), "sem_wait");
+      }
+    }
+    if (trywait(value - 1)) {
+      return;
+    }
+    post(1);
+    std::this_thread::sleep_for(backoff);
+    backoff = std::min<std::chrono::microseconds>(backoff * 2, MAX_BACKOFF);
+  }
+}
+
+bool SemaphoreP::trywait() { return trywait(1); }
+
+bool SemaphoreP::trywait(unsigned value) {
+  unsigned taken = 0;
+  while (taken < value) {
+    if (sem_trywait(sem) == 0) {
+      taken++;
+    } else if (errno == EAGAIN) {
+      post(taken);
+      return false;
+    } else if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "sem_trywait");
+    }
+  }
+  return true;
+}
+
+void SemaphoreP::post() { post(1); }
+
+void SemaphoreP::post(unsigned value) {
+  for (unsigned posted = 0; posted < value; posted++) {
+    if (sem_post(sem) == -1) {
+      throw std::system_error(errno, std::system_category(), "sem_post");
+    }
+  }
+}
+
+void SemaphoreP::close() {
+  if (!sem) {
+    throw std::system_error(EINVAL, std::system_category(), "sem_close");
+  }
+  while (sem_trywait(references) == -1) {
+    if (errno == EAGAIN) { // indicates the reference count is 0
+      if (sem_unlink(name(key).c_str()) == -1 && errno != ENOENT) {
+        throw std::system_error(errno, std::system_category(), "sem_unlink");
+      }
+      sem_unlink(refsName(key).c_str());
+      break;
+    } else if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "sem_trywait");
+    }
+  }
+  sem_close(sem);
+  sem_close(references);
+  sem = nullptr;
+  references = nullptr;
+}
+
+SemaphoreP::~SemaphoreP() {
+  if (!sem) {
+    return;
+  }
+  try {
+    close();
+  } catch (...) {
+    // Destructor should never throw - silently ignore cleanup errors
+  }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "token.h"
+
+#include <semaphore.h>
+
+// A semaphore on a POSIX named semaphore, with the same create/open/unlink/refs semantics as SemaphoreV. The name is
+// derived from the token's key, and the references are counted by a second named semaphore alongside it. On Linux the
+// semaphores live in /dev/shm and uncontended operations are made without a syscall.
+//
+// There is no SEM_UNDO: units and references held by a process that exits without posting or closing are not given
+// back, so this suits semaphores that do not need crash rollback. Operations on more than one unit take one unit at a
+// time, but a partial take is put back rather than held while blocked, so wait(n) cannot deadlock with another waiter.
+//
+// macOS does not implement sem_getvalue, so valueOf() and refs() throw ENOTSUP there.
+
+class SemaphoreP {
+  sem_t *sem;
+  sem_t *references;
+  key_t key;
+
+  SemaphoreP(sem_t *s, sem_t *r, key_t k) : sem(s), references(r), key(k){};
+
+public:
+  static SemaphoreP *createExclusive(Token &key, int mode, int value);
+  static SemaphoreP *create(Token &key, int mode, int value);
+  static SemaphoreP *open(Token &key);
+  static void unlink(Token &key);
+
+  void wait();
+  void wait(unsigned value);
+  bool trywait();
+  bool trywait(unsigned value);
+  void post();
+  void post(unsigned value);
+  unsigned valueOf();
+  // the handles open on the semaphore, the creator's included
+  unsigned refs();
+  void close();
+
+  ~SemaphoreP();
+};
@@ -0,0 +1,166 @@
+#include "semaphore-posix.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+class SemaphorePKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'p');
+  }
+
+  // remove both names, even if the test failed part way through
+  void TearDown() override {
+    try {
+      SemaphoreP::unlink(*key);
+    } catch (std::system_error &) {
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  bool exists() {
+    char name[32];
+    snprintf(name, sizeof(name), "/sysv-semaphore.%08x", (unsigned)**key);
+    sem_t *sem = sem_open(name, 0);
+    if (sem == SEM_FAILED) {
+      return false;
+    }
+    sem_close(sem);
+    return true;
+  }
+};
+
+TEST_F(SemaphorePKernelTest, CreateExclusiveFailsIfItExists) {
+  SemaphoreP *sem = SemaphoreP::createExclusive(*key, 0600, 1);
+  try {
+    SemaphoreP::createExclusive(*key, 0600, 1);
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EEXIST);
+  }
+  delete sem;
+}
+
+TEST_F(SemaphorePKernelTest, OpenFailsIfItDoesNotExist) {
+  try {
+    SemaphoreP::open(*key);
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), ENOENT);
+  }
+}
+
+TEST_F(SemaphorePKernelTest, LastCloseRemovesIt) {
+  SemaphoreP *creator = SemaphoreP::create(*key, 0600, 1);
+  SemaphoreP *opener = SemaphoreP::create(*key, 0600, 1);
+  EXPECT_EQ(opener->refs(), 2u);
+  EXPECT_EQ(opener->valueOf(), 1u); // the value is only set by the creator
+
+  opener->close();
+  EXPECT_TRUE(exists());
+  creator->close();
+  EXPECT_FALSE(exists());
+
+  delete opener;
+  delete creator;
+}
+
+TEST_F(SemaphorePKernelTest, CountsUnits) {
+  SemaphoreP *sem = SemaphoreP::createExclusive(*key, 0600, 2);
+
+  EXPECT_TRUE(sem->trywait());
+  EXPECT_FALSE(sem->trywait(2));
+  EXPECT_EQ(sem->valueOf(), 1u); // the unit taken before failing is put back
+
+  sem->post(4);
+  EXPECT_TRUE(sem->trywait(5));
+  EXPECT_FALSE(sem->trywait());
+
+  delete sem;
+}
+
+TEST_F(SemaphorePKernelTest, WaitBlocksUntilPost) {
+  SemaphoreP *sem = SemaphoreP::createExclusive(*key, 0600, 0);
+  std::atomic<bool> acquired(false);
+
+  std::thread waiter([&] {
+    sem->wait(2);
+    acquired = true;
+  });
+  sem->post();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(acquired);
+  sem->post();
+  waiter.join();
+  EXPECT_TRUE(acquired);
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST_F(SemaphorePKernelTest, WaitersForSeveralUnitsDoNotDeadlock) {
+  SemaphoreP *sem = SemaphoreP::createExclusive(*key, 0600, 2);
+  std::atomic<int> done(0);
+
+  auto worker = [&] {
+    for (int i = 0; i < 500; i++) {
+      sem->wait(2);
+      sem->post(2);
+    }
+    done++;
+  };
+  std::thread first(worker);
+  std::thread second(worker);
+  for (int waited = 0; done < 2 && waited < 10000; waited++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(done, 2);
+  if (done < 2) {
+    sem->post(4); // lets a deadlocked pair finish, so the threads can be joined
+  }
+  first.join();
+  second.join();
+
+  delete sem;
+}
+
+TEST_F(SemaphorePKernelTest, IsSharedBetweenProcesses) {
+  SemaphoreP *sem = SemaphoreP::createExclusive(*key, 0600, 0);
+
+  pid_t child = fork();
+  if (child == 0) {
+    int status = 1;
+    try {
+      SemaphoreP *other = SemaphoreP::open(*key);
+      other->post(3);
+      delete other;
+      status = 0;
+    } catch (...) {
+    }
+    _exit(status);
+  }
+  int status;
+  waitpid(child, &status, 0);
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+  EXPECT_EQ(sem->valueOf(), 3u);
+  EXPECT_EQ(sem->refs(), 1u);
+  EXPECT_TRUE(exists());
+
+  delete sem;
+}
@@ -0,0 +1,255 @@
+#include "semaphore-set.h"
+#include "semop-timed.h"
+
+#include <cerrno>
+#include <chrono>
+#include <system_error>
+#include <thread>
+
+#ifdef _SEM_SEMUN_UNDEFINED
+union semun {
+  int val;               /* Value for SETVAL */
+  struct semid_ds *buf;  /* Buffer for IPC_STAT, IPC_SET */
+  unsigned short *array; /* Array for GETALL, SETALL */
+  struct seminfo *__buf; /* Buffer for IPC_INFO (Linux-specific) */
+};
+#endif
+
+// the last close holds the reference count at SEMVMX while it removes the set, as SemaphoreV::reap does
+#define CLAIM 32767
+#define CLAIM_ATTEMPTS 100 // how many milliseconds adding a reference waits for SemaphoreV::reap to let the set go
+
+static void addReference(int semid, int nsems) {
+  struct sembuf op;
+  op.sem_num = nsems;
+  op.sem_op = 1;
+  op.sem_flg = SEM_UNDO;
+  int attempt = 0;
+  while (semop(semid, &op, 1) == -1) {
+    if (errno == EINVAL) {
+      // the set was removed after semget found it
+      throw std::system_error(EIDRM, std::system_category(), "semop");
+    }
+    if (errno == ERANGE && ++attempt < CLAIM_ATTEMPTS) {
+      // a reaper is removing a set with two slots, which have the layout of a SemaphoreV
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } else if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+}
+
+SemaphoreSet *SemaphoreSet::createExclusive(Token &key, int mode, int nsems, const int *values) {
+  mode &= 0777;
+  int semid = semget(*key, nsems + 1, mode | IPC_CREAT | IPC_EXCL);
+  if (semid == -1) {
+    throw std::system_error(errno, std::system_category(), "semget");
+  }
+  // set each slot on its own rather than with SETALL, so a reference added by an early open is not overwritten
+  for (int slot = 0; slot < nsems; slot++) {
+    if (!values[slot]) {
+      continue;
+    }
+    semun arg;
+    arg.val = values[slot];
+    if (semctl(semid, slot, SETVAL, arg) == -1) {
+      const int error = errno;
+      semctl(semid, 0, IPC_RMID);
+      throw std::system_error(error, std::system_category(), "semctl");
+    }
+  }
+  // the creator holds a SEM_UNDO reference like any other handle, so SemaphoreV::reap never takes a set in use for an
+  // orphaned one, whatever its slots hold
+  struct sembuf op = {(unsigned short)nsems, 1, SEM_UNDO};
+  while (semop(semid, &op, 1) == -1) {
+    if (errno != EINTR) {
+      const int error = errno;
+      semctl(semid, 0, IPC_RMID);
+      throw std::system_error(error, std::system_category(), "semop");
+    }
+  }
+  return new SemaphoreSet(semid, nsems);
+}
+
+SemaphoreSet *SemaphoreSet::create(Token &key, int mode, int nsems, const int *values) {
+  do {
+    try {
+      return createExclusive(key, mode, nsems, values);
+    } catch (std::system_error &e) {
+      if (e.code().value() != EEXIST) {
+        throw;
+      }
+    }
+    // the next open can fail if there is a race and another process/thread removed the set
+    // if that happens, go around again and attempt to create it
+    try {
+      return open(key, nsems);
+    } catch (std::system_error &e) {
+      if (e.code().value() != ENOENT && e.code().value() != EIDRM) {
+        throw;
+      }
+    }
+  } while (true);
+}
+
+// semget only checks that the set holds at least nsems + 1 semaphores, so a larger one would have its reference count
+// taken for a slot. The size it was created with is read back and a set of any other size refused
+SemaphoreSet *SemaphoreSet::open(Token &key, int nsems) {
+  int semid = semget(*key, nsems + 1, 0);
+  if (semid == -1) {
+    throw std::system_error(errno, std::system_category(), "semget");
+  }
+  struct semid_ds ds;
+  semun arg;
+  arg.buf = &ds;
+  if (semctl(semid, 0, IPC_STAT, arg) == -1) {
+    // the set was removed after semget found it
+    throw std::system_error(errno == EINVAL ? EIDRM : errno, std::system_category(), "semctl");
+  }
+  if (ds.sem_nsems != (unsigned long)nsems + 1) {
+    throw std::system_error(EINVAL, std::system_category(), "semget");
+  }
+  addReference(semid, nsems);
+  return new SemaphoreSet(semid, nsems);
+}
+
+void SemaphoreSet::unlink(Token &key) {
+  int semid = semget(*key, 0, 0);
+  if (semid == -1) {
+    throw std::system_error(errno, std::system_category(), "semget");
+  }
+  if (semctl(semid, 0, IPC_RMID) == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+}
+
+void SemaphoreSet::op(struct sembuf *ops, size_t count) {
+  while (semop(semid, ops, count) == -1) {
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+}
+
+bool SemaphoreSet::tryop(struct sembuf *ops, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    ops[i].sem_flg |= IPC_NOWAIT;
+  }
+  int result;
+  while ((result = semop(semid, ops, count)) == -1 && errno == EINTR) {
+  }
+  const int error = errno;
+  for (size_t i = 0; i < count; i++) {
+    ops[i].sem_flg &= ~IPC_NOWAIT;
+  }
+  if (result == -1 && error != EAGAIN) {
+    throw std::system_error(error, std::system_category(), "semop");
+  }
+  return result == 0;
+}
+
+bool SemaphoreSet::timedop(struct sembuf *ops, size_t count, unsigned milliseconds) {
+  if (semopTimed(semid, ops, count, milliseconds) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    throw std::system_error(errno, std::system_category(), "semtimedop");
+  }
+  return true;
+}
+
+unsigned SemaphoreSet::get(int slot) {
+  const int result = semctl(semid, slot, GETVAL);
+  if (result == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+  return result;
+}
+
+void SemaphoreSet::getAll(unsigned short *values) {
+  semun arg;
+  arg.array = values;
+  if (semctl(semid, 0, GETALL, arg) == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+}
+
+void SemaphoreSet::set(int slot, int value) {
+  semun arg;
+  arg.val = value;
+  if (semctl(semid, slot, SETVAL, arg) == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+}
+
+unsigned SemaphoreSet::waitingForZero(int slot) {
+  const int result = semctl(semid, slot, GETZCNT);
+  if (result == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+  return result;
+}
+
+unsigned SemaphoreSet::waitingToDecrement(int slot) {
+  const int result = semctl(semid, slot, GETNCNT);
+  if (result == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+  return result;
+}
+
+unsigned SemaphoreSet::refs() { return get(nsems); }
+
+int SemaphoreSet::size() { return nsems; }
+
+// false if the reference count did not allow the operations, retrying interrupted calls
+static bool tryReferenceOp(int semid, struct sembuf *ops, size_t nsops) {
+  while (semop(semid, ops, nsops) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+  return true;
+}
+
+// as SemaphoreV::close: a handle that is not the last gives its reference back in one semop that needs another to be
+// held, and the last gives it back and claims the count at 0 together before removing the set. A count already at 0
+// is a set made before creators held a reference
+void SemaphoreSet::close() {
+  const unsigned short count = nsems;
+  struct sembuf others[2] = {{count, -2, IPC_NOWAIT | SEM_UNDO}, {count, 1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf last[3] = {
+      {count, -1, IPC_NOWAIT | SEM_UNDO}, {count, 0, IPC_NOWAIT}, {count, CLAIM, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf unreferenced = {count, 0, IPC_NOWAIT};
+  bool claimed = false;
+  do {
+    if (tryReferenceOp(semid, others, 2)) {
+      semid = -1;
+      return;
+    }
+    claimed = tryReferenceOp(semid, last, 3);
+  } while (!claimed && !tryReferenceOp(semid, &unreferenced, 1));
+  if (semctl(semid, 0, IPC_RMID) == -1) {
+    const int error = errno;
+    if (claimed) {
+      struct sembuf release = {count, -CLAIM, IPC_NOWAIT | SEM_UNDO};
+      semop(semid, &release, 1);
+    }
+    throw std::system_error(error, std::system_category(), "semctl");
+  }
+  semid = -1;
+}
+
+SemaphoreSet::~SemaphoreSet() {
+  if (semid == -1) {
+    return;
+  }
+  try {
+    close();
+  } catch (...) {
+    // Destructor should never throw - silently ignore cleanup errors
+  }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "token.h"
+
+#include <cstddef>
+#include <sys/sem.h>
+
+// A System V set of nsems semaphores for the synchronisation primitives built on SemaphoreV's lifecycle: one more
+// semaphore after them counts the references, create and open add one, and the last close removes the set. Unlike
+// SemaphoreV the operations are whatever the primitive asks for, several at a time, made atomically by the kernel.
+//
+// The slots are numbered from 0 to nsems - 1. Operations on the reference count are SEM_UNDO, so a process that exits
+// without closing gives its reference back; the primitives choose SEM_UNDO for their own operations.
+
+class SemaphoreSet {
+  int semid;
+  int nsems;
+
+  SemaphoreSet(int s, int n) : semid(s), nsems(n){};
+
+public:
+  // values holds the initial value of each of the nsems slots
+  static SemaphoreSet *createExclusive(Token &key, int mode, int nsems, const int *values);
+  static SemaphoreSet *create(Token &key, int mode, int nsems, const int *values);
+  static SemaphoreSet *open(Token &key, int nsems);
+  static void unlink(Token &key);
+
+  // blocks until all of the operations can be made together
+  void op(struct sembuf *ops, size_t count);
+  // false, having made none of them, if the operations cannot all be made now
+  bool tryop(struct sembuf *ops, size_t count);
+  // false, having made none of them, if the operations cannot all be made within milliseconds
+  bool timedop(struct sembuf *ops, size_t count, unsigned milliseconds);
+  unsigned get(int slot);
+  // values receives every slot and then the reference count, read together
+  void getAll(unsigned short *values);
+  void set(int slot, int value);
+  // the number of processes and threads blocked until the slot is zero, and blocked decrementing it
+  unsigned waitingForZero(int slot);
+  unsigned waitingToDecrement(int slot);
+  unsigned refs();
+  int size();
+  void close();
+
+  ~SemaphoreSet();
+};
@@ -0,0 +1,367 @@
+#include "semaphore-sharded.h"
+#include "semaphore-limits.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <numeric>
+#include <sched.h>
+#include <system_error>
+#include <unistd.h>
+
+#define SHARD_MAX 32767u    // SEMVMX, the most a single semaphore can hold
+#define ATTEMPTS 4          // how many times an operation is planned again after losing a race
+#define SLICE_MS 10u        // how long a waiter blocks on its home shard before looking at the shards again
+#define REBALANCE_EVERY 64u // how many operations on a handle between levelling the shards
+
+// SEMOPM, or no limit where the platform does not report it
+static unsigned opsPerCall() {
+  const unsigned limit = semaphoreMaxOpsPerCall();
+  return limit ? limit : UINT_MAX;
+}
+
+// the shards and the reference count have to fit in one set, which semget would otherwise refuse only once asked
+static void checkShards(unsigned shards) {
+  const unsigned limit = semaphoreMaxSetSize();
+  if (shards == 0 || (limit && shards + 1 > limit)) {
+    throw std::system_error(EINVAL, std::system_category(), "semget");
+  }
+}
+
+// more than the shards can hold could never be waited for
+static void checkValue(unsigned shards, unsigned value) {
+  if (shards == 0 || value > shards * SHARD_MAX) {
+    throw std::system_error(EINVAL, std::system_category(), "semop");
+  }
+}
+
+// the shares of value for each shard when it is spread evenly
+static std::vector<int> evenly(unsigned shards, unsigned value) {
+  checkValue(shards, value);
+  std::vector<int> shares(shards, value / shards);
+  for (unsigned i = 0; i < value % shards; i++) {
+    shares[i]++;
+  }
+  return shares;
+}
+
+// spreads value over the shards with the most room when adding, or the most units when taking, a share at a time so
+// the shards stay level. Taking is one semop, so it uses no more shards than SEMOPM, and is empty if they do not hold
+// value; the caller has checked that the shards have room for value when adding
+static std::vector<struct sembuf> plan(const std::vector<unsigned short> &values, unsigned shards, unsigned value,
+                                       bool adding) {
+  std::vector<unsigned> order(shards);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](unsigned a, unsigned b) { return adding ? values[a] < values[b] : values[a] > values[b]; });
+  if (!adding) {
+    order.resize(std::min<size_t>(order.size(), opsPerCall()));
+  }
+  std::vector<unsigned> amounts(shards, 0);
+  auto limit = [&](unsigned shard) {
+    return adding ? SHARD_MAX - values[shard] - amounts[shard] : values[shard] - amounts[shard];
+  };
+  unsigned remaining = value;
+  while (remaining > 0) {
+    unsigned open = 0;
+    for (unsigned shard : order) {
+      open += limit(shard) > 0;
+    }
+    if (open == 0) {
+      break;
+    }
+    const unsigned share = std::max(1u, remaining / open);
+    for (unsigned shard : order) {
+      const unsigned amount = std::min({limit(shard), share, remaining});
+      amounts[shard] += amount;
+      remaining -= amount;
+      if (remaining == 0) {
+        break;
+      }
+    }
+  }
+  if (remaining > 0) {
+    return {};
+  }
+  std::vector<struct sembuf> ops;
+  for (unsigned shard = 0; shard < shards; shard++) {
+    if (amounts[shard] > 0) {
+      const short amount = amounts[shard];
+      ops.push_back({(unsigned short)shard, (short)(adding ? amount : -amount), 0});
+    }
+  }
+  return ops;
+}
+
+SemaphoreSharded *SemaphoreSharded::createExclusive(Token &key, int mode, unsigned shards, unsigned value) {
+  checkShards(shards);
+  std::vector<int> values = evenly(shards, value);
+  return new SemaphoreSharded(SemaphoreSet::createExclusive(key, mode, shards, values.data()));
+}
+
+SemaphoreSharded *SemaphoreSharded::create(Token &key, int mode, unsigned shards, unsigned value) {
+  checkShards(shards);
+  std::vector<int> values = evenly(shards, value);
+  return new SemaphoreSharded(SemaphoreSet::create(key, mode, shards, values.data()));
+}
+
+SemaphoreSharded *SemaphoreSharded::open(Token &key, unsigned shards) {
+  return new SemaphoreSharded(SemaphoreSet::open(key, shards));
+}
+
+void SemaphoreSharded::unlink(Token &key) { SemaphoreSet::unlink(key); }
+
+void SemaphoreSharded::snapshot(std::vector<unsigned short> &values) {
+  values.resize(set->size() + 1);
+  set->getAll(values.data());
+}
+
+// the CPU spreads the threads of one process too, and sched_getcpu() does not enter the kernel on Linux
+unsigned SemaphoreSharded::home() {
+  const unsigned shards = set->size();
+#ifdef __linux__
+  const int cpu = sched_getcpu();
+  if (cpu >= 0) {
+    return cpu % shards;
+  }
+#endif
+  return ((unsigned)getpid() * 2654435761u) % shards;
+}
+
+// a single operation, which the kernel makes holding the lock of that semaphore rather than of the set
+bool SemaphoreSharded::onHome(unsigned value, bool adding) {
+  if (value > SHARD_MAX) {
+    return false;
+  }
+  struct sembuf op = {(unsigned short)home(), (short)(adding ? (int)value : -(int)value), 0};
+  try {
+    return set->tryop(&op, 1);
+  } catch (std::system_error &e) {
+    if (e.code().value() != ERANGE) {
+      throw;
+    }
+    return false;
+  }
+}
+
+bool SemaphoreSharded::take(unsigned value) {
+  const unsigned shards = set->size();
+  std::vector<unsigned short> values;
+  for (int attempt = 0; attempt < ATTEMPTS; attempt++) {
+    snapshot(values);
+    if (std::accumulate(values.begin(), values.begin() + shards, 0u) < value) {
+      return false;
+    }
+    std::vector<struct sembuf> ops = plan(values, shards, value, false);
+    if (ops.empty()) {
+      return false;
+    }
+    if (set->tryop(ops.data(), ops.size())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// adding never blocks, but fails with ERANGE if a shard filled up after the snapshot. More shards than one semop can
+// change are added to a chunk at a time, and what is left after a chunk fails is planned again. A spread that still
+// fails takes back the chunks it had added before throwing, so a post that throws leaves the count as it was
+void SemaphoreSharded::spread(unsigned value) {
+  const unsigned shards = set->size();
+  const size_t chunk = opsPerCall();
+  std::vector<unsigned short> values;
+  std::vector<struct sembuf> posted;
+  for (int attempt = 0; attempt < ATTEMPTS; attempt++) {
+    snapshot(values);
+    if (shards * SHARD_MAX - std::accumulate(values.begin(), values.begin() + shards, 0u) < value) {
+      break;
+    }
+    std::vector<struct sembuf> ops = plan(values, shards, value, true);
+    size_t done = 0;
+    try {
+      for (; done < ops.size(); done += chunk) {
+        set->op(ops.data() + done, std::min(chunk, ops.size() - done));
+      }
+      return;
+    } catch (std::system_error &e) {
+      if (e.code().value() != ERANGE) {
+        throw;
+      }
+    }
+    for (size_t i = 0; i < done; i++) {
+      value -= ops[i].sem_op;
+      posted.push_back(ops[i]);
+    }
+  }
+  unspread(posted);
+  throw std::system_error(ERANGE, std::system_category(), "semop");
+}
+
+// takes back what a failed spread had added, from the shards it added to where they still hold it. Units a consumer
+// has taken since are taken from the other shards instead, and are left taken if no shard holds them any more
+void SemaphoreSharded::unspread(std::vector<struct sembuf> &posted) {
+  const size_t chunk = opsPerCall();
+  unsigned left = 0;
+  for (struct sembuf &op : posted) {
+    left += op.sem_op;
+    op.sem_op = -op.sem_op;
+  }
+  for (size_t done = 0; done < posted.size(); done += chunk) {
+    const size_t count = std::min(chunk, posted.size() - done);
+    if (set->tryop(posted.data() + done, count)) {
+      for (size_t i = done; i < done + count; i++) {
+        left += posted[i].sem_op;
+      }
+    }
+  }
+  if (left > 0) {
+    take(left);
+  }
+}
+
+// blocks for a unit on the home shard alone, for at most milliseconds, so the kernel never has a waiter asleep on
+// several semaphores, which would make every operation on the set take the lock of the whole set. A unit it wakes
+// for is the whole of a wait for one; otherwise it is given back and the caller plans the wait again
+bool SemaphoreSharded::nap(unsigned value, unsigned milliseconds) {
+  struct sembuf op = {(unsigned short)home(), -1, 0};
+  if (!set->timedop(&op, 1, milliseconds)) {
+    return false;
+  }
+  if (value == 1) {
+    return true;
+  }
+  if (!onHome(1, true)) {
+    spread(1);
+  }
+  return false;
+}
+
+// the operation has been made by now, so a levelling that fails is left to the next one rather than reported as if
+// the operation had failed
+void SemaphoreSharded::counted() {
+  if (++operations % REBALANCE_EVERY == 0) {
+    try {
+      rebalance();
+    } catch (std::system_error &) {
+    }
+  }
+}
+
+void SemaphoreSharded::wait() { wait(1); }
+
+void SemaphoreSharded::wait(unsigned value) {
+  if (value == 0) {
+    return;
+  }
+  if (!onHome(value, false)) {
+    checkValue(set->size(), value);
+    while (!take(value) && !nap(value, SLICE_MS)) {
+    }
+  }
+  counted();
+}
+
+bool SemaphoreSharded::trywait() { return trywait(1); }
+
+bool SemaphoreSharded::trywait(unsigned value) {
+  if (value == 0) {
+    return true;
+  }
+  if (!onHome(value, false) && !take(value)) {
+    return false;
+  }
+  counted();
+  return true;
+}
+
+bool SemaphoreSharded::timedwait(unsigned value, unsigned milliseconds) {
+  if (value == 0) {
+    return true;
+  }
+  if (!onHome(value, false)) {
+    checkValue(set->size(), value);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+    while (!take(value)) {
+      auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+      if (left.count() <= 0) {
+        return false;
+      }
+      if (nap(value, std::min<unsigned>(left.count(), SLICE_MS))) {
+        break;
+      }
+    }
+  }
+  counted();
+  return true;
+}
+
+void SemaphoreSharded::post() { post(1); }
+
+void SemaphoreSharded::post(unsigned value) {
+  if (value == 0) {
+    return;
+  }
+  if (!onHome(value, true)) {
+    spread(value);
+  }
+  counted();
+}
+
+// moves units from the shards above the level to those below it in pairs, so a semop of whole pairs leaves the count
+// alone however many SEMOPM splits them into. A failed semop only means another process changed the shards first, so
+// it is left to the next levelling
+void SemaphoreSharded::rebalance() {
+  const unsigned shards = set->size();
+  std::vector<unsigned short> values;
+  snapshot(values);
+  const auto range = std::minmax_element(values.begin(), values.begin() + shards);
+  if (*range.second - *range.first <= 1) {
+    return;
+  }
+  const unsigned total = std::accumulate(values.begin(), values.begin() + shards, 0u);
+  std::vector<int> needs(shards);
+  for (unsigned shard = 0; shard < shards; shard++) {
+    needs[shard] = (int)(total / shards + (shard < total % shards)) - values[shard];
+  }
+  std::vector<struct sembuf> ops;
+  for (unsigned from = 0, to = 0; from < shards && to < shards;) {
+    if (needs[from] >= 0) {
+      from++;
+    } else if (needs[to] <= 0) {
+      to++;
+    } else {
+      const int amount = std::min(-needs[from], needs[to]);
+      ops.push_back({(unsigned short)from, (short)-amount, 0});
+      ops.push_back({(unsigned short)to, (short)amount, 0});
+      needs[from] += amount;
+      needs[to] -= amount;
+    }
+  }
+  const size_t chunk = std::max<size_t>(2, std::min<size_t>(opsPerCall(), ops.size()) & ~(size_t)1);
+  for (size_t done = 0; done < ops.size(); done += chunk) {
+    try {
+      set->tryop(ops.data() + done, std::min(chunk, ops.size() - done));
+    } catch (std::system_error &e) {
+      if (e.code().value() != ERANGE) {
+        throw;
+      }
+    }
+  }
+}
+
+unsigned SemaphoreSharded::valueOf() {
+  std::vector<unsigned short> values;
+  snapshot(values);
+  return std::accumulate(values.begin(), values.end() - 1, 0u);
+}
+
+unsigned SemaphoreSharded::capacity() { return set->size() * SHARD_MAX; }
+
+unsigned SemaphoreSharded::shards() { return set->size(); }
+
+unsigned SemaphoreSharded::refs() { return set->refs(); }
+
+void SemaphoreSharded::close() { set->close(); }
+
+SemaphoreSharded::~SemaphoreSharded() { delete set; }
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "semaphore-set.h"
+#include "token.h"
+
+#include <atomic>
+#include <vector>
+
+// A counting semaphore shared between processes by its key whose count is spread over several slots of one set, so it
+// can hold more than the 32767 a single System V semaphore is limited to: up to 32767 for each shard.
+//
+// Each caller has a home shard, picked from the CPU it is running on or else from its pid. wait(value) and
+// post(value) first try a single operation on the home shard, which the kernel locks on its own rather than locking
+// the whole set, so callers on different CPUs do not contend. When the home shard cannot serve the call, the units
+// are stolen from or spread over the other shards in a single semop, planned from a snapshot of the shards: taken from
+// the fullest and added to the emptiest. When another process changes the shards between the snapshot and the semop,
+// it is planned again. Every so often a caller levels the shards, so units pile up on no one home shard.
+//
+// A waiter that cannot be satisfied blocks for a unit on its home shard alone for a few milliseconds and then looks at
+// the shards again, so units posted to other home shards cannot leave it stuck for longer than that. Blocking on one
+// semaphore rather than several keeps the kernel locking single semaphores rather than the whole set for everyone
+// else while it sleeps.
+//
+// The kernel limits one semop to SEMOPM operations and one set to SEMMSL semaphores. A set with more shards than
+// SEMOPM takes from, and waits on, no more than SEMOPM of them at once, and adds to and levels them a chunk at a time;
+// create() fails with EINVAL when the shards and the reference count do not fit in a set.
+//
+// There is no SEM_UNDO: the kernel limits each process's undo adjustment of a slot to 32767 as well, which a large
+// budget would exceed, so units held by a process that exits are not given back.
+
+class SemaphoreSharded {
+  SemaphoreSet *set;
+  // the operations on this handle since the shards were last levelled
+  std::atomic<unsigned> operations;
+
+  SemaphoreSharded(SemaphoreSet *s) : set(s), operations(0){};
+  void snapshot(std::vector<unsigned short> &values);
+  unsigned home();
+  bool onHome(unsigned value, bool adding);
+  bool take(unsigned value);
+  void spread(unsigned value);
+  void unspread(std::vector<struct sembuf> &posted);
+  bool nap(unsigned value, unsigned milliseconds);
+  void counted();
+
+public:
+  static SemaphoreSharded *createExclusive(Token &key, int mode, unsigned shards, unsigned value);
+  static SemaphoreSharded *create(Token &key, int mode, unsigned shards, unsigned value);
+  static SemaphoreSharded *open(Token &key, unsigned shards);
+  static void unlink(Token &key);
+
+  void wait();
+  void wait(unsigned value);
+  bool trywait();
+  bool trywait(unsigned value);
+  bool timedwait(unsigned value, unsigned milliseconds);
+  void post();
+  void post(unsigned value);
+  // the count over every shard
+  unsigned valueOf();
+  // the most the count can be
+  unsigned capacity();
+  unsigned shards();
+  // moves units between the shards to level them, which wait() and post() also do every so often
+  void rebalance();
+  unsigned refs();
+  void close();
+
+  ~SemaphoreSharded();
+};
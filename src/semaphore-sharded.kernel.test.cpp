@@ -0,0 +1,244 @@
+#include "semaphore-sharded.h"
+#include "semaphore-limits.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class SemaphoreShardedKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 's');
+  }
+
+  void TearDown() override {
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  // the value of each shard, read straight from the kernel
+  std::vector<int> shards(int count) {
+    int semid = semget(**key, 0, 0);
+    std::vector<int> values;
+    for (int i = 0; i < count; i++) {
+      values.push_back(semctl(semid, i, GETVAL));
+    }
+    return values;
+  }
+
+  void setShard(int shard, int value) {
+    int semid = semget(**key, 0, 0);
+    ASSERT_EQ(semctl(semid, shard, SETVAL, value), 0);
+  }
+};
+
+TEST_F(SemaphoreShardedKernelTest, HoldsMoreThanOneSemaphoreCan) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 64, 1000000);
+
+  EXPECT_EQ(sem->capacity(), 64u * 32767u);
+  EXPECT_EQ(sem->valueOf(), 1000000u);
+  sem->post(1000000);
+  EXPECT_EQ(sem->valueOf(), 2000000u);
+  sem->wait(1500000);
+  EXPECT_EQ(sem->valueOf(), 500000u);
+  EXPECT_TRUE(sem->trywait(500000));
+  EXPECT_FALSE(sem->trywait());
+  EXPECT_FALSE(sem->timedwait(1, 10));
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, KeepsTheShardsLevel) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 4, 0);
+
+  sem->post(40000);
+  EXPECT_EQ(shards(4), std::vector<int>({10000, 10000, 10000, 10000}));
+  sem->wait(10002);
+  std::vector<int> values = shards(4);
+  EXPECT_EQ(*std::max_element(values.begin(), values.end()) - *std::min_element(values.begin(), values.end()), 1);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, PostingPastCapacityFailsWithoutChangingTheCount) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 2, 65000);
+
+  try {
+    sem->post(1000);
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), ERANGE);
+  }
+  EXPECT_EQ(sem->valueOf(), 65000u);
+  sem->post(534);
+  EXPECT_EQ(sem->valueOf(), sem->capacity());
+  EXPECT_THROW(sem->wait(sem->capacity() + 1), std::system_error);
+  EXPECT_THROW(SemaphoreSharded::create(*key, 0600, 2, 70000), std::system_error);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, AWaiterIsReleasedByPostsToAnyShard) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 3, 0);
+  std::atomic<bool> released(false);
+
+  std::thread waiter([&] {
+    sem->wait(50000);
+    released = true;
+  });
+  sem->post(30000);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(released);
+  sem->post(30000);
+  waiter.join();
+  EXPECT_TRUE(released);
+  EXPECT_EQ(sem->valueOf(), 10000u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, ABlockedWaiterSleepsOnOneShard) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 4, 0);
+  std::thread waiter([&] { sem->wait(3); });
+
+  const int semid = semget(**key, 0, 0);
+  int most = 0;
+  for (int sample = 0; sample < 50; sample++) {
+    int sleeping = 0;
+    for (int shard = 0; shard < 4; shard++) {
+      sleeping += semctl(semid, shard, GETNCNT);
+    }
+    most = std::max(most, sleeping);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(most, 1);
+  sem->post(3);
+  waiter.join();
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, ProcessesShareTheCount) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 8, 0);
+  const int processes = 4;
+  std::vector<pid_t> pids;
+
+  for (int i = 0; i < processes; i++) {
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+      SemaphoreSharded *child = SemaphoreSharded::open(*key, 8);
+      for (int j = 0; j < 100; j++) {
+        child->post(1000);
+        child->wait(500);
+      }
+      delete child;
+      _exit(0);
+    }
+    pids.push_back(pid);
+  }
+  for (pid_t pid : pids) {
+    int status;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+  EXPECT_EQ(sem->valueOf(), processes * 100u * 500u);
+  EXPECT_EQ(sem->refs(), 1u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, SmallOperationsStayOnTheHomeShard) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 4, 0);
+
+  sem->post(5);
+  std::vector<int> values = shards(4);
+  EXPECT_EQ(std::count(values.begin(), values.end(), 5), 1);
+  EXPECT_EQ(std::count(values.begin(), values.end(), 0), 3);
+  EXPECT_TRUE(sem->trywait(5));
+  EXPECT_EQ(shards(4), std::vector<int>({0, 0, 0, 0}));
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, AMissOnTheHomeShardStealsFromTheOthers) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 4, 0);
+
+  for (int shard = 0; shard < 4; shard++) {
+    setShard(shard, 3);
+  }
+  EXPECT_TRUE(sem->trywait(5));
+  EXPECT_EQ(sem->valueOf(), 7u);
+  EXPECT_TRUE(sem->timedwait(7, 10));
+  EXPECT_FALSE(sem->trywait());
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, TheShardsAreLevelledEverySoOften) {
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, 4, 0);
+
+  setShard(1, 1000);
+  sem->rebalance();
+  EXPECT_EQ(shards(4), std::vector<int>({250, 250, 250, 250}));
+
+  setShard(2, 1250);
+  for (int i = 0; i < 32; i++) {
+    sem->post();
+    sem->wait();
+  }
+  std::vector<int> values = shards(4);
+  EXPECT_LE(*std::max_element(values.begin(), values.end()) - *std::min_element(values.begin(), values.end()), 1);
+  EXPECT_EQ(sem->valueOf(), 2000u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, MoreShardsThanOneSemopCanChangeAreChunked) {
+  const unsigned count = semaphoreMaxOpsPerCall() + 100;
+  SemaphoreSharded *sem = SemaphoreSharded::createExclusive(*key, 0600, count, 0);
+
+  sem->post(2 * count);
+  EXPECT_EQ(sem->valueOf(), 2 * count);
+  sem->rebalance();
+  std::vector<int> values = shards(count);
+  EXPECT_EQ(*std::min_element(values.begin(), values.end()), 2);
+  EXPECT_EQ(*std::max_element(values.begin(), values.end()), 2);
+  EXPECT_TRUE(sem->trywait(2 * semaphoreMaxOpsPerCall()));
+  EXPECT_EQ(sem->valueOf(), 200u);
+  sem->rebalance();
+  values = shards(count);
+  EXPECT_EQ(*std::max_element(values.begin(), values.end()), 1);
+  EXPECT_EQ(sem->valueOf(), 200u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreShardedKernelTest, MoreShardsThanASetHoldsAreRefused) {
+  try {
+    SemaphoreSharded::createExclusive(*key, 0600, semaphoreMaxSetSize(), 0);
+    FAIL() << "expected EINVAL";
+  } catch (std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EINVAL);
+  }
+  EXPECT_EQ(semget(**key, 0, 0), -1);
+}
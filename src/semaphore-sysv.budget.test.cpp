@@ -0,0 +1,369 @@
+#include "mock/syscalls.h"
+#include "recursive-mutex.h"
+#include "semaphore-sysv.h"
+#include <cerrno>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <vector>
+
+// Pins the number of kernel calls made by each public API call. A change that adds a syscall to one of these paths
+// should fail here, and the budget should only be raised deliberately.
+
+class SyscallBudgetTest : public ::testing::Test {
+protected:
+  static constexpr int semid = 42;
+  static constexpr int semflg = 0777 | IPC_CREAT | IPC_EXCL;
+
+  struct sembuf ref_inc[1] = {{1, 1, SEM_UNDO}};
+  struct sembuf release_op[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf wait_op[1] = {{0, -1, SEM_UNDO}};
+  struct sembuf trywait_op[1] = {{0, -1, SEM_UNDO | IPC_NOWAIT}};
+  struct sembuf post_op[1] = {{0, 1, SEM_UNDO}};
+  struct sembuf zero_op[1] = {{0, 0, 0}};
+  struct sembuf tryzero_op[1] = {{0, 0, IPC_NOWAIT}};
+  struct sembuf available_op[2] = {{0, -2, 0}, {0, 2, 0}};
+  struct sembuf last_op[3] = {{1, -1, IPC_NOWAIT | SEM_UNDO}, {1, 0, IPC_NOWAIT}, {1, 32767, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf unreferenced_op[1] = {{1, 0, IPC_NOWAIT}};
+
+  void SetUp() override {
+    errno = 0;
+    mock_reset();
+  }
+
+  void TearDown() override {
+    EXPECT_EQ(mock_pending_calls(), 0u) << "queued calls were not made";
+    mock_reset();
+  }
+
+  void expectBudget(unsigned semget, unsigned semop, unsigned semctl, unsigned ftok, unsigned semtimedop = 0) {
+    EXPECT_EQ(mock_call_count(MOCK_SEMGET), semget) << "semget";
+    EXPECT_EQ(mock_call_count(MOCK_SEMOP), semop) << "semop";
+    EXPECT_EQ(mock_call_count(MOCK_SEMCTL), semctl) << "semctl";
+    EXPECT_EQ(mock_call_count(MOCK_FTOK), ftok) << "ftok";
+    EXPECT_EQ(mock_call_count(MOCK_SEMTIMEDOP), semtimedop) << "semtimedop";
+  }
+
+  void pushSemget(int return_value, int errno_value, int nsems, int flags) {
+    mock_push_expected_call({.syscall = MOCK_SEMGET,
+                             .return_value = return_value,
+                             .errno_value = errno_value,
+                             .args = {.semget = {.key = 1234, .nsems = nsems, .semflg = flags}}});
+  }
+
+  void pushSemop(int return_value, int errno_value, const struct sembuf *sops, size_t nsops = 1) {
+    mock_push_expected_call({.syscall = MOCK_SEMOP,
+                             .return_value = return_value,
+                             .errno_value = errno_value,
+                             .args = {.semop = {.semid = semid, .sops = sops, .nsops = nsops}}});
+  }
+
+  void pushSemctl(int return_value, int errno_value, int semnum, int cmd, int val = 0) {
+    mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                             .return_value = return_value,
+                             .errno_value = errno_value,
+                             .args = {.semctl = {.semid = semid, .semnum = semnum, .cmd = cmd, .arg = {.val = val}}}});
+  }
+
+  Token createToken() {
+    mock_push_expected_call({.syscall = MOCK_FTOK,
+                             .return_value = 1234,
+                             .errno_value = 0,
+                             .args = {.ftok_args = {.pathname = __FILE__, .proj_id = 42}}});
+    Token key(__FILE__, 42);
+    return key;
+  }
+
+  // an open semaphore with the counters reset, so each test only counts the call under test
+  SemaphoreV *openSemaphore() {
+    Token key = createToken();
+    pushSemget(semid, 0, 2, 0);
+    pushSemop(0, 0, ref_inc);
+    SemaphoreV *sem = SemaphoreV::open(key);
+    mock_reset();
+    return sem;
+  }
+};
+
+TEST_F(SyscallBudgetTest, Token) {
+  createToken();
+  expectBudget(0, 0, 0, 1);
+}
+
+TEST_F(SyscallBudgetTest, CreateExclusive) {
+  Token key = createToken();
+  pushSemget(semid, 0, 2, semflg);
+  pushSemctl(0, 0, 0, SETVAL, 1);
+  pushSemop(0, 0, ref_inc);
+
+  SemaphoreV::createExclusive(key, 0777, 1);
+  expectBudget(1, 1, 1, 1);
+}
+
+TEST_F(SyscallBudgetTest, CreateFastPath) {
+  Token key = createToken();
+  pushSemget(semid, 0, 2, semflg);
+  pushSemctl(0, 0, 0, SETVAL, 1);
+  pushSemop(0, 0, ref_inc);
+
+  SemaphoreV::create(key, 0777, 1);
+  expectBudget(1, 1, 1, 1);
+}
+
+TEST_F(SyscallBudgetTest, CreateExisting) {
+  Token key = createToken();
+  pushSemget(-1, EEXIST, 2, semflg);
+  pushSemget(semid, 0, 0, 0);
+  pushSemop(0, 0, ref_inc);
+
+  SemaphoreV::create(key, 0777, 1);
+  expectBudget(2, 1, 0, 1);
+}
+
+TEST_F(SyscallBudgetTest, CreateAfterRemovalRace) {
+  Token key = createToken();
+  pushSemget(-1, EEXIST, 2, semflg);
+  pushSemget(-1, ENOENT, 0, 0);
+  pushSemget(semid, 0, 2, semflg);
+  pushSemctl(0, 0, 0, SETVAL, 1);
+  pushSemop(0, 0, ref_inc);
+
+  SemaphoreV::create(key, 0777, 1);
+  expectBudget(3, 1, 1, 1);
+}
+
+TEST_F(SyscallBudgetTest, Open) {
+  Token key = createToken();
+  pushSemget(semid, 0, 2, 0);
+  pushSemop(0, 0, ref_inc);
+
+  SemaphoreV::open(key);
+  expectBudget(1, 1, 0, 1);
+}
+
+TEST_F(SyscallBudgetTest, Unlink) {
+  Token key = createToken();
+  pushSemget(semid, 0, 2, 0);
+  pushSemctl(0, 0, 0, IPC_RMID);
+
+  SemaphoreV::unlink(key);
+  expectBudget(1, 0, 1, 1);
+}
+
+TEST_F(SyscallBudgetTest, Wait) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(0, 0, wait_op);
+
+  sem->wait();
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, WaitInterrupted) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(-1, EINTR, wait_op);
+  pushSemop(0, 0, wait_op);
+
+  sem->wait();
+  expectBudget(0, 2, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, TryWait) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(0, 0, trywait_op);
+
+  EXPECT_TRUE(sem->trywait());
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, TryWaitWouldBlock) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(-1, EAGAIN, trywait_op);
+
+  EXPECT_FALSE(sem->trywait());
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, WaitZero) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(0, 0, zero_op);
+
+  sem->waitZero();
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, TryWaitZeroWouldBlock) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(-1, EAGAIN, tryzero_op);
+
+  EXPECT_FALSE(sem->tryWaitZero());
+  expectBudget(0, 1, 0, 0);
+}
+
+#ifdef __linux__
+TEST_F(SyscallBudgetTest, TimedWaitZero) {
+  SemaphoreV *sem = openSemaphore();
+  mock_push_expected_call({.syscall = MOCK_SEMTIMEDOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = semid, .sops = zero_op, .nsops = 1}}});
+
+  EXPECT_TRUE(sem->timedWaitZero(100));
+  expectBudget(0, 0, 0, 0, 1);
+}
+#endif
+
+TEST_F(SyscallBudgetTest, WaitAvailable) {
+  SemaphoreV *sem = openSemaphore();
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = semid, .sops = available_op, .nsops = 2}}});
+
+  sem->waitAvailable(2);
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, Drain) {
+  SemaphoreV *sem = openSemaphore();
+  struct sembuf drain_op[1] = {{0, -4, SEM_UNDO | IPC_NOWAIT}};
+  pushSemop(0, 0, drain_op);
+
+  EXPECT_EQ(sem->drain(4), 4u);
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, DrainFewerThanMax) {
+  SemaphoreV *sem = openSemaphore();
+  struct sembuf drain_op[1] = {{0, -4, SEM_UNDO | IPC_NOWAIT}};
+  struct sembuf rest_op[1] = {{0, -3, SEM_UNDO | IPC_NOWAIT}};
+  pushSemop(-1, EAGAIN, drain_op);
+  pushSemctl(3, 0, 0, GETVAL);
+  pushSemop(0, 0, rest_op);
+
+  EXPECT_EQ(sem->drain(4), 3u);
+  expectBudget(0, 2, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, DrainEmpty) {
+  SemaphoreV *sem = openSemaphore();
+  struct sembuf drain_op[1] = {{0, -4, SEM_UNDO | IPC_NOWAIT}};
+  pushSemop(-1, EAGAIN, drain_op);
+  pushSemctl(0, 0, 0, GETVAL);
+
+  EXPECT_EQ(sem->drain(4), 0u);
+  expectBudget(0, 1, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, Post) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(0, 0, post_op);
+
+  sem->post();
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, PostWaiters) {
+  SemaphoreV *sem = openSemaphore();
+  struct sembuf three_op[1] = {{0, 3, SEM_UNDO}};
+  pushSemctl(3, 0, 0, GETNCNT);
+  pushSemop(0, 0, three_op);
+
+  EXPECT_EQ(sem->postWaiters(), 3u);
+  expectBudget(0, 1, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, PostWaitersWithNoWaiters) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemctl(0, 0, 0, GETNCNT);
+
+  EXPECT_EQ(sem->postWaiters(), 0u);
+  expectBudget(0, 0, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, AcquireAny) {
+  std::vector<SemaphoreV *> semaphores = {openSemaphore(), openSemaphore(), openSemaphore()};
+  pushSemctl(0, 0, 0, GETVAL);
+  pushSemctl(4, 0, 0, GETVAL);
+  pushSemctl(1, 0, 0, GETVAL);
+  pushSemop(0, 0, trywait_op);
+
+  EXPECT_EQ(SemaphoreV::acquireAny(semaphores, 1), 1);
+  expectBudget(0, 1, 3, 0);
+}
+
+TEST_F(SyscallBudgetTest, ValueOf) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemctl(3, 0, 0, GETVAL);
+
+  EXPECT_EQ(sem->valueOf(), 3u);
+  expectBudget(0, 0, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, Refs) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemctl(1, 0, 1, GETVAL);
+
+  EXPECT_EQ(sem->refs(), 1u);
+  expectBudget(0, 0, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, CloseWithOtherReferences) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(0, 0, release_op, 2);
+
+  sem->close();
+  expectBudget(0, 1, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, CloseLastReference) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(-1, EAGAIN, release_op, 2);
+  pushSemop(0, 0, last_op, 3);
+  pushSemctl(0, 0, 0, IPC_RMID);
+
+  sem->close();
+  expectBudget(0, 2, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, CloseWithoutACreatorReference) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(-1, EAGAIN, release_op, 2);
+  pushSemop(-1, EAGAIN, last_op, 3);
+  pushSemop(0, 0, unreferenced_op);
+  pushSemctl(0, 0, 0, IPC_RMID);
+
+  sem->close();
+  expectBudget(0, 3, 1, 0);
+}
+
+TEST_F(SyscallBudgetTest, DeleteAfterClose) {
+  SemaphoreV *sem = openSemaphore();
+  pushSemop(0, 0, release_op, 2);
+  sem->close();
+  mock_reset();
+
+  delete sem;
+  expectBudget(0, 0, 0, 0);
+}
+
+TEST_F(SyscallBudgetTest, RecursiveMutexNesting) {
+  Token key = createToken();
+  pushSemget(semid, 0, 2, 0);
+  pushSemop(0, 0, ref_inc);
+  RecursiveMutex *mutex = RecursiveMutex::open(key);
+  mock_reset();
+  pushSemop(0, 0, wait_op);
+  pushSemop(0, 0, post_op);
+
+  mutex->lock();
+  mutex->lock();
+  EXPECT_TRUE(mutex->trylock());
+  mutex->unlock();
+  mutex->unlock();
+  mutex->unlock();
+  expectBudget(0, 2, 0, 0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,8 +1,17 @@
 #include "semaphore-sysv.h"
+#include "semop-timed.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <climits>
+#include <csignal>
+#include <ctime>
 #include <sys/sem.h>
 #include <system_error>
+#include <thread>
+#include <unistd.h>
 
 #ifdef _SEM_SEMUN_UNDEFINED
 union semun {
@@ -17,6 +26,52 @@ union semun {
 #define REF_COUNT 1
 #define SEMAPHORES 2
 
+// how many times drain() reads the value again after another process took units first
+#define DRAIN_ATTEMPTS 4
+// a reaper holds the reference count of a set it is removing at SEMVMX, so adding a reference fails with ERANGE
+#define CLAIM 32767
+#define CLAIM_ATTEMPTS 100 // how many milliseconds adding a reference waits for a reaper to let the set go
+
+// false if the set was removed after semget found it
+static bool addReference(int semid) {
+  struct sembuf op;
+  op.sem_num = REF_COUNT;
+  op.sem_op = 1;
+  op.sem_flg = SEM_UNDO;
+  int attempt = 0;
+  while (semop(semid, &op, 1) == -1) {
+    if (errno == EIDRM || errno == EINVAL) {
+      return false;
+    }
+    if (errno == ERANGE && ++attempt < CLAIM_ATTEMPTS) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } else if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+  return true;
+}
+
+// sets the initial value of a new set and takes the creator's reference, SEM_UNDO like any other so a creator that
+// exits without closing gives it back. The set is removed if either fails
+static void initialise(int semid, int value) {
+  semun arg;
+  arg.val = value;
+  if (semctl(semid, OPERATION_COUNTER, SETVAL, arg) == -1) {
+    const int error = errno;
+    semctl(semid, 0, IPC_RMID);
+    throw std::system_error(error, std::system_category(), "semctl");
+  }
+  struct sembuf op = {REF_COUNT, 1, SEM_UNDO};
+  while (semop(semid, &op, 1) == -1) {
+    if (errno != EINTR) {
+      const int error = errno;
+      semctl(semid, 0, IPC_RMID);
+      throw std::system_error(error, std::system_category(), "semop");
+    }
+  }
+}
+
 SemaphoreV *SemaphoreV::create(Token &key, int mode, int value) {
   int semid;
 
@@ -25,30 +80,19 @@ SemaphoreV *SemaphoreV::create(Token &key, int mode, int value) {
     // use IPC_CREAT to determine if the initial value should be set
     semid = semget(*key, SEMAPHORES, mode | IPC_CREAT | IPC_EXCL);
     if (semid != -1) {
-      // set the initial value
-      semun arg;
-      arg.val = value;
-      if (semctl(semid, OPERATION_COUNTER, SETVAL, arg) == -1) {
-        throw std::system_error(errno, std::system_category(), "semctl");
-      }
+      initialise(semid, value);
       return new SemaphoreV(semid);
     } else if (errno != EEXIST) {
       throw std::system_error(errno, std::system_category(), "semget");
     } else {
-      // the next call to semget can fail if there is a race and another process/thread removed the semaphore
-      // if that happens, go around again and attempt to create it
+      // the next call to semget can fail if there is a race and another process/thread removed the semaphore,
+      // or a reaper can remove it before the reference is added. If that happens, go around again and attempt to
+      // create it
       semid = semget(*key, 0, 0);
       if (semid != -1) {
-        struct sembuf op;
-        op.sem_num = REF_COUNT;
-        op.sem_op = 1;
-        op.sem_flg = SEM_UNDO;
-        while (semop(semid, &op, 1) == -1) {
-          if (errno != EINTR) {
-            throw std::system_error(errno, std::system_category(), "semop");
-          }
+        if (addReference(semid)) {
+          return new SemaphoreV(semid);
         }
-        return new SemaphoreV(semid);
       } else if (errno == ENOENT) {
         continue;
       } else {
@@ -65,13 +109,7 @@ SemaphoreV *SemaphoreV::createExclusive(Token &key, int mode, int value) {
   mode &= 0777;
   semid = semget(*key, SEMAPHORES, mode | IPC_CREAT | IPC_EXCL);
   if (semid != -1) {
-    // set the initial value
-    semun arg;
-    arg.val = value;
-    if (semctl(semid, OPERATION_COUNTER, SETVAL, arg) == -1) {
-      // might want to close the sem?
-      throw std::system_error(errno, std::system_category(), "semctl");
-    }
+    initialise(semid, value);
   } else {
     throw std::system_error(errno, std::system_category(), "semget");
   }
@@ -83,14 +121,8 @@ SemaphoreV *SemaphoreV::open(Token &key) {
   if (semid == -1) {
     throw std::system_error(errno, std::system_category(), "semget");
   }
-  struct sembuf op;
-  op.sem_num = REF_COUNT;
-  op.sem_op = 1;
-  op.sem_flg = SEM_UNDO;
-  while (semop(semid, &op, 1) == -1) {
-    if (errno != EINTR) {
-      throw std::system_error(errno, std::system_category(), "semop");
-    }
+  if (!addReference(semid)) {
+    throw std::system_error(EIDRM, std::system_category(), "semop");
   }
   return new SemaphoreV(semid);
 }
@@ -105,6 +137,105 @@ void SemaphoreV::unlink(Token &key) {
   }
 }
 
+// where acquireAny() starts looking, so semaphores with equal values take turns
+static std::atomic<unsigned> nextAny(0);
+
+// one GETVAL per semaphore finds the candidates, then each is tried with IPC_NOWAIT from the most available down, so
+// one emptied by another process since it was read only costs one more semop
+int SemaphoreV::acquireAny(const std::vector<SemaphoreV *> &semaphores, unsigned value) {
+  const size_t count = semaphores.size();
+  if (count == 0) {
+    return -1;
+  }
+  const unsigned start = nextAny.load(std::memory_order_relaxed);
+  std::vector<unsigned> values(count);
+  std::vector<size_t> candidates;
+  for (size_t i = 0; i < count; i++) {
+    const size_t index = (start + i) % count;
+    values[index] = semaphores[index]->valueOf();
+    if (values[index] >= value) {
+      candidates.push_back(index);
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(), [&](size_t a, size_t b) { return values[a] > values[b]; });
+  for (size_t index : candidates) {
+    if (semaphores[index]->trywait(value)) {
+      nextAny.store(index + 1, std::memory_order_relaxed);
+      return index;
+    }
+  }
+  return -1;
+}
+
+static bool alive(int pid) { return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM); }
+
+// an orphan has the layout of a SemaphoreV, no references and no waiters, was last operated on by processes that have
+// all exited, and has not been touched since cutoff. A creator holds a reference; in sets made before it did, its
+// SETVAL makes it the last process on the value until another process uses it
+static bool orphaned(int semid, long long cutoff) {
+  struct semid_ds ds;
+  semun arg;
+  arg.buf = &ds;
+  if (semctl(semid, 0, IPC_STAT, arg) == -1 || ds.sem_nsems != SEMAPHORES ||
+      std::max<long long>(ds.sem_otime, ds.sem_ctime) > cutoff) {
+    return false;
+  }
+  for (int slot = 0; slot < SEMAPHORES; slot++) {
+    if (semctl(semid, slot, GETNCNT) != 0 || semctl(semid, slot, GETZCNT) != 0 ||
+        alive(semctl(semid, slot, GETPID))) {
+      return false;
+    }
+  }
+  return semctl(semid, REF_COUNT, GETVAL) == 0;
+}
+
+// raises the reference count from 0 to CLAIM in one semop, so an open racing with the removal waits and then finds
+// the set gone rather than holding a removed one. The claim is undone if the reaper dies holding it
+static bool removeOrphan(int semid) {
+  struct sembuf claim[2] = {{REF_COUNT, 0, IPC_NOWAIT}, {REF_COUNT, CLAIM, IPC_NOWAIT | SEM_UNDO}};
+  if (semop(semid, claim, 2) == -1) {
+    return false; // opened or removed since it was checked
+  }
+  if (semctl(semid, OPERATION_COUNTER, GETNCNT) == 0 && semctl(semid, OPERATION_COUNTER, GETZCNT) == 0) {
+    return semctl(semid, 0, IPC_RMID) == 0;
+  }
+  // the creator of a set made before creators held a reference started waiting, so the set is in use after all
+  struct sembuf release = {REF_COUNT, -CLAIM, IPC_NOWAIT | SEM_UNDO};
+  if (semop(semid, &release, 1) == -1) {
+    // such a creator closed meanwhile, which would have removed the set
+    return semctl(semid, 0, IPC_RMID) == 0;
+  }
+  return false;
+}
+
+bool SemaphoreV::reap(Token &key, unsigned olderThanSeconds) {
+  const int semid = semget(*key, 0, 0);
+  if (semid == -1) {
+    return false;
+  }
+  return orphaned(semid, time(nullptr) - (long long)olderThanSeconds) && removeOrphan(semid);
+}
+
+unsigned SemaphoreV::reap(unsigned olderThanSeconds, unsigned firstKey, unsigned lastKey) {
+  const long long cutoff = time(nullptr) - (long long)olderThanSeconds;
+  unsigned reaped = 0;
+  for (const SemaphoreSetInfo &set : semaphoreList()) {
+    if (set.key == IPC_PRIVATE || (unsigned)set.key < firstKey || (unsigned)set.key > lastKey ||
+        set.nsems != SEMAPHORES || set.values.empty() || set.refs != 0 || set.waitingToDecrement != 0 ||
+        set.waitingForZero != 0) {
+      continue;
+    }
+    if (orphaned(set.id, cutoff) && removeOrphan(set.id)) {
+      reaped++;
+    }
+  }
+  return reaped;
+}
+
+SemaphoreLimits SemaphoreV::limits() { return semaphoreLimits(); }
+
+std::vector<SemaphoreSetInfo> SemaphoreV::list() { return semaphoreList(); }
+
 unsigned SemaphoreV::valueOf() {
   const int result = semctl(semid, OPERATION_COUNTER, GETVAL);
   if (result != -1) {
@@ -153,6 +284,20 @@ bool SemaphoreV::trywait(unsigned value) {
   return true;
 }
 
+bool SemaphoreV::timedwait(unsigned value, unsigned milliseconds) {
+  struct sembuf op;
+  op.sem_num = OPERATION_COUNTER;
+  op.sem_op = -value;
+  op.sem_flg = SEM_UNDO;
+  if (semopTimed(semid, &op, 1, milliseconds) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    throw std::system_error(errno, std::system_category(), "semtimedop");
+  }
+  return true;
+}
+
 void SemaphoreV::post() { post(1); }
 
 void SemaphoreV::post(unsigned value) {
@@ -167,22 +312,178 @@ void SemaphoreV::post(unsigned value) {
   }
 }
 
-void SemaphoreV::close() {
+// taking max with IPC_NOWAIT is one call when that many are there. Otherwise the value is read and that many taken,
+// and if another process takes units in between the value is read again, up to DRAIN_ATTEMPTS times so steady
+// producers and consumers cannot keep it spinning; a drain that loses every race returns 0
+unsigned SemaphoreV::drain(unsigned max) {
+  if (max == 0 || trywait(max)) {
+    return max;
+  }
+  for (int attempt = 0; attempt < DRAIN_ATTEMPTS; attempt++) {
+    const unsigned available = valueOf();
+    if (available == 0) {
+      return 0;
+    }
+    const unsigned value = available < max ? available : max;
+    if (trywait(value)) {
+      return value;
+    }
+  }
+  return 0;
+}
+
+unsigned SemaphoreV::postWaiters() { return postWaiters(UINT_MAX); }
+
+// GETNCNT counts the waiters but not how many units each asked for, so each is given one
+unsigned SemaphoreV::postWaiters(unsigned max) {
+  const int waiting = semctl(semid, OPERATION_COUNTER, GETNCNT);
+  if (waiting == -1) {
+    throw std::system_error(errno, std::system_category(), "semctl");
+  }
+  const unsigned value = (unsigned)waiting < max ? waiting : max;
+  if (value > 0) {
+    post(value);
+  }
+  return value;
+}
+
+void SemaphoreV::waitZero() {
   struct sembuf op;
-  op.sem_num = REF_COUNT;
-  op.sem_op = -1;
-  op.sem_flg = IPC_NOWAIT | SEM_UNDO;
+  op.sem_num = OPERATION_COUNTER;
+  op.sem_op = 0;
+  op.sem_flg = 0;
   while (semop(semid, &op, 1) == -1) {
-    if (errno == EAGAIN) { // indicates the REF_COUNT is 0
-      if (semctl(semid, 0, IPC_RMID) == -1) {
-        throw std::system_error(errno, std::system_category(), "semctl");
-      } else {
-        break;
-      }
-    } else if (errno != EINTR) {
+    if (errno != EINTR) {
       throw std::system_error(errno, std::system_category(), "semop");
     }
   }
+}
+
+bool SemaphoreV::tryWaitZero() {
+  struct sembuf op;
+  op.sem_num = OPERATION_COUNTER;
+  op.sem_op = 0;
+  op.sem_flg = IPC_NOWAIT;
+  while (semop(semid, &op, 1) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+  return true;
+}
+
+bool SemaphoreV::timedWaitZero(unsigned milliseconds) {
+  struct sembuf op;
+  op.sem_num = OPERATION_COUNTER;
+  op.sem_op = 0;
+  op.sem_flg = 0;
+  if (semopTimed(semid, &op, 1, milliseconds) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    throw std::system_error(errno, std::system_category(), "semtimedop");
+  }
+  return true;
+}
+
+// taking the units and giving them back in one semop, which succeeds only when both can be made, so the value is never
+// seen lowered. The pair is not SEM_UNDO, as it leaves nothing to undo
+static void availableOps(struct sembuf *ops, unsigned value, short flags) {
+  ops[0].sem_num = OPERATION_COUNTER;
+  ops[0].sem_op = -value;
+  ops[0].sem_flg = flags;
+  ops[1].sem_num = OPERATION_COUNTER;
+  ops[1].sem_op = value;
+  ops[1].sem_flg = flags;
+}
+
+void SemaphoreV::waitAvailable(unsigned value) {
+  // zero units are always available, and [-0, +0] would wait for zero instead
+  if (value == 0) {
+    return;
+  }
+  struct sembuf ops[2];
+  availableOps(ops, value, 0);
+  while (semop(semid, ops, 2) == -1) {
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+}
+
+bool SemaphoreV::tryWaitAvailable(unsigned value) {
+  if (value == 0) {
+    return true;
+  }
+  struct sembuf ops[2];
+  availableOps(ops, value, IPC_NOWAIT);
+  while (semop(semid, ops, 2) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+  return true;
+}
+
+bool SemaphoreV::timedWaitAvailable(unsigned value, unsigned milliseconds) {
+  if (value == 0) {
+    return true;
+  }
+  struct sembuf ops[2];
+  availableOps(ops, value, 0);
+  if (semopTimed(semid, ops, 2, milliseconds) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    throw std::system_error(errno, std::system_category(), "semtimedop");
+  }
+  return true;
+}
+
+// false if the reference count did not allow the operations, retrying interrupted calls
+static bool tryReferenceOp(int semid, struct sembuf *ops, size_t nsops) {
+  while (semop(semid, ops, nsops) == -1) {
+    if (errno == EAGAIN) {
+      return false;
+    }
+    if (errno != EINTR) {
+      throw std::system_error(errno, std::system_category(), "semop");
+    }
+  }
+  return true;
+}
+
+// a handle that is not the last gives its reference back in one semop that can only be made while another is held.
+// The last gives it back and claims the count at 0 in one semop, as the reaper does, so an open racing with the
+// removal waits and then finds the set gone. A count already at 0 is a set made before creators held a reference,
+// closed by its creator. An open between the attempts makes both fail, and they are made again
+void SemaphoreV::close() {
+  struct sembuf others[2] = {{REF_COUNT, -2, IPC_NOWAIT | SEM_UNDO}, {REF_COUNT, 1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf last[3] = {
+      {REF_COUNT, -1, IPC_NOWAIT | SEM_UNDO}, {REF_COUNT, 0, IPC_NOWAIT}, {REF_COUNT, CLAIM, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf unreferenced = {REF_COUNT, 0, IPC_NOWAIT};
+  bool claimed = false;
+  do {
+    if (tryReferenceOp(semid, others, 2)) {
+      semid = -1;
+      return;
+    }
+    claimed = tryReferenceOp(semid, last, 3);
+  } while (!claimed && !tryReferenceOp(semid, &unreferenced, 1));
+  if (semctl(semid, 0, IPC_RMID) == -1) {
+    const int error = errno;
+    if (claimed) {
+      struct sembuf release = {REF_COUNT, -CLAIM, IPC_NOWAIT | SEM_UNDO};
+      semop(semid, &release, 1);
+    }
+    throw std::system_error(error, std::system_category(), "semctl");
+  }
   semid = -1;
 }
 
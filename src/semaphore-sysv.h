@@ -1,5 +1,11 @@
+#pragma once
+
+#include "semaphore-limits.h"
+#include "semaphore-list.h"
 #include "token.h"
 
+#include <vector>
+
 class SemaphoreV {
   int semid;
 
@@ -10,15 +16,43 @@ public:
   static SemaphoreV *create(Token &key, int mode, int value);
   static SemaphoreV *open(Token &key);
   static void unlink(Token &key);
+  // takes value units from the semaphore with the most available, returning its index or -1 if none had them
+  static int acquireAny(const std::vector<SemaphoreV *> &semaphores, unsigned value);
+  // the kernel's limits on semaphores and the system-wide usage of them
+  static SemaphoreLimits limits();
+  // every semaphore set on the host, with its values, reference count and waiters
+  static std::vector<SemaphoreSetInfo> list();
+  // remove sets with this layout that no process holds or waits on and nobody has touched for olderThanSeconds, among
+  // the keys from firstKey to lastKey, returning how many were removed, or whether the one with this key was. Other
+  // sets of two semaphores can look the same, so a sweep is only made of keys the caller knows to be Semaphores
+  static unsigned reap(unsigned olderThanSeconds, unsigned firstKey, unsigned lastKey);
+  static bool reap(Token &key, unsigned olderThanSeconds);
 
   void wait();
   void wait(unsigned value);
   bool trywait();
   bool trywait(unsigned value);
+  bool timedwait(unsigned value, unsigned milliseconds);
   void post();
   void post(unsigned value);
+  // post one unit for each process or thread waiting to decrement now, at most max, and return how many were posted
+  unsigned postWaiters();
+  unsigned postWaiters(unsigned max);
+  // wait until the value is zero, without changing it
+  void waitZero();
+  bool tryWaitZero();
+  bool timedWaitZero(unsigned milliseconds);
+  // wait until at least value units are available, without taking them
+  void waitAvailable(unsigned value);
+  bool tryWaitAvailable(unsigned value);
+  bool timedWaitAvailable(unsigned value, unsigned milliseconds);
+  // take as many units as are available, up to max, without blocking, and return how many were taken; 0 if other
+  // consumers kept taking them first
+  unsigned drain(unsigned max);
   unsigned valueOf();
+  // the handles open on the set, the creator's included
   unsigned refs();
+  // the close that gives back the last reference removes the set
   void close();
 
   ~SemaphoreV();
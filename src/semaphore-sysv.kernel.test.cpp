@@ -0,0 +1,545 @@
+#include "semaphore-sysv.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <gtest/gtest.h>
+#include <sys/sem.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Runs SemaphoreV against real SysV IPC, without the syscall mock. Timing limits are deliberately loose floors that
+// only catch order of magnitude regressions, so they hold on loaded CI machines.
+
+static const std::chrono::milliseconds max_wake_latency(50);
+static const double min_ops_per_second = 10000;
+
+static long long monotonicNanoseconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+class SemaphoreVKernelTest : public ::testing::Test {
+protected:
+  char path[32] = "/tmp/semaphore-kernel-XXXXXX";
+  Token *key = nullptr;
+  std::vector<pid_t> children;
+  std::vector<int> private_sets;
+
+  void SetUp() override {
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1) << "mkstemp";
+    ::close(fd);
+    key = new Token(path, 'k');
+  }
+
+  // remove everything the test made, even if it failed part way through
+  void TearDown() override {
+    for (pid_t child : children) {
+      kill(child, SIGKILL);
+      waitpid(child, nullptr, 0);
+    }
+    int semid = key ? semget(**key, 0, 0) : -1;
+    if (semid != -1) {
+      semctl(semid, 0, IPC_RMID);
+    }
+    for (int set : private_sets) {
+      semctl(set, 0, IPC_RMID);
+    }
+    delete key;
+    ::unlink(path);
+  }
+
+  bool exists() { return semget(**key, 0, 0) != -1; }
+
+  // a scratch set that is removed in TearDown
+  int privateSet(int nsems) {
+    int semid = semget(IPC_PRIVATE, nsems, 0600);
+    if (semid != -1) {
+      private_sets.push_back(semid);
+    }
+    return semid;
+  }
+
+  // waits until count processes or threads are blocked decrementing the counter
+  bool waitForWaiters(int count) {
+    int semid = semget(**key, 0, 0);
+    for (int i = 0; i < 5000; i++) {
+      if (semctl(semid, 0, GETNCNT) >= count) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+  }
+
+  // runs body in a child process, which exits with 0 on success
+  pid_t fork(std::function<int()> body) {
+    pid_t pid = ::fork();
+    if (pid == 0) {
+      int status = 1;
+      try {
+        status = body();
+      } catch (...) {
+      }
+      _exit(status);
+    }
+    children.push_back(pid);
+    return pid;
+  }
+
+  int join(pid_t pid) {
+    int status;
+    waitpid(pid, &status, 0);
+    children.erase(std::find(children.begin(), children.end(), pid));
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  }
+};
+
+TEST_F(SemaphoreVKernelTest, LastCloseRemovesTheSet) {
+  SemaphoreV *first = SemaphoreV::createExclusive(*key, 0600, 1);
+  SemaphoreV *second = SemaphoreV::open(*key);
+  EXPECT_EQ(first->refs(), 2u);
+
+  second->close();
+  EXPECT_EQ(first->refs(), 1u);
+  EXPECT_TRUE(exists());
+
+  first->close();
+  EXPECT_FALSE(exists());
+
+  delete first;
+  delete second;
+}
+
+TEST_F(SemaphoreVKernelTest, CreateOpensAnExistingSet) {
+  SemaphoreV *first = SemaphoreV::create(*key, 0600, 3);
+  SemaphoreV *second = SemaphoreV::create(*key, 0600, 7);
+
+  EXPECT_EQ(second->valueOf(), 3u);
+  EXPECT_EQ(first->refs(), 2u);
+
+  delete second;
+  delete first;
+  EXPECT_FALSE(exists());
+}
+
+TEST_F(SemaphoreVKernelTest, ChildExitUndoesItsOperations) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 2);
+
+  pid_t child = fork([this] {
+    SemaphoreV *mine = SemaphoreV::open(*key);
+    mine->wait(2);
+    return mine->valueOf() == 0 ? 0 : 1; // exits holding both permits and a reference
+  });
+  EXPECT_EQ(join(child), 0);
+
+  EXPECT_EQ(sem->valueOf(), 2u);
+  EXPECT_EQ(sem->refs(), 1u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, TryWaitSeesPermitsHeldByAnotherProcess) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 1);
+  int ready[2];
+  int done[2];
+  ASSERT_EQ(pipe(ready), 0);
+  ASSERT_EQ(pipe(done), 0);
+
+  pid_t child = fork([&] {
+    SemaphoreV *mine = SemaphoreV::open(*key);
+    mine->wait();
+    char c = 0;
+    write(ready[1], &c, 1);
+    read(done[0], &c, 1);
+    mine->post();
+    return 0;
+  });
+
+  char c;
+  ASSERT_EQ(read(ready[0], &c, 1), 1);
+  EXPECT_FALSE(sem->trywait());
+  write(done[1], &c, 1);
+  EXPECT_EQ(join(child), 0);
+  EXPECT_TRUE(sem->trywait());
+
+  for (int fd : {ready[0], ready[1], done[0], done[1]}) {
+    ::close(fd);
+  }
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, ProcessWakeLatency) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 0);
+  int woken[2];
+  ASSERT_EQ(pipe(woken), 0);
+
+  pid_t child = fork([&] {
+    SemaphoreV *mine = SemaphoreV::open(*key);
+    mine->wait();
+    long long now = monotonicNanoseconds();
+    write(woken[1], &now, sizeof(now));
+    return 0;
+  });
+
+  ASSERT_TRUE(waitForWaiters(1));
+  long long posted = monotonicNanoseconds();
+  sem->post();
+
+  long long wakeup;
+  ASSERT_EQ(read(woken[0], &wakeup, sizeof(wakeup)), (ssize_t)sizeof(wakeup));
+  EXPECT_EQ(join(child), 0);
+
+  std::chrono::nanoseconds latency(wakeup - posted);
+  RecordProperty("wake_latency_ns", int(latency.count()));
+  EXPECT_LT(latency, max_wake_latency);
+
+  ::close(woken[0]);
+  ::close(woken[1]);
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, ThreadWakeLatency) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 0);
+  std::atomic<long long> wakeup(0);
+
+  std::thread waiter([&] {
+    sem->wait();
+    wakeup = monotonicNanoseconds();
+  });
+  ASSERT_TRUE(waitForWaiters(1));
+  long long posted = monotonicNanoseconds();
+  sem->post();
+  waiter.join();
+
+  std::chrono::nanoseconds latency(wakeup - posted);
+  RecordProperty("wake_latency_ns", int(latency.count()));
+  EXPECT_LT(latency, max_wake_latency);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, MutualExclusionAndThroughputAcrossThreads) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 1);
+  const int threads = 4;
+  const int iterations = 5000;
+  long counter = 0; // deliberately not atomic, the semaphore protects it
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&] {
+      for (int i = 0; i < iterations; i++) {
+        sem->wait();
+        counter++;
+        sem->post();
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  EXPECT_EQ(counter, long(threads * iterations));
+  EXPECT_EQ(sem->valueOf(), 1u);
+
+  double ops_per_second = threads * iterations * 2 / seconds;
+  RecordProperty("ops_per_second", int(ops_per_second));
+  EXPECT_GT(ops_per_second, min_ops_per_second);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, MutualExclusionAcrossProcesses) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 1);
+  const int processes = 4;
+  const int iterations = 2000;
+
+  // a second counter in a shared set stands in for shared memory, updated with a racy read-modify-write
+  int counter = privateSet(1);
+  ASSERT_NE(counter, -1);
+
+  std::vector<pid_t> pids;
+  for (int p = 0; p < processes; p++) {
+    pids.push_back(fork([&] {
+      SemaphoreV *mine = SemaphoreV::open(*key);
+      for (int i = 0; i < iterations; i++) {
+        mine->wait();
+        int value = semctl(counter, 0, GETVAL);
+        semctl(counter, 0, SETVAL, value + 1);
+        mine->post();
+      }
+      mine->close();
+      return 0;
+    }));
+  }
+  for (pid_t pid : pids) {
+    EXPECT_EQ(join(pid), 0);
+  }
+
+  EXPECT_EQ(semctl(counter, 0, GETVAL), processes * iterations);
+  EXPECT_EQ(sem->refs(), 1u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, WaitZeroBlocksUntilEveryUnitIsTaken) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 2);
+  std::atomic<bool> released(false);
+
+  EXPECT_FALSE(sem->tryWaitZero());
+  EXPECT_FALSE(sem->timedWaitZero(10));
+  std::thread waiter([&] {
+    sem->waitZero();
+    released = true;
+  });
+  sem->wait();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(released);
+  sem->wait();
+  waiter.join();
+  EXPECT_TRUE(released);
+  EXPECT_TRUE(sem->tryWaitZero());
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, WaitAvailableLeavesTheUnitsInPlace) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 1);
+  std::atomic<bool> released(false);
+
+  EXPECT_TRUE(sem->tryWaitAvailable(1));
+  EXPECT_FALSE(sem->tryWaitAvailable(2));
+  EXPECT_FALSE(sem->timedWaitAvailable(2, 10));
+  std::thread waiter([&] {
+    sem->waitAvailable(3);
+    released = true;
+  });
+  sem->post();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(released);
+  sem->post();
+  waiter.join();
+  EXPECT_TRUE(released);
+  EXPECT_EQ(sem->valueOf(), 3u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, DrainTakesWhatIsAvailableUpToTheLimit) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 5);
+
+  EXPECT_EQ(sem->drain(3), 3u);
+  EXPECT_EQ(sem->drain(3), 2u);
+  EXPECT_EQ(sem->drain(3), 0u);
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, PostWaitersReleasesExactlyTheCurrentWaiters) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 0);
+  std::vector<std::thread> waiters;
+
+  EXPECT_EQ(sem->postWaiters(), 0u);
+  for (int i = 0; i < 3; i++) {
+    waiters.emplace_back([&] { sem->wait(); });
+  }
+  ASSERT_TRUE(waitForWaiters(3));
+  EXPECT_EQ(sem->postWaiters(1), 1u);
+  EXPECT_EQ(sem->postWaiters(), 2u);
+  for (auto &waiter : waiters) {
+    waiter.join();
+  }
+  EXPECT_EQ(sem->valueOf(), 0u);
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, AcquireAnyTakesFromTheSemaphoreWithMostAvailable) {
+  Token other(path, 'o');
+  SemaphoreV *first = SemaphoreV::createExclusive(*key, 0600, 1);
+  SemaphoreV *second = SemaphoreV::createExclusive(other, 0600, 2);
+  std::vector<SemaphoreV *> semaphores = {first, second};
+
+  EXPECT_EQ(SemaphoreV::acquireAny(semaphores, 2), 1);
+  EXPECT_EQ(SemaphoreV::acquireAny(semaphores, 2), -1);
+  EXPECT_EQ(SemaphoreV::acquireAny(semaphores, 1), 0);
+  EXPECT_EQ(SemaphoreV::acquireAny(semaphores, 1), -1);
+  EXPECT_EQ(SemaphoreV::acquireAny({}, 1), -1);
+
+  delete second;
+  delete first;
+}
+
+TEST_F(SemaphoreVKernelTest, LimitsMatchTheKernelAndCountUsage) {
+  unsigned semmsl, semmns, semopm, semmni;
+  std::ifstream sem("/proc/sys/kernel/sem");
+  ASSERT_TRUE(sem >> semmsl >> semmns >> semopm >> semmni);
+  SemaphoreLimits before = SemaphoreV::limits();
+  EXPECT_EQ(before.maxSetSize, semmsl);
+  EXPECT_EQ(before.maxSemaphores, semmns);
+  EXPECT_EQ(before.maxOpsPerCall, semopm);
+  EXPECT_EQ(before.maxSets, semmni);
+  EXPECT_EQ(before.maxValue, 32767u);
+
+  SemaphoreV *created = SemaphoreV::createExclusive(*key, 0600, 0);
+  SemaphoreLimits after = SemaphoreV::limits();
+  EXPECT_EQ(after.setsInUse, before.setsInUse + 1);
+  EXPECT_EQ(after.semaphoresInUse, before.semaphoresInUse + 2);
+
+  delete created;
+}
+
+TEST_F(SemaphoreVKernelTest, ListShowsTheSetWithItsValuesAndWaiters) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 0);
+  SemaphoreV *opened = SemaphoreV::open(*key);
+  std::thread waiter([&] { sem->wait(); });
+  ASSERT_TRUE(waitForWaiters(1));
+
+  std::vector<SemaphoreSetInfo> sets = SemaphoreV::list();
+  auto found = std::find_if(sets.begin(), sets.end(), [&](const SemaphoreSetInfo &set) { return set.key == **key; });
+  ASSERT_NE(found, sets.end());
+  EXPECT_EQ(found->id, semget(**key, 0, 0));
+  EXPECT_EQ(found->owner, getuid());
+  EXPECT_EQ(found->mode, 0600u);
+  EXPECT_EQ(found->nsems, 2u);
+  EXPECT_EQ(found->values, std::vector<unsigned short>({0, 2}));
+  EXPECT_EQ(found->refs, 2u);
+  EXPECT_EQ(found->waitingToDecrement, 1u);
+  EXPECT_EQ(found->waitingForZero, 0u);
+  EXPECT_NE(found->ctime, 0);
+
+  sem->post();
+  waiter.join();
+  delete opened;
+  delete sem;
+  sets = SemaphoreV::list();
+  EXPECT_TRUE(std::none_of(sets.begin(), sets.end(), [&](const SemaphoreSetInfo &set) { return set.key == **key; }));
+}
+
+TEST_F(SemaphoreVKernelTest, ReapRemovesASetLeftByProcessesThatExited) {
+  pid_t child = fork([this] {
+    SemaphoreV::createExclusive(*key, 0600, 1);
+    SemaphoreV::open(*key);
+    return 0; // exits without closing either handle
+  });
+  ASSERT_EQ(join(child), 0);
+
+  EXPECT_FALSE(SemaphoreV::reap(*key, 3600));
+  EXPECT_NE(semget(**key, 0, 0), -1);
+  EXPECT_TRUE(SemaphoreV::reap(*key, 0));
+  EXPECT_EQ(semget(**key, 0, 0), -1);
+  EXPECT_EQ(errno, ENOENT);
+}
+
+TEST_F(SemaphoreVKernelTest, ReapSweepsOnlyTheKeysItIsGiven) {
+  ASSERT_EQ(join(fork([this] {
+              SemaphoreV::createExclusive(*key, 0600, 1);
+              return 0; // exits without closing, leaving no references
+            })),
+            0);
+  const unsigned mine = **key;
+
+  // the keys either side of this one, as a wider sweep would reap other tests' sets
+  SemaphoreV::reap(0, mine - 1, mine - 1);
+  SemaphoreV::reap(0, mine + 1, mine + 1);
+  EXPECT_EQ(SemaphoreV::reap(0, mine + 1, mine - 1), 0u);
+  EXPECT_TRUE(exists());
+  EXPECT_EQ(SemaphoreV::reap(0, mine, mine), 1u);
+  EXPECT_FALSE(exists());
+}
+
+TEST_F(SemaphoreVKernelTest, ReapLeavesASetWhoseCreatorIsAlive) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 1);
+
+  EXPECT_EQ(sem->refs(), 1u);
+  EXPECT_FALSE(SemaphoreV::reap(*key, 0));
+  EXPECT_TRUE(sem->trywait());
+  sem->post();
+
+  delete sem;
+}
+
+TEST_F(SemaphoreVKernelTest, ReapLeavesASetWhoseCreatorOutlivesTheOtherUsers) {
+  SemaphoreV *sem = SemaphoreV::createExclusive(*key, 0600, 1);
+
+  pid_t child = fork([this] {
+    SemaphoreV *mine = SemaphoreV::open(*key);
+    mine->wait();
+    mine->post();
+    mine->close();
+    delete mine;
+    return 0;
+  });
+  ASSERT_EQ(join(child), 0);
+
+  EXPECT_EQ(sem->refs(), 1u);
+  EXPECT_FALSE(SemaphoreV::reap(*key, 0));
+  EXPECT_TRUE(sem->trywait());
+  sem->post();
+
+  delete sem;
+  EXPECT_FALSE(exists());
+}
+
+TEST_F(SemaphoreVKernelTest, OpenWaitsForAReaperToLetGo) {
+  ASSERT_EQ(join(fork([this] {
+              SemaphoreV::createExclusive(*key, 0600, 0);
+              return 0; // exits without closing, leaving no references
+            })),
+            0);
+  int semid = semget(**key, 0, 0);
+  struct sembuf claim[2] = {{1, 0, IPC_NOWAIT}, {1, 32767, IPC_NOWAIT | SEM_UNDO}};
+  ASSERT_EQ(semop(semid, claim, 2), 0);
+
+  SemaphoreV *opened = nullptr;
+  std::thread opener([&] { opened = SemaphoreV::open(*key); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  struct sembuf release = {1, -32767, IPC_NOWAIT | SEM_UNDO};
+  ASSERT_EQ(semop(semid, &release, 1), 0);
+  opener.join();
+  ASSERT_NE(opened, nullptr);
+  EXPECT_EQ(opened->refs(), 1u);
+
+  delete opened;
+  EXPECT_FALSE(exists());
+}
+
+TEST_F(SemaphoreVKernelTest, CreateMakesANewSetWhenOneIsReapedUnderIt) {
+  ASSERT_EQ(join(fork([this] {
+              SemaphoreV::createExclusive(*key, 0600, 0);
+              return 0; // exits without closing, leaving no references
+            })),
+            0);
+  int semid = semget(**key, 0, 0);
+  struct sembuf claim[2] = {{1, 0, IPC_NOWAIT}, {1, 32767, IPC_NOWAIT | SEM_UNDO}};
+  ASSERT_EQ(semop(semid, claim, 2), 0);
+
+  SemaphoreV *created = nullptr;
+  std::thread creator([&] { created = SemaphoreV::create(*key, 0600, 3); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ASSERT_EQ(semctl(semid, 0, IPC_RMID), 0);
+  creator.join();
+  ASSERT_NE(created, nullptr);
+  EXPECT_NE(semget(**key, 0, 0), semid);
+  EXPECT_EQ(created->valueOf(), 3u);
+  EXPECT_EQ(created->refs(), 1u);
+
+  delete created;
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,10 +1,14 @@
 #include "semaphore-sysv.h"
 #include "mock/syscalls.h"
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
 #include <errnoname.c>
 #include <errnoname.h>
 #include <gtest/gtest.h>
 #include <sys/sem.h>
+#include <thread>
+#include <vector>
 
 class SemaphoreVTest : public ::testing::Test {
 protected:
@@ -25,19 +29,25 @@ protected:
     return key;
   }
 
-  SemaphoreV *createSemaphore() {
+  SemaphoreV *createSemaphore(int semid = 42) {
     Token key = createToken();
 
     mock_push_expected_call(
         {.syscall = MOCK_SEMGET,
-         .return_value = 42,
+         .return_value = semid,
          .errno_value = 0,
          .args = {.semget = {.key = key.valueOf(), .nsems = 2, .semflg = 0777 | IPC_CREAT | IPC_EXCL}}});
 
     mock_push_expected_call({.syscall = MOCK_SEMCTL,
                              .return_value = 0,
                              .errno_value = 0,
-                             .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
+                             .args = {.semctl = {.semid = semid, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
+
+    struct sembuf reference_sops[1] = {{1, 1, SEM_UNDO}};
+    mock_push_expected_call({.syscall = MOCK_SEMOP,
+                             .return_value = 0,
+                             .errno_value = 0,
+                             .args = {.semop = {.semid = semid, .sops = reference_sops, .nsops = 1}}});
 
     SemaphoreV *sem = SemaphoreV::createExclusive(key, 0xFFFFFFFF, 1);
     EXPECT_NE(sem, nullptr);
@@ -59,6 +69,12 @@ TEST_F(SemaphoreVTest, CreateExclusiveSucceeds) {
                            .errno_value = 0,
                            .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
 
+  struct sembuf reference_sops[1] = {{1, 1, SEM_UNDO}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = reference_sops, .nsops = 1}}});
+
   SemaphoreV *sem = SemaphoreV::createExclusive(key, 0xFFFFFFFF, 1);
   EXPECT_NE(sem, nullptr);
   EXPECT_EQ(errno, 0);
@@ -99,6 +115,11 @@ TEST_F(SemaphoreVTest, CreateExclusiveFailsOnSemctl) {
                            .errno_value = ERANGE,
                            .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
 
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = IPC_RMID}}});
+
   try {
     SemaphoreV::createExclusive(key, 0xFFFFFFFF, 1);
     FAIL() << "Expected std::system_error";
@@ -232,6 +253,12 @@ TEST_F(SemaphoreVTest, CreateSucceedsFirstTry) {
                            .errno_value = 0,
                            .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
 
+  struct sembuf reference_sops[1] = {{1, 1, SEM_UNDO}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = reference_sops, .nsops = 1}}});
+
   SemaphoreV *sem = SemaphoreV::create(key, 0xFFFFFFFF, 1);
   EXPECT_NE(sem, nullptr);
   EXPECT_EQ(errno, 0);
@@ -291,6 +318,12 @@ TEST_F(SemaphoreVTest, CreateSucceedsAfterRace) {
                            .errno_value = 0,
                            .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
 
+  struct sembuf reference_sops[1] = {{1, 1, SEM_UNDO}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = reference_sops, .nsops = 1}}});
+
   SemaphoreV *sem = SemaphoreV::create(key, 0xFFFFFFFF, 1);
   EXPECT_NE(sem, nullptr);
   EXPECT_EQ(errno, 0);
@@ -391,6 +424,11 @@ TEST_F(SemaphoreVTest, CreateFailsOnSemctlError) {
                            .errno_value = ERANGE,
                            .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
 
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = IPC_RMID}}});
+
   try {
     SemaphoreV::create(key, 0xFFFFFFFF, 1);
     FAIL() << "Expected std::system_error";
@@ -757,6 +795,295 @@ TEST_F(SemaphoreVTest, TryWaitFails) {
   mock_reset();
 }
 
+TEST_F(SemaphoreVTest, WaitZeroSucceedsAfterInterrupt) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[1] = {{0, 0, 0}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EINTR,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  sem->waitZero();
+  EXPECT_EQ(errno, 0);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, TryWaitZeroWouldBlock) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[1] = {{0, 0, IPC_NOWAIT}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  EXPECT_FALSE(sem->tryWaitZero());
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, TryWaitZeroFails) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[1] = {{0, 0, IPC_NOWAIT}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EIDRM,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  try {
+    sem->tryWaitZero();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EIDRM);
+  }
+
+  mock_reset();
+}
+
+#ifdef __linux__
+TEST_F(SemaphoreVTest, TimedWaitZeroTimesOut) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[1] = {{0, 0, 0}};
+  mock_push_expected_call({.syscall = MOCK_SEMTIMEDOP,
+                           .return_value = -1,
+                           .errno_value = EINTR,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  mock_push_expected_call({.syscall = MOCK_SEMTIMEDOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  EXPECT_FALSE(sem->timedWaitZero(10));
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, TimedWaitZeroSucceeds) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[1] = {{0, 0, 0}};
+  mock_push_expected_call({.syscall = MOCK_SEMTIMEDOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  EXPECT_TRUE(sem->timedWaitZero(10));
+
+  mock_reset();
+}
+#endif
+
+TEST_F(SemaphoreVTest, WaitAvailableTakesAndGivesBackInOneSemop) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[2] = {{0, -3, 0}, {0, 3, 0}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EINTR,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 2}}});
+
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 2}}});
+
+  sem->waitAvailable(3);
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, TryWaitAvailableWouldBlock) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[2] = {{0, -2, IPC_NOWAIT}, {0, 2, IPC_NOWAIT}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 2}}});
+
+  EXPECT_FALSE(sem->tryWaitAvailable(2));
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, WaitAvailableForNothingMakesNoCall) {
+  SemaphoreV *sem = createSemaphore();
+  const unsigned created = mock_call_count(MOCK_SEMOP);
+
+  sem->waitAvailable(0);
+  EXPECT_TRUE(sem->tryWaitAvailable(0));
+  EXPECT_TRUE(sem->timedWaitAvailable(0, 10));
+  EXPECT_EQ(mock_call_count(MOCK_SEMOP), created);
+
+  mock_reset();
+}
+
+#ifdef __linux__
+TEST_F(SemaphoreVTest, TimedWaitAvailableTimesOut) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[2] = {{0, -1, 0}, {0, 1, 0}};
+  mock_push_expected_call({.syscall = MOCK_SEMTIMEDOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 2}}});
+
+  EXPECT_FALSE(sem->timedWaitAvailable(1, 10));
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, TimedWaitTimesOut) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[1] = {{0, -2, SEM_UNDO}};
+  mock_push_expected_call({.syscall = MOCK_SEMTIMEDOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  EXPECT_FALSE(sem->timedwait(2, 10));
+
+  mock_reset();
+}
+#endif
+
+TEST_F(SemaphoreVTest, DrainRetriesAfterLosingARace) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf all_sops[1] = {{0, -5, SEM_UNDO | IPC_NOWAIT}};
+  struct sembuf lost_sops[1] = {{0, -3, SEM_UNDO | IPC_NOWAIT}};
+  struct sembuf taken_sops[1] = {{0, -2, SEM_UNDO | IPC_NOWAIT}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = all_sops, .nsops = 1}}});
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 3,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = GETVAL}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = lost_sops, .nsops = 1}}});
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 2,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = GETVAL}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = taken_sops, .nsops = 1}}});
+
+  EXPECT_EQ(sem->drain(5), 2u);
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, DrainGivesUpAfterRepeatedRaces) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf all_sops[1] = {{0, -3, SEM_UNDO | IPC_NOWAIT}};
+  struct sembuf one_sops[1] = {{0, -1, SEM_UNDO | IPC_NOWAIT}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = all_sops, .nsops = 1}}});
+  for (int i = 0; i < 4; i++) {
+    mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                             .return_value = 1,
+                             .errno_value = 0,
+                             .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = GETVAL}}});
+    mock_push_expected_call({.syscall = MOCK_SEMOP,
+                             .return_value = -1,
+                             .errno_value = EAGAIN,
+                             .args = {.semop = {.semid = 42, .sops = one_sops, .nsops = 1}}});
+  }
+
+  EXPECT_EQ(sem->drain(3), 0u);
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, PostWaitersPostsOnePerWaiterUpToTheCeiling) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf expected_sops[1] = {{0, 2, SEM_UNDO}};
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 5,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = GETNCNT}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+
+  EXPECT_EQ(sem->postWaiters(2), 2u);
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, PostWaitersFails) {
+  SemaphoreV *sem = createSemaphore();
+
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = -1,
+                           .errno_value = EIDRM,
+                           .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = GETNCNT}}});
+
+  try {
+    sem->postWaiters();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EIDRM);
+  }
+
+  mock_reset();
+}
+
+// the values are read in turn from wherever the previous call left off, so each set's calls go on its own queue
+TEST_F(SemaphoreVTest, AcquireAnyFallsBackWhenTheFirstChoiceIsTaken) {
+  std::vector<SemaphoreV *> semaphores = {createSemaphore(42), createSemaphore(43)};
+
+  struct sembuf expected_sops[1] = {{0, -2, SEM_UNDO | IPC_NOWAIT}};
+  mock_push_semid_call({.syscall = MOCK_SEMCTL,
+                        .return_value = 3,
+                        .errno_value = 0,
+                        .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = GETVAL}}});
+  mock_push_semid_call({.syscall = MOCK_SEMOP,
+                        .return_value = -1,
+                        .errno_value = EAGAIN,
+                        .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+  mock_push_semid_call({.syscall = MOCK_SEMCTL,
+                        .return_value = 2,
+                        .errno_value = 0,
+                        .args = {.semctl = {.semid = 43, .semnum = 0, .cmd = GETVAL}}});
+  mock_push_semid_call({.syscall = MOCK_SEMOP,
+                        .return_value = 0,
+                        .errno_value = 0,
+                        .args = {.semop = {.semid = 43, .sops = expected_sops, .nsops = 1}}});
+
+  EXPECT_EQ(SemaphoreV::acquireAny(semaphores, 2), 1);
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
 TEST_F(SemaphoreVTest, PostSucceeds) {
   SemaphoreV *sem = createSemaphore();
 
@@ -816,27 +1143,90 @@ TEST_F(SemaphoreVTest, PostSucceedsAfterInterrupts) {
 TEST_F(SemaphoreVTest, CloseSucceeds) {
   SemaphoreV *sem = createSemaphore();
 
-  struct sembuf expected_sops[1] = {{1, -1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
   mock_push_expected_call({.syscall = MOCK_SEMOP,
                            .return_value = 0,
                            .errno_value = 0,
-                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
 
   sem->close();
-  EXPECT_EQ(errno, 0);
+  EXPECT_EQ(mock_pending_calls(), 0u);
 
   mock_reset();
 }
 
-TEST_F(SemaphoreVTest, CloseWithEagainAndRmidSucceeds) {
+TEST_F(SemaphoreVTest, CloseOfTheLastReferenceClaimsAndRemovesTheSet) {
   SemaphoreV *sem = createSemaphore();
 
-  struct sembuf expected_sops[1] = {{1, -1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf last_sops[3] = {{1, -1, IPC_NOWAIT | SEM_UNDO}, {1, 0, IPC_NOWAIT}, {1, 32767, IPC_NOWAIT | SEM_UNDO}};
   mock_push_expected_call({.syscall = MOCK_SEMOP,
                            .return_value = -1,
                            .errno_value = EAGAIN,
-                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = last_sops, .nsops = 3}}});
+  mock_push_expected_call({.syscall = MOCK_SEMCTL,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = IPC_RMID}}});
 
+  sem->close();
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, CloseTriesAgainWhenAnOpenRacesIt) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf last_sops[3] = {{1, -1, IPC_NOWAIT | SEM_UNDO}, {1, 0, IPC_NOWAIT}, {1, 32767, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf unreferenced_sops[1] = {{1, 0, IPC_NOWAIT}};
+  // the count was 1 for the first attempt and 2 by the second
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = last_sops, .nsops = 3}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = unreferenced_sops, .nsops = 1}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
+
+  sem->close();
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, CloseWithEagainAndRmidSucceeds) {
+  SemaphoreV *sem = createSemaphore();
+
+  struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf last_sops[3] = {{1, -1, IPC_NOWAIT | SEM_UNDO}, {1, 0, IPC_NOWAIT}, {1, 32767, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf unreferenced_sops[1] = {{1, 0, IPC_NOWAIT}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = last_sops, .nsops = 3}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = unreferenced_sops, .nsops = 1}}});
   mock_push_expected_call({.syscall = MOCK_SEMCTL,
                            .return_value = 0,
                            .errno_value = 0,
@@ -851,12 +1241,21 @@ TEST_F(SemaphoreVTest, CloseWithEagainAndRmidSucceeds) {
 TEST_F(SemaphoreVTest, CloseWithEagainAndRmidFails) {
   SemaphoreV *sem = createSemaphore();
 
-  struct sembuf expected_sops[1] = {{1, -1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf last_sops[3] = {{1, -1, IPC_NOWAIT | SEM_UNDO}, {1, 0, IPC_NOWAIT}, {1, 32767, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf unreferenced_sops[1] = {{1, 0, IPC_NOWAIT}};
   mock_push_expected_call({.syscall = MOCK_SEMOP,
                            .return_value = -1,
                            .errno_value = EAGAIN,
-                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
-
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = -1,
+                           .errno_value = EAGAIN,
+                           .args = {.semop = {.semid = 42, .sops = last_sops, .nsops = 3}}});
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = unreferenced_sops, .nsops = 1}}});
   mock_push_expected_call({.syscall = MOCK_SEMCTL,
                            .return_value = -1,
                            .errno_value = EPERM,
@@ -875,25 +1274,25 @@ TEST_F(SemaphoreVTest, CloseWithEagainAndRmidFails) {
 TEST_F(SemaphoreVTest, CloseSucceedsAfterInterrupts) {
   SemaphoreV *sem = createSemaphore();
 
-  struct sembuf expected_sops[1] = {{1, -1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
 
   mock_push_expected_call({.syscall = MOCK_SEMOP,
                            .return_value = -1,
                            .errno_value = EINTR,
-                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
 
   mock_push_expected_call({.syscall = MOCK_SEMOP,
                            .return_value = -1,
                            .errno_value = EINTR,
-                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
 
   mock_push_expected_call({.syscall = MOCK_SEMOP,
                            .return_value = 0,
                            .errno_value = 0,
-                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
 
   sem->close();
-  EXPECT_EQ(errno, 0);
+  EXPECT_EQ(mock_pending_calls(), 0u);
 
   mock_reset();
 }
@@ -901,11 +1300,11 @@ TEST_F(SemaphoreVTest, CloseSucceedsAfterInterrupts) {
 TEST_F(SemaphoreVTest, CloseFails) {
   SemaphoreV *sem = createSemaphore();
 
-  struct sembuf expected_sops[1] = {{1, -1, IPC_NOWAIT | SEM_UNDO}};
+  struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
   mock_push_expected_call({.syscall = MOCK_SEMOP,
                            .return_value = -1,
                            .errno_value = ENOSPC,
-                           .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+                           .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
 
   try {
     sem->close();
@@ -932,17 +1331,23 @@ TEST_F(SemaphoreVTest, DestructorSwallowsCloseException) {
                            .errno_value = 0,
                            .args = {.semctl = {.semid = 42, .semnum = 0, .cmd = SETVAL, .arg = {.val = 1}}}});
 
+  struct sembuf reference_sops[1] = {{1, 1, SEM_UNDO}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = reference_sops, .nsops = 1}}});
+
   // Create a scope so we can control when destructor is called
   {
     SemaphoreV *sem = SemaphoreV::createExclusive(key, 0xFFFFFFFF, 1);
     EXPECT_NE(sem, nullptr);
 
     // Set up close() to fail with EBUSY
-    struct sembuf expected_sops[1] = {{1, -1, IPC_NOWAIT | SEM_UNDO}};
+    struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
     mock_push_expected_call({.syscall = MOCK_SEMOP,
                              .return_value = -1,
                              .errno_value = EIDRM,
-                             .args = {.semop = {.semid = 42, .sops = expected_sops, .nsops = 1}}});
+                             .args = {.semop = {.semid = 42, .sops = release_sops, .nsops = 2}}});
 
     // Destructor will be called here and should swallow the exception
     delete sem;
@@ -952,6 +1357,171 @@ TEST_F(SemaphoreVTest, DestructorSwallowsCloseException) {
   SUCCEED();
 }
 
+TEST_F(SemaphoreVTest, WaitAndPostSurviveSignalStorm) {
+  SemaphoreV *sem = createSemaphore();
+  const int iterations = 1000;
+
+  struct sembuf wait_sops[1] = {{0, -1, SEM_UNDO}};
+  struct sembuf post_sops[1] = {{0, 1, SEM_UNDO}};
+  for (int i = 0; i < iterations; i++) {
+    mock_push_expected_call({.syscall = MOCK_SEMOP,
+                             .return_value = 0,
+                             .errno_value = 0,
+                             .args = {.semop = {.semid = 42, .sops = wait_sops, .nsops = 1}}});
+    mock_push_expected_call({.syscall = MOCK_SEMOP,
+                             .return_value = 0,
+                             .errno_value = 0,
+                             .args = {.semop = {.semid = 42, .sops = post_sops, .nsops = 1}}});
+  }
+
+  // roughly what a process being profiled with a high SIGPROF rate sees
+  mock_fault_seed(26);
+  mock_fault_inject(MOCK_SEMOP, EINTR, 0.5);
+  mock_latency_inject(MOCK_SEMOP, 10, 0.05);
+
+  std::vector<std::chrono::nanoseconds> latencies;
+  latencies.reserve(iterations);
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    auto start = std::chrono::steady_clock::now();
+    sem->wait();
+    sem->post();
+    latencies.push_back(std::chrono::steady_clock::now() - start);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - begin;
+
+  EXPECT_GT(mock_fault_count(MOCK_SEMOP), unsigned(iterations / 2));
+
+  std::sort(latencies.begin(), latencies.end());
+  RecordProperty("interrupts", mock_fault_count(MOCK_SEMOP));
+  RecordProperty("ops_per_second", int(iterations * 2 / std::chrono::duration<double>(elapsed).count()));
+  RecordProperty("p50_ns", int(latencies[iterations / 2].count()));
+  RecordProperty("p99_ns", int(latencies[iterations * 99 / 100].count()));
+
+  // every queued call was consumed despite the interrupts
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, TryWaitReturnsFalseOnInjectedEagain) {
+  SemaphoreV *sem = createSemaphore();
+
+  mock_fault_inject(MOCK_SEMOP, EAGAIN, 1.0);
+  EXPECT_FALSE(sem->trywait());
+  EXPECT_EQ(mock_fault_count(MOCK_SEMOP), 1u);
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, WaitThrowsOnInjectedEidrm) {
+  SemaphoreV *sem = createSemaphore();
+
+  mock_fault_seed(26);
+  mock_fault_inject(MOCK_SEMOP, EINTR, 0.5);
+  mock_fault_inject(MOCK_SEMOP, EIDRM, 1.0);
+
+  try {
+    sem->wait();
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EIDRM);
+  }
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, CreateThrowsOnInjectedEnospc) {
+  Token key = createToken();
+
+  mock_fault_inject(MOCK_SEMGET, ENOSPC, 1.0);
+
+  try {
+    SemaphoreV::create(key, 0xFFFFFFFF, 1);
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), ENOSPC);
+  }
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, ConcurrentOpenUseAndClose) {
+  Token key = createToken();
+  const int threads = 8;
+
+  std::vector<std::thread> workers;
+  std::vector<unsigned> unconsumed(threads);
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t] {
+      int semid = 100 + t;
+      struct sembuf open_sops[1] = {{1, 1, SEM_UNDO}};
+      struct sembuf wait_sops[1] = {{0, -1, SEM_UNDO}};
+      struct sembuf post_sops[1] = {{0, 1, SEM_UNDO}};
+
+      mock_push_thread_call({.syscall = MOCK_SEMGET,
+                             .return_value = semid,
+                             .errno_value = 0,
+                             .args = {.semget = {.key = key.valueOf(), .nsems = 2, .semflg = 0}}});
+      struct sembuf release_sops[2] = {{1, -2, IPC_NOWAIT | SEM_UNDO}, {1, 1, IPC_NOWAIT | SEM_UNDO}};
+      for (const struct sembuf *sops : {open_sops, wait_sops, post_sops}) {
+        mock_push_thread_call({.syscall = MOCK_SEMOP,
+                               .return_value = 0,
+                               .errno_value = 0,
+                               .args = {.semop = {.semid = semid, .sops = sops, .nsops = 1}}});
+      }
+      // the other threads hold references, so the close gives this one back without claiming the set
+      mock_push_thread_call({.syscall = MOCK_SEMOP,
+                             .return_value = 0,
+                             .errno_value = 0,
+                             .args = {.semop = {.semid = semid, .sops = release_sops, .nsops = 2}}});
+
+      SemaphoreV *sem = SemaphoreV::open(key);
+      sem->wait();
+      sem->post();
+      sem->close();
+      delete sem;
+      unconsumed[t] = mock_pending_calls();
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  EXPECT_EQ(unconsumed, std::vector<unsigned>(threads, 0));
+  EXPECT_EQ(mock_call_count(MOCK_SEMOP), unsigned(threads * 4));
+
+  mock_reset();
+}
+
+TEST_F(SemaphoreVTest, WaiterThreadIsReleasedByPost) {
+  SemaphoreV *sem = createSemaphore();
+
+  // the waiter's semop is sequenced after the post, as the kernel would block it until then
+  struct sembuf post_sops[1] = {{0, 1, SEM_UNDO}};
+  struct sembuf wait_sops[1] = {{0, -1, SEM_UNDO}};
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = wait_sops, .nsops = 1}},
+                           .sequence = 2});
+
+  std::thread waiter([sem] { sem->wait(); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  mock_push_expected_call({.syscall = MOCK_SEMOP,
+                           .return_value = 0,
+                           .errno_value = 0,
+                           .args = {.semop = {.semid = 42, .sops = post_sops, .nsops = 1}},
+                           .sequence = 1});
+  sem->post();
+  waiter.join();
+
+  EXPECT_EQ(mock_pending_calls(), 0u);
+
+  mock_reset();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
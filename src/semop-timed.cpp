@@ -0,0 +1,45 @@
+#include "semop-timed.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <time.h>
+
+#define MAX_BACKOFF std::chrono::milliseconds(8) // the longest sleep between attempts without semtimedop
+
+int semopTimed(int semid, struct sembuf *sops, size_t nsops, unsigned milliseconds) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+#ifdef __linux__
+  do {
+    auto left = std::max(deadline - std::chrono::steady_clock::now(), std::chrono::steady_clock::duration::zero());
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(left);
+    struct timespec timeout;
+    timeout.tv_sec = seconds.count();
+    timeout.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(left - seconds).count();
+    if (semtimedop(semid, sops, nsops, &timeout) == 0) {
+      return 0;
+    }
+  } while (errno == EINTR);
+  return -1;
+#else
+  for (size_t i = 0; i < nsops; i++) {
+    sops[i].sem_flg |= IPC_NOWAIT;
+  }
+  std::chrono::microseconds backoff(100);
+  int result;
+  while ((result = semop(semid, sops, nsops)) == -1 && (errno == EAGAIN || errno == EINTR)) {
+    auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+      errno = EAGAIN;
+      break;
+    }
+    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(backoff, deadline - now));
+    backoff = std::min<std::chrono::microseconds>(backoff * 2, MAX_BACKOFF);
+  }
+  for (size_t i = 0; i < nsops; i++) {
+    sops[i].sem_flg &= ~IPC_NOWAIT;
+  }
+  return result;
+#endif
+}
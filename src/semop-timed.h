@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+#include <sys/sem.h>
+
+// semop that gives up after milliseconds, failing with EAGAIN like an IPC_NOWAIT operation that could not be made.
+// EINTR is retried with the time that is left. Linux has semtimedop; elsewhere the operations are retried with
+// IPC_NOWAIT and a backoff, so a waiter there is not queued by the kernel and can be overtaken.
+int semopTimed(int semid, struct sembuf *sops, size_t nsops, unsigned milliseconds);
@@ -0,0 +1,472 @@
+#include "wait-async.h"
+
+#include "error.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <uv.h>
+#include <vector>
+
+#define MAX_BACKOFF 8 // milliseconds, the longest a watcher leaves a readable eventfd unpolled
+
+// A poll handle on a descriptor, and the other handles a kind of wait needs. The callbacks settle the waits in a
+// callback scope, so the continuations of the promises they settle run before the loop moves on. Deleted once its
+// handles are closed.
+class Watcher {
+  uv_poll_t poll;
+  Napi::AsyncContext context;
+  std::vector<uv_handle_t *> handles;
+  size_t open = 0;
+
+  static void polled(uv_poll_t *handle, int status, int events);
+  static void closed(uv_handle_t *handle);
+  static void teardown(void *watcher);
+  void release();
+
+protected:
+  Napi::Env env;
+  uv_loop_t *loop;
+
+  Watcher(Napi::Env e, int fd, const char *name);
+  virtual ~Watcher() = default;
+
+  // settles the waits it can, once the descriptor was seen readable or another handle has fired
+  virtual void service(bool readable) = 0;
+  // takes the watcher out of its registry, so that new waits start another one
+  virtual void forget() = 0;
+
+  // makes an initialised handle one of the watcher's, closed with it
+  void adopt(uv_handle_t *handle);
+  // calls service() from a callback of one of the watcher's handles
+  void serve(bool readable);
+  void watch();
+  void unwatch();
+  void close();
+
+public:
+  // rejects every wait and closes the watcher
+  virtual void fail(std::system_error &e) = 0;
+};
+
+Watcher::Watcher(Napi::Env e, int fd, const char *name) : context(e, name), env(e) {
+  if (napi_get_uv_event_loop(env, &loop) != napi_ok) {
+    throw std::system_error(EINVAL, std::system_category(), "napi_get_uv_event_loop");
+  }
+  const int error = uv_poll_init(loop, &poll, fd);
+  if (error) {
+    throw std::system_error(-error, std::system_category(), "uv_poll_init");
+  }
+  adopt(reinterpret_cast<uv_handle_t *>(&poll));
+  napi_add_env_cleanup_hook(env, teardown, this);
+}
+
+void Watcher::adopt(uv_handle_t *handle) {
+  handle->data = this;
+  handles.push_back(handle);
+}
+
+void Watcher::serve(bool readable) {
+  Napi::HandleScope scope(env);
+  Napi::CallbackScope callback(env, context);
+  service(readable);
+}
+
+void Watcher::polled(uv_poll_t *handle, int status, int events) {
+  Watcher *watcher = static_cast<Watcher *>(handle->data);
+  if (status < 0) {
+    Napi::HandleScope scope(watcher->env);
+    Napi::CallbackScope callback(watcher->env, watcher->context);
+    std::system_error e(-status, std::system_category(), "uv_poll");
+    watcher->fail(e);
+  } else {
+    watcher->serve(events & UV_READABLE);
+  }
+}
+
+void Watcher::closed(uv_handle_t *handle) {
+  Watcher *watcher = static_cast<Watcher *>(handle->data);
+  if (--watcher->open == 0) {
+    delete watcher;
+  }
+}
+
+// the environment is going away with waits pending, which are left unsettled
+void Watcher::teardown(void *watcher) { static_cast<Watcher *>(watcher)->release(); }
+
+void Watcher::release() {
+  forget();
+  open = handles.size();
+  for (uv_handle_t *handle : handles) {
+    uv_close(handle, closed);
+  }
+}
+
+void Watcher::watch() {
+  const int error = uv_poll_start(&poll, UV_READABLE, polled);
+  if (error) {
+    std::system_error e(-error, std::system_category(), "uv_poll_start");
+    fail(e);
+  }
+}
+
+void Watcher::unwatch() { uv_poll_stop(&poll); }
+
+void Watcher::close() {
+  napi_remove_env_cleanup_hook(env, teardown, this);
+  release();
+}
+
+// The waits made on one SemaphoreE from this thread's loop, served first come first served.
+class EventfdWatcher : public Watcher {
+  struct Wait {
+    unsigned value;
+    Napi::Promise::Deferred deferred;
+  };
+
+  SemaphoreE *semaphore;
+  std::unique_ptr<SemaphoreE> duplicate;
+  std::deque<Wait> waits;
+  uv_timer_t timer;
+  uint64_t delay = 1;
+
+  EventfdWatcher(Napi::Env e, SemaphoreE *s, int fd);
+
+  static void elapsed(uv_timer_t *handle);
+  void service(bool readable) override;
+  void forget() override;
+
+public:
+  static thread_local std::unordered_map<SemaphoreE *, EventfdWatcher *> watchers;
+
+  static EventfdWatcher *start(Napi::Env env, SemaphoreE *semaphore);
+  void add(unsigned value, Napi::Promise::Deferred deferred);
+  void fail(std::system_error &e) override;
+};
+
+thread_local std::unordered_map<SemaphoreE *, EventfdWatcher *> EventfdWatcher::watchers;
+
+EventfdWatcher::EventfdWatcher(Napi::Env e, SemaphoreE *s, int fd)
+    : Watcher(e, fd, "SemaphoreE.waitAsync"), semaphore(s) {
+  uv_timer_init(loop, &timer);
+  adopt(reinterpret_cast<uv_handle_t *>(&timer));
+}
+
+// the watcher polls a duplicate, so closing the semaphore cannot close the descriptor under the poll handle
+EventfdWatcher *EventfdWatcher::start(Napi::Env env, SemaphoreE *semaphore) {
+  std::unique_ptr<SemaphoreE> duplicate(SemaphoreE::fromFd(semaphore->fd()));
+  EventfdWatcher *watcher = new EventfdWatcher(env, semaphore, duplicate->fd());
+  watcher->duplicate = std::move(duplicate);
+  watchers[semaphore] = watcher;
+  return watcher;
+}
+
+void EventfdWatcher::add(unsigned value, Napi::Promise::Deferred deferred) {
+  waits.push_back({value, deferred});
+  if (waits.size() == 1) {
+    watch();
+  }
+}
+
+void EventfdWatcher::elapsed(uv_timer_t *handle) { static_cast<EventfdWatcher *>(handle->data)->serve(false); }
+
+void EventfdWatcher::service(bool readable) {
+  while (!waits.empty()) {
+    Wait &first = waits.front();
+    try {
+      if (!duplicate->trywait(first.value)) {
+        break;
+      }
+      first.deferred.Resolve(env.Undefined());
+    } catch (std::system_error &e) {
+      first.deferred.Reject(javaScriptError(e, env).Value());
+    }
+    waits.pop_front();
+    delay = 1;
+  }
+  if (waits.empty()) {
+    close();
+  } else if (readable && waits.front().value > 1) {
+    // some units but too few: the descriptor stays readable until they are taken, so polling it would spin
+    unwatch();
+    uv_timer_start(&timer, elapsed, delay, 0);
+    delay = std::min<uint64_t>(delay * 2, MAX_BACKOFF);
+  } else {
+    watch();
+  }
+}
+
+void EventfdWatcher::forget() { watchers.erase(semaphore); }
+
+void EventfdWatcher::fail(std::system_error &e) {
+  std::deque<Wait> failed;
+  failed.swap(waits);
+  close();
+  for (Wait &wait : failed) {
+    wait.deferred.Reject(javaScriptError(e, env).Value());
+  }
+}
+
+Napi::Promise waitAsync(Napi::Env env, SemaphoreE *semaphore, unsigned value) {
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  try {
+    auto found = EventfdWatcher::watchers.find(semaphore);
+    // a wait made while others are queued joins the queue rather than overtake them
+    if (found != EventfdWatcher::watchers.end()) {
+      found->second->add(value, deferred);
+    } else if (semaphore->trywait(value)) {
+      deferred.Resolve(env.Undefined());
+    } else {
+      EventfdWatcher::start(env, semaphore)->add(value, deferred);
+    }
+  } catch (std::system_error &e) {
+    deferred.Reject(javaScriptError(e, env).Value());
+  }
+  return deferred.Promise();
+}
+
+void cancelAndClose(SemaphoreE *semaphore) {
+  auto found = EventfdWatcher::watchers.find(semaphore);
+  if (found != EventfdWatcher::watchers.end()) {
+    std::system_error e(ECANCELED, std::system_category(), "close");
+    found->second->fail(e);
+  }
+  semaphore->close();
+}
+
+// The waits made through SemaphoreF from this thread's loop. Every thread's watcher polls the process's completion
+// eventfd, and the one that sees it readable drains completed() and hands each ticket to the watcher that waits for it,
+// waking another thread's through its uv_async_t.
+class FutexWatcher : public Watcher {
+  struct Wait {
+    SemaphoreF *semaphore;
+    Napi::Promise::Deferred deferred;
+  };
+  struct Owner {
+    FutexWatcher *watcher; // nullptr once its thread has gone, when a unit the wait takes is given back
+    SemaphoreF *semaphore;
+  };
+  typedef std::vector<std::pair<unsigned, int>> Tickets; // with the errno of a wait that failed, or 0
+
+  uv_async_t handover;
+  std::unordered_map<unsigned, Wait> waits;
+  Tickets arrived; // under the mutex
+
+  static std::mutex mutex;
+  static std::unordered_map<unsigned, Owner> owners;
+
+  FutexWatcher(Napi::Env e, int fd);
+
+  static void handed(uv_async_t *handle);
+  static void giveBack(SemaphoreF *semaphore);
+  // under the mutex, drains completed() and takes the tickets that have arrived for this watcher
+  Tickets collect();
+  void settle(Tickets &done);
+  void service(bool readable) override;
+  void forget() override;
+
+public:
+  static thread_local FutexWatcher *current;
+
+  static FutexWatcher *start(Napi::Env env);
+  void add(SemaphoreF *semaphore, Napi::Promise::Deferred deferred);
+  void cancel(SemaphoreF *semaphore);
+  void fail(std::system_error &e) override;
+};
+
+std::mutex FutexWatcher::mutex;
+std::unordered_map<unsigned, FutexWatcher::Owner> FutexWatcher::owners;
+thread_local FutexWatcher *FutexWatcher::current = nullptr;
+
+FutexWatcher::FutexWatcher(Napi::Env e, int fd) : Watcher(e, fd, "SemaphoreF.waitAsync") {
+  uv_async_init(loop, &handover, handed);
+  adopt(reinterpret_cast<uv_handle_t *>(&handover));
+}
+
+FutexWatcher *FutexWatcher::start(Napi::Env env) {
+  FutexWatcher *watcher = new FutexWatcher(env, SemaphoreF::completionFd());
+  current = watcher;
+  return watcher;
+}
+
+void FutexWatcher::handed(uv_async_t *handle) { static_cast<FutexWatcher *>(handle->data)->serve(false); }
+
+// the unit taken by a wait that no one is left to settle
+void FutexWatcher::giveBack(SemaphoreF *semaphore) {
+  if (semaphore->isFutex()) {
+    semaphore->post();
+  }
+}
+
+// the ticket is registered under the mutex, so the thread that drains it always finds its watcher
+void FutexWatcher::add(SemaphoreF *semaphore, Napi::Promise::Deferred deferred) {
+  try {
+    std::lock_guard<std::mutex> lock(mutex);
+    const unsigned ticket = semaphore->waitAsync();
+    owners[ticket] = {this, semaphore};
+    waits.insert({ticket, {semaphore, deferred}});
+  } catch (std::system_error &) {
+    if (waits.empty()) {
+      close();
+    }
+    throw;
+  }
+  if (waits.size() == 1) {
+    watch();
+  }
+}
+
+FutexWatcher::Tickets FutexWatcher::collect() {
+  for (;;) {
+    unsigned ticket;
+    int error = 0;
+    try {
+      ticket = SemaphoreF::completed();
+    } catch (FutexWaitError &e) {
+      ticket = e.ticket;
+      error = e.code().value();
+    }
+    if (!ticket) {
+      break;
+    }
+    auto found = owners.find(ticket);
+    if (found == owners.end()) {
+      continue;
+    }
+    const Owner owner = found->second;
+    owners.erase(found);
+    if (!owner.watcher) {
+      if (!error) {
+        giveBack(owner.semaphore);
+      }
+    } else {
+      owner.watcher->arrived.push_back({ticket, error});
+      if (owner.watcher != this) {
+        uv_async_send(&owner.watcher->handover);
+      }
+    }
+  }
+  Tickets done;
+  done.swap(arrived);
+  return done;
+}
+
+void FutexWatcher::settle(Tickets &done) {
+  for (auto &[ticket, error] : done) {
+    auto found = waits.find(ticket);
+    if (found == waits.end()) {
+      continue;
+    }
+    if (error) {
+      std::system_error e(error, std::system_category(), "io_uring");
+      found->second.deferred.Reject(javaScriptError(e, env).Value());
+    } else {
+      found->second.deferred.Resolve(env.Undefined());
+    }
+    waits.erase(found);
+  }
+  if (waits.empty()) {
+    close();
+  }
+}
+
+void FutexWatcher::service(bool readable) {
+  Tickets done;
+  try {
+    std::lock_guard<std::mutex> lock(mutex);
+    done = collect();
+  } catch (std::system_error &e) {
+    fail(e);
+    return;
+  }
+  settle(done);
+}
+
+// the semaphore is closed under the mutex, after taking the tickets that have completed, so none of its waits can
+// complete unseen: close() cancels the rest
+void FutexWatcher::cancel(SemaphoreF *semaphore) {
+  Tickets done;
+  std::exception_ptr failure;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    done = collect();
+    for (auto &[ticket, error] : done) {
+      auto found = waits.find(ticket);
+      if (found != waits.end() && found->second.semaphore == semaphore && !error) {
+        giveBack(semaphore);
+      }
+    }
+    try {
+      semaphore->close();
+    } catch (std::system_error &) {
+      failure = std::current_exception();
+    }
+    for (auto owner = owners.begin(); owner != owners.end();) {
+      owner = owner->second.semaphore == semaphore ? owners.erase(owner) : std::next(owner);
+    }
+  }
+  std::system_error e(ECANCELED, std::system_category(), "close");
+  for (auto wait = waits.begin(); wait != waits.end();) {
+    if (wait->second.semaphore == semaphore) {
+      wait->second.deferred.Reject(javaScriptError(e, env).Value());
+      wait = waits.erase(wait);
+    } else {
+      wait++;
+    }
+  }
+  settle(done);
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+}
+
+void FutexWatcher::forget() {
+  current = nullptr;
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto &entry : owners) {
+    if (entry.second.watcher == this) {
+      entry.second.watcher = nullptr;
+    }
+  }
+  for (auto &[ticket, error] : arrived) {
+    auto found = waits.find(ticket);
+    if (found != waits.end() && !error) {
+      giveBack(found->second.semaphore);
+    }
+  }
+  arrived.clear();
+}
+
+void FutexWatcher::fail(std::system_error &e) {
+  close();
+  for (auto &entry : waits) {
+    entry.second.deferred.Reject(javaScriptError(e, env).Value());
+  }
+  waits.clear();
+}
+
+Napi::Promise waitAsync(Napi::Env env, SemaphoreF *semaphore) {
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  try {
+    FutexWatcher *watcher = FutexWatcher::current ? FutexWatcher::current : FutexWatcher::start(env);
+    watcher->add(semaphore, deferred);
+  } catch (std::system_error &e) {
+    deferred.Reject(javaScriptError(e, env).Value());
+  }
+  return deferred.Promise();
+}
+
+void cancelAndClose(SemaphoreF *semaphore) {
+  if (FutexWatcher::current) {
+    FutexWatcher::current->cancel(semaphore);
+  } else {
+    semaphore->close();
+  }
+}
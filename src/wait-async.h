@@ -0,0 +1,22 @@
+#pragma once
+
+#include "semaphore-eventfd.h"
+#include "semaphore-futex.h"
+
+#include <napi.h>
+
+// Waits that settle a promise instead of blocking the event loop, for the semaphores that signal a descriptor the loop
+// can watch. The waits on a descriptor share one uv_poll_t watcher per loop, as libuv allows only one, and it is
+// closed when none are left, so only a pending wait keeps the loop alive.
+
+// resolves once value units are taken. Waits are served in the order they were made, and while the eventfd is readable
+// with too few units for the first one the watcher stops polling for a backoff of up to 8ms, as wait(value) does. The
+// watcher polls a duplicate of the descriptor
+Napi::Promise waitAsync(Napi::Env env, SemaphoreE *semaphore, unsigned value);
+// resolves once the io_uring wait for a unit has taken it. The tickets of every thread are returned by completed() on
+// the process's completionFd(), so the watcher that sees it readable hands the tickets of other threads over to theirs.
+// The bindings own completed(), so waits made with SemaphoreF::waitAsync() directly are never returned to their caller
+Napi::Promise waitAsync(Napi::Env env, SemaphoreF *semaphore);
+// closes the semaphore after rejecting the waits made on it with ECANCELED; units they already took are given back
+void cancelAndClose(SemaphoreE *semaphore);
+void cancelAndClose(SemaphoreF *semaphore);
@@ -0,0 +1,249 @@
+const { execFileSync } = require('node:child_process');
+const { open, unlink } = require('node:fs/promises');
+const sysv = require('..');
+const {
+  Token,
+  SemaphoreV,
+  Semaphore,
+  SemaphoreVList,
+  SemaphoreSetInfoList,
+  SemaphoreE,
+  SemaphoreP,
+  SemaphoreF,
+  CountdownLatch,
+  Barrier,
+  RwLock,
+  Event,
+  Condition,
+  RecursiveMutex,
+  SemaphoreArray,
+  SemaphoreSharded,
+  SemaphoreNamespace,
+  NamedSemaphore
+} = sysv;
+
+const name = './tmp/bindings';
+
+// one smoke test per export, so a class missing from the generated bindings fails here rather than in a caller
+describe('bindings', () => {
+  beforeAll(async () => {
+    const F = await open(name, 'wx');
+    F.close();
+  });
+  afterAll(async () => {
+    await unlink(name);
+  });
+
+  it('should export every class', () => {
+    for (const [exported, value] of Object.entries(sysv)) {
+      expect([exported, typeof value]).toEqual([exported, 'function']);
+    }
+    expect(Semaphore).toBe(SemaphoreV);
+  });
+
+  it('Token', () => {
+    const key = new Token(name, 1);
+    expect(key.valueOf()).toBe(new Token(name, 1).valueOf());
+    expect(key.valueOf()).not.toBe(new Token(name, 2).valueOf());
+  });
+
+  it('SemaphoreV', () => {
+    const semaphore = SemaphoreV.createExclusive(new Token(name, 3), 0o600, 2);
+    semaphore.wait();
+    expect(semaphore.trywait(2)).toBe(false);
+    expect(semaphore.timedwait(2, 1)).toBe(false);
+    semaphore.post(2);
+    expect(semaphore.valueOf()).toBe(3);
+    expect(semaphore.refs()).toBe(1);
+    semaphore.close();
+  });
+
+  it('SemaphoreVList', () => {
+    const first = SemaphoreV.createExclusive(new Token(name, 4), 0o600, 0);
+    const second = SemaphoreV.createExclusive(new Token(name, 5), 0o600, 1);
+    const semaphores = new SemaphoreVList();
+    semaphores.add(first);
+    semaphores.add(second);
+    expect(semaphores.size()).toBe(2);
+    expect(semaphores.get(1).valueOf()).toBe(1);
+    expect(SemaphoreV.acquireAny(semaphores, 1)).toBe(1);
+    expect(SemaphoreV.acquireAny(semaphores, 1)).toBe(-1);
+    first.close();
+    second.close();
+  });
+
+  it('SemaphoreSetInfoList', () => {
+    const key = new Token(name, 6);
+    const semaphore = SemaphoreV.createExclusive(key, 0o600, 7);
+    const list = SemaphoreV.list();
+    expect(list).toBeInstanceOf(SemaphoreSetInfoList);
+    const infos = [];
+    for (let i = 0; i < list.size(); i++) {
+      infos.push(list.get(i));
+    }
+    const info = infos.find((candidate) => candidate.key === key.valueOf());
+    expect(info.values.size()).toBe(2);
+    expect(info.values.get(0)).toBe(7);
+    expect(SemaphoreV.limits().setsInUse).toBeGreaterThan(0);
+    semaphore.close();
+  });
+
+  it('SemaphoreE', () => {
+    const semaphore = SemaphoreE.create(1);
+    expect(semaphore.trywait()).toBe(true);
+    expect(semaphore.trywait()).toBe(false);
+    semaphore.post(2);
+    expect(semaphore.valueOf()).toBe(2);
+    semaphore.close();
+  });
+
+  it('SemaphoreE.waitAsync', async () => {
+    const semaphore = SemaphoreE.create(1);
+    await semaphore.waitAsync();
+    const first = semaphore.waitAsync(3);
+    const second = semaphore.waitAsync();
+    semaphore.post(2);
+    setTimeout(() => semaphore.post(2), 5);
+    await Promise.all([first, second]);
+    expect(semaphore.valueOf()).toBe(0);
+    const cancelled = semaphore.waitAsync();
+    semaphore.close();
+    await expect(cancelled).rejects.toThrowErrnoError('close', 'ECANCELED');
+  });
+
+  it('SemaphoreP', () => {
+    const semaphore = SemaphoreP.createExclusive(new Token(name, 7), 0o600, 1);
+    semaphore.wait();
+    expect(semaphore.trywait()).toBe(false);
+    semaphore.post();
+    expect(semaphore.valueOf()).toBe(1);
+    semaphore.close();
+  });
+
+  it('SemaphoreF', () => {
+    const semaphore = SemaphoreF.createExclusive(new Token(name, 8), 0o600, 1);
+    semaphore.wait();
+    expect(semaphore.trywait()).toBe(false);
+    semaphore.post(2);
+    expect(semaphore.valueOf()).toBe(2);
+    expect(typeof semaphore.isFutex()).toBe('boolean');
+    semaphore.close();
+  });
+
+  it('SemaphoreF.waitAsync', async () => {
+    const semaphore = SemaphoreF.createExclusive(new Token(name, 19), 0o600, 1);
+    if (!semaphore.isFutex()) {
+      await expect(semaphore.waitAsync()).rejects.toThrowErrnoError('io_uring', 'ENOSYS');
+      semaphore.close();
+      return;
+    }
+    await semaphore.waitAsync();
+    const waited = semaphore.waitAsync();
+    setTimeout(() => semaphore.post(), 5);
+    await waited;
+    expect(semaphore.valueOf()).toBe(0);
+    const cancelled = semaphore.waitAsync();
+    semaphore.close();
+    await expect(cancelled).rejects.toThrowErrnoError('close', 'ECANCELED');
+  });
+
+  it('CountdownLatch', () => {
+    const latch = CountdownLatch.createExclusive(new Token(name, 9), 0o600, 2);
+    latch.countDown();
+    expect(latch.trywait()).toBe(false);
+    latch.countDown();
+    expect(latch.count()).toBe(0);
+    latch.wait();
+    latch.close();
+  });
+
+  it('Barrier', () => {
+    const barrier = Barrier.createExclusive(new Token(name, 10), 0o600, 1);
+    barrier.wait();
+    expect(barrier.parties()).toBe(1);
+    expect(barrier.isBroken()).toBe(false);
+    barrier.close();
+  });
+
+  it('RwLock', () => {
+    const lock = RwLock.createExclusive(new Token(name, 11), 0o600);
+    lock.readLock();
+    expect(lock.readers()).toBe(1);
+    expect(lock.tryWriteLock()).toBe(false);
+    lock.readUnlock();
+    lock.writeLock();
+    expect(lock.isWriteLocked()).toBe(true);
+    lock.writeUnlock();
+    lock.close();
+  });
+
+  it('Event', () => {
+    const event = Event.createExclusive(new Token(name, 12), 0o600, false);
+    expect(event.trywait()).toBe(false);
+    event.set();
+    expect(event.isSet()).toBe(true);
+    event.wait();
+    event.reset();
+    expect(event.timedwait(1)).toBe(false);
+    event.close();
+  });
+
+  it('Condition', () => {
+    const condition = Condition.createExclusive(new Token(name, 13), 0o600);
+    condition.lock();
+    expect(condition.timedwait(1)).toBe(false);
+    condition.notifyAll();
+    condition.unlock();
+    condition.close();
+  });
+
+  it('RecursiveMutex', () => {
+    const mutex = RecursiveMutex.createExclusive(new Token(name, 14), 0o600);
+    mutex.lock();
+    expect(mutex.trylock()).toBe(true);
+    expect(mutex.lockCount()).toBe(2);
+    mutex.unlock();
+    mutex.unlock();
+    mutex.close();
+  });
+
+  it('SemaphoreArray', () => {
+    const array = SemaphoreArray.createExclusive(new Token(name, 15), 0o600, 3, 1);
+    array.transfer(0, 1, 1);
+    expect([array.valueOf(0), array.valueOf(1), array.valueOf(2)]).toEqual([0, 2, 1]);
+    expect(array.tryTransfer(0, 2, 1)).toBe(false);
+    expect(array.size()).toBe(3);
+    array.close();
+  });
+
+  it('SemaphoreSharded', () => {
+    const semaphore = SemaphoreSharded.createExclusive(new Token(name, 16), 0o600, 4, 8);
+    semaphore.wait(3);
+    expect(semaphore.valueOf()).toBe(5);
+    expect(semaphore.shards()).toBe(4);
+    semaphore.post(3);
+    expect(semaphore.valueOf()).toBe(8);
+    semaphore.close();
+  });
+
+  it('SemaphoreNamespace and NamedSemaphore', () => {
+    const namespace = SemaphoreNamespace.createExclusive(new Token(name, 17), 0o600, 4);
+    const semaphore = namespace.createSemaphoreExclusive('jobs', 1);
+    expect(semaphore).toBeInstanceOf(NamedSemaphore);
+    semaphore.wait();
+    const opened = namespace.openSemaphore('jobs');
+    expect(opened.valueOf()).toBe(0);
+    expect(namespace.used()).toBe(1);
+    semaphore.post();
+    opened.close();
+    semaphore.close();
+    namespace.close();
+  });
+
+  it('sysv-semaphores should list the sets', () => {
+    const semaphore = SemaphoreV.createExclusive(new Token(name, 18), 0o600, 1);
+    const sets = JSON.parse(execFileSync(process.execPath, ['bin/sysv-semaphores.js', '--json'], { encoding: 'utf8' }));
+    expect(sets.some((set) => set.key === new Token(name, 18).valueOf())).toBe(true);
+    semaphore.close();
+  });
+});
@@ -0,0 +1,109 @@
+const { Worker } = require('node:worker_threads');
+const SemaphoreS = require('../semaphore-shared.js');
+
+// runs body in a worker with the semaphore adopted from its buffer, resolving with what body returns
+function inWorker(semaphore, body) {
+  const source = `
+    const { parentPort, workerData } = require('node:worker_threads');
+    const SemaphoreS = require(${JSON.stringify(require.resolve('../semaphore-shared.js'))});
+    const semaphore = SemaphoreS.from(workerData);
+    Promise.resolve((${body.toString()})(semaphore)).then((result) => {
+      semaphore.close();
+      parentPort.postMessage(result);
+    });
+  `;
+  const worker = new Worker(source, { eval: true, workerData: semaphore.buffer });
+  return new Promise((resolve, reject) => {
+    worker.once('message', resolve);
+    worker.once('error', reject);
+  });
+}
+
+describe('SemaphoreS', () => {
+  describe('sempahore operations', () => {
+    let semaphore;
+    beforeAll(() => {
+      semaphore = SemaphoreS.create(10);
+    });
+    afterAll(() => {
+      semaphore.close();
+    });
+
+    it('should have the initial value of 10', () => {
+      expect(semaphore.valueOf()).toBe(10);
+    });
+    it('should should throw if the wait argument is negative', () => {
+      expect(() => semaphore.wait(-1)).toThrow('Illegal arguments for function trywait.');
+    });
+    it('should should subtract 9 from the semaphore without blocking', () => {
+      expect(() => semaphore.wait(9)).not.toThrow();
+      expect(semaphore.valueOf()).toBe(1);
+    });
+    it('should not subtract 2 from the semaphore and return false without blocking', () => {
+      expect(semaphore.trywait(2)).toBe(false);
+      expect(semaphore.valueOf()).toBe(1);
+    });
+    it('should decrement the semaphore and return true without blocking', () => {
+      expect(semaphore.trywait()).toBe(true);
+      expect(semaphore.valueOf()).toBe(0);
+    });
+    it('should add 9 to the semaphore', () => {
+      expect(() => semaphore.post(9)).not.toThrow();
+      expect(semaphore.valueOf()).toBe(9);
+    });
+    it('should throw ERANGE from a post past the limit and leave the count alone', () => {
+      expect(() => semaphore.post(0x7fffffff)).toThrowErrnoError('post', 'ERANGE');
+      expect(semaphore.valueOf()).toBe(9);
+    });
+    it('should resolve waitAsync at once when the units are free', async () => {
+      await expect(semaphore.waitAsync(9)).resolves.toBeUndefined();
+      expect(semaphore.valueOf()).toBe(0);
+    });
+  });
+
+  describe('close', () => {
+    it('should throw EINVAL from operations on a closed semaphore', () => {
+      const semaphore = SemaphoreS.create(1);
+      semaphore.close();
+      expect(() => semaphore.wait()).toThrowErrnoError('trywait', 'EINVAL');
+      expect(() => semaphore.post()).toThrowErrnoError('post', 'EINVAL');
+      expect(() => semaphore.close()).toThrowErrnoError('close', 'EINVAL');
+    });
+    it('should count the creator and the references taken by from', () => {
+      const semaphore = SemaphoreS.create(1);
+      expect(semaphore.refs()).toBe(1);
+      const adopted = SemaphoreS.from(semaphore.buffer);
+      expect(semaphore.refs()).toBe(2);
+      adopted.close();
+      expect(semaphore.refs()).toBe(1);
+    });
+  });
+
+  describe('worker cooperation', () => {
+    it('should share the count with a worker', async () => {
+      const semaphore = SemaphoreS.create(0);
+      await expect(inWorker(semaphore, (sem) => sem.post(3))).resolves.toBeUndefined();
+      expect(semaphore.valueOf()).toBe(3);
+    });
+    it('should resolve waitAsync when a worker posts', async () => {
+      const semaphore = SemaphoreS.create(0);
+      let acquired = false;
+      const waiting = semaphore.waitAsync(2).then(() => (acquired = true));
+      await inWorker(semaphore, (sem) => sem.post());
+      expect(acquired).toBe(false);
+      await inWorker(semaphore, (sem) => sem.post());
+      await waiting;
+      expect(semaphore.valueOf()).toBe(0);
+    });
+    it('should release a worker blocked in wait', async () => {
+      const semaphore = SemaphoreS.create(0);
+      const blocked = inWorker(semaphore, (sem) => {
+        sem.wait();
+        return 'acquired';
+      });
+      setTimeout(() => semaphore.post(), 20);
+      await expect(blocked).resolves.toBe('acquired');
+      expect(semaphore.valueOf()).toBe(0);
+    });
+  });
+});